@@ -812,8 +812,8 @@ select_move (AIGProp *aprop,
       real_cur = BTOR_REAL_ADDR_AIG (cur);
       assert (btor_aig_is_and (real_cur));
       asscur = BTOR_IS_INVERTED_AIG (cur) ? -asscur : asscur;
-      c[0]   = btor_aig_get_by_id (aprop->amgr, real_cur->children[0]);
-      c[1]   = btor_aig_get_by_id (aprop->amgr, real_cur->children[1]);
+      c[0]   = btor_aig_get_left_child (aprop->amgr, real_cur);
+      c[1]   = btor_aig_get_right_child (aprop->amgr, real_cur);
 
       /* conflict */
       if (btor_aig_is_and (real_cur) && btor_aig_is_const (c[0])
@@ -960,7 +960,8 @@ aigprop_sat (AIGProp *aprop, BtorIntHashTable *roots)
       {
         for (i = 0; i < 2; i++)
         {
-          child = btor_aig_get_by_id (aprop->amgr, cur->children[i]);
+          child = btor_aig_get_by_id (
+              aprop->amgr, btor_aig_get_child_id (aprop->amgr, cur, i));
           if (!btor_aig_is_const (child)) BTOR_PUSH_STACK (stack, child);
         }
       }
@@ -972,10 +973,10 @@ aigprop_sat (AIGProp *aprop, BtorIntHashTable *roots)
       if (btor_aig_is_var (cur)) continue;
       for (i = 0; i < 2; i++)
       {
-        if (btor_aig_is_const (
-                btor_aig_get_by_id (aprop->amgr, cur->children[i])))
+        childid = btor_aig_get_child_id (aprop->amgr, cur, i);
+        if (btor_aig_is_const (btor_aig_get_by_id (aprop->amgr, childid)))
           continue;
-        childid = cur->children[i] < 0 ? -cur->children[i] : cur->children[i];
+        childid = childid < 0 ? -childid : childid;
         assert (btor_hashint_map_contains (aprop->parents, childid));
         childparents = btor_hashint_map_get (aprop->parents, childid)->as_ptr;
         assert (childparents);
@@ -1017,6 +1018,11 @@ aigprop_sat (AIGProp *aprop, BtorIntHashTable *roots)
          !aprop->use_restarts || j < max_steps;
          j++)
     {
+      if (btor_terminate (aprop->amgr->btor))
+      {
+        sat_result = AIGPROP_UNKNOWN;
+        goto DONE;
+      }
       if (!(move (aprop, nmoves))) goto UNSAT;
       nmoves += 1;
       if (!aprop->unsatroots->count) goto SAT;
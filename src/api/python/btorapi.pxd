@@ -11,7 +11,7 @@
 from libc.stdio cimport FILE
 from libcpp cimport bool
 from cpython.ref cimport PyObject
-from libc.stdint cimport int32_t, uint32_t
+from libc.stdint cimport int32_t, uint32_t, uint64_t
 from pyboolector import BoolectorException
 
 #include "pyboolector_options.pxd"
@@ -519,6 +519,27 @@ cdef extern from "boolector.h":
         Btor * btor, char ** args, char ** values, uint32_t size) \
       except +raise_py_error
 
+    size_t boolector_bv_assignments_words (Btor * btor,
+                                           uint32_t n,
+                                           BoolectorNode ** nodes,
+                                           uint64_t * words,
+                                           size_t size) \
+      except +raise_py_error
+
+    void boolector_bv_assignments_uint64 (Btor * btor,
+                                          uint32_t n,
+                                          BoolectorNode ** nodes,
+                                          uint64_t * values) \
+      except +raise_py_error
+
+    size_t boolector_fun_assignment_words (Btor * btor,
+                                           BoolectorNode * n_fun,
+                                           uint64_t * table,
+                                           size_t size,
+                                           uint32_t * num_entries,
+                                           bool * has_default) \
+      except +raise_py_error
+
     void boolector_print_model (Btor * btor, char * format, FILE * file) \
       except +raise_py_error
 
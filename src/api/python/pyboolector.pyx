@@ -57,6 +57,16 @@ cdef str _to_str(const char * string):
     cdef bytes py_str = string
     return str(py_str.decode())
 
+cdef object _words_to_int(const uint64_t * words, uint32_t n):
+    cdef uint32_t i
+    res = 0
+    for i in range(n):
+        res |= (<object> words[i]) << (64 * i)
+    return res
+
+cdef uint32_t _num_words(uint32_t width):
+    return (width + 63) // 64
+
 def _is_power2(uint32_t num):
     return num != 0 and (num & (num - 1)) == 0
 
@@ -1050,6 +1060,134 @@ cdef class Boolector:
         solver = solver.strip().lower()
         btorapi.boolector_set_sat_solver(self._c_btor, _ChPtr(solver)._c_str)
 
+    def Get_values(self, nodes):
+        """ Get_values(nodes)
+
+            Get the assignments of a list of bit vector nodes as integers.
+
+            May be queried only after a preceding call to
+            :func:`~pyboolector.Boolector.Sat` returned
+            :data:`~pyboolector.Boolector.SAT`.
+
+            In contrast to :data:`~pyboolector.BoolectorNode.assignment`,
+            all assignments are retrieved with a single call in binary form,
+            without any intermediate string representation.
+
+            :param nodes: A list of bit vector nodes.
+            :type nodes:  list(BoolectorBVNode)
+            :return: The assignments of ``nodes``.
+            :rtype: list(int)
+        """
+        cdef uint32_t i, n = len(nodes)
+        cdef size_t pos, size = 0
+        cdef btorapi.BoolectorNode ** c_nodes
+        cdef uint64_t * c_words
+
+        for i in range(n):
+            if not isinstance(nodes[i], BoolectorBVNode):
+                raise BoolectorException(
+                          "Node at position {} is not a bit vector " \
+                          "node".format(i))
+            size += _num_words((<BoolectorBVNode> nodes[i]).width)
+
+        c_nodes = <btorapi.BoolectorNode **> \
+                    malloc(n * sizeof(btorapi.BoolectorNode *))
+        c_words = <uint64_t *> malloc(size * sizeof(uint64_t))
+        try:
+            for i in range(n):
+                c_nodes[i] = _c_node(nodes[i])
+            btorapi.boolector_bv_assignments_words(
+                self._c_btor, n, c_nodes, c_words, size)
+            res = []
+            pos = 0
+            for i in range(n):
+                size = _num_words((<BoolectorBVNode> nodes[i]).width)
+                res.append(_words_to_int(c_words + pos, size))
+                pos += size
+        finally:
+            free(c_nodes)
+            free(c_words)
+        return res
+
+    def Get_fun_values(self, BoolectorNode n):
+        """ Get_fun_values(n)
+
+            Get the model of an array or uninterpreted function with integer
+            indices, arguments and values.
+
+            May be queried only after a preceding call to
+            :func:`~pyboolector.Boolector.Sat` returned
+            :data:`~pyboolector.Boolector.SAT`.
+
+            The model is represented as in
+            :data:`~pyboolector.BoolectorNode.assignment`, i.e., as a list of
+            tuples ``(index, value)`` for arrays and a list of tuples
+            ``([arg_0, ..., arg_n], value)`` for functions, where the default
+            value of a constant array is indicated via index ``'*'``.
+            The model is retrieved in binary form, without any intermediate
+            string representation.
+
+            :param n: Array or function node.
+            :type n:  BoolectorArrayNode or BoolectorFunNode
+            :return: The model of ``n``.
+            :rtype: list(tuple)
+        """
+        cdef uint32_t i, j, arity, num_entries, value_words
+        cdef uint32_t * arg_words
+        cdef size_t pos, size
+        cdef cbool has_default
+        cdef uint64_t * c_table
+
+        if isinstance(n, BoolectorArrayNode):
+            arity = 1
+        elif isinstance(n, BoolectorFunNode):
+            arity = (<BoolectorFunNode> n).arity
+        else:
+            raise BoolectorException(
+                      "Given node is neither an array nor a function")
+
+        size = btorapi.boolector_fun_assignment_words(
+                   self._c_btor, n._c_node, NULL, 0, &num_entries,
+                   &has_default)
+        model = []
+        if size == 0:
+            return model
+
+        arg_words = <uint32_t *> malloc(arity * sizeof(uint32_t))
+        c_table = <uint64_t *> malloc(size * sizeof(uint64_t))
+        try:
+            for i in range(arity):
+                if isinstance(n, BoolectorArrayNode):
+                    arg_words[i] = \
+                        _num_words((<BoolectorArrayNode> n).index_width)
+                else:
+                    arg_words[i] = _num_words(
+                        _get_argument_width(<BoolectorFunNode> n, i))
+            value_words = _num_words(n.width)
+            btorapi.boolector_fun_assignment_words(
+                self._c_btor, n._c_node, c_table, size, &num_entries,
+                &has_default)
+            pos = 0
+            if has_default:
+                model.append(('*', _words_to_int(c_table, value_words)))
+                pos += value_words
+            for i in range(num_entries):
+                args = []
+                for j in range(arity):
+                    args.append(_words_to_int(c_table + pos, arg_words[j]))
+                    pos += arg_words[j]
+                value = _words_to_int(c_table + pos, value_words)
+                pos += value_words
+                if isinstance(n, BoolectorArrayNode):
+                    model.append((args[0], value))
+                else:
+                    model.append((args, value))
+            assert(pos == size)
+        finally:
+            free(arg_words)
+            free(c_table)
+        return model
+
     def Print_model(self, str format = "btor", outfile = None):
         """ Print_model(format = "btor", outfile = None)
 
@@ -20,6 +20,7 @@
 #include "btorexit.h"
 #include "btorexp.h"
 #include "btormodel.h"
+#include "btormodelsnap.h"
 #include "btorparse.h"
 #include "btorprintmodel.h"
 #include "btorsat.h"
@@ -758,18 +759,6 @@ boolector_set_opt (Btor *btor, BtorOption opt, uint32_t val)
       BTOR_ABORT (btor->btor_sat_btor_called > 0,
                   "enabling/disabling incremental usage must be done "
                   "before calling 'boolector_sat'");
-      BTOR_ABORT (btor_opt_get (btor, BTOR_OPT_UCOPT),
-                  "incremental solving cannot be enabled "
-                  "if unconstrained optimization is enabled");
-    }
-    else if (opt == BTOR_OPT_UCOPT)
-    {
-      BTOR_ABORT (btor_opt_get (btor, BTOR_OPT_MODEL_GEN),
-                  "Unconstrained optimization cannot be enabled "
-                  "if model generation is enabled");
-      BTOR_ABORT (btor_opt_get (btor, BTOR_OPT_INCREMENTAL),
-                  "Unconstrained optimization cannot be enabled "
-                  "in incremental mode");
     }
     else if (opt == BTOR_OPT_FUN_DUAL_PROP)
     {
@@ -4368,6 +4357,311 @@ boolector_free_uf_assignment (Btor *btor,
 #endif
 }
 
+/*------------------------------------------------------------------------*/
+
+size_t
+boolector_bv_assignments_words (Btor *btor,
+                                uint32_t n,
+                                BoolectorNode **nodes,
+                                uint64_t *words,
+                                size_t size)
+{
+  uint32_t i;
+  size_t res;
+  BtorNode **exps;
+  const BtorBitVector *bv;
+
+  exps = BTOR_IMPORT_BOOLECTOR_NODE_ARRAY (nodes);
+  BTOR_ABORT_ARG_NULL (btor);
+  BTOR_ABORT (btor->last_sat_result != BTOR_RESULT_SAT
+                  || !btor->valid_assignments,
+              "cannot retrieve model if input formula is not SAT");
+  BTOR_ABORT (!btor_opt_get (btor, BTOR_OPT_MODEL_GEN),
+              "model generation has not been enabled");
+  BTOR_ABORT (btor->quantifiers->count,
+              "models are currently not supported with quantifiers");
+  BTOR_ABORT (n && !exps, "no nodes given but 'n' > 0");
+  BTOR_ABORT (size && !words, "no buffer given but 'size' > 0");
+
+  BTOR_TRAPI_PRINT ("%s %p %u ", __FUNCTION__ + 10, btor, n);
+  for (i = 0; i < n; i++)
+    BTOR_TRAPI_PRINT (BTOR_TRAPI_NODE_FMT, BTOR_TRAPI_NODE_ID (exps[i]));
+  BTOR_TRAPI_PRINT ("%zu\n", size);
+
+  for (i = 0, res = 0; i < n; i++)
+  {
+    BTOR_ABORT_ARG_NULL (exps[i]);
+    BTOR_ABORT_REFS_NOT_POS (exps[i]);
+    BTOR_ABORT_BTOR_MISMATCH (btor, exps[i]);
+    BTOR_ABORT_IS_NOT_BV (exps[i]);
+    res += (btor_node_bv_get_width (btor, exps[i]) + 63) / 64;
+  }
+  if (res <= size)
+  {
+    for (i = 0, res = 0; i < n; i++)
+    {
+      bv = btor_model_get_bv (btor, exps[i]);
+      btor_bv_to_words (bv, words + res);
+      res += (btor_bv_get_width (bv) + 63) / 64;
+    }
+  }
+  BTOR_TRAPI_RETURN ("%zu", res);
+#ifndef NDEBUG
+  if (btor->clone)
+  {
+    BoolectorNode *cnodes[n ? n : 1];
+    uint64_t *cwords = 0;
+    size_t cres;
+    for (i = 0; i < n; i++) cnodes[i] = BTOR_CLONED_EXP (exps[i]);
+    if (size) BTOR_NEWN (btor->mm, cwords, size);
+    cres =
+        boolector_bv_assignments_words (btor->clone, n, cnodes, cwords, size);
+    assert (cres == res);
+    assert (res > size || !memcmp (cwords, words, res * sizeof (*words)));
+    if (size) BTOR_DELETEN (btor->mm, cwords, size);
+    btor_chkclone (btor, btor->clone);
+  }
+#endif
+  return res;
+}
+
+void
+boolector_bv_assignments_uint64 (Btor *btor,
+                                 uint32_t n,
+                                 BoolectorNode **nodes,
+                                 uint64_t *values)
+{
+  uint32_t i;
+  BtorNode **exps;
+
+  exps = BTOR_IMPORT_BOOLECTOR_NODE_ARRAY (nodes);
+  BTOR_ABORT_ARG_NULL (btor);
+  BTOR_ABORT (btor->last_sat_result != BTOR_RESULT_SAT
+                  || !btor->valid_assignments,
+              "cannot retrieve model if input formula is not SAT");
+  BTOR_ABORT (!btor_opt_get (btor, BTOR_OPT_MODEL_GEN),
+              "model generation has not been enabled");
+  BTOR_ABORT (btor->quantifiers->count,
+              "models are currently not supported with quantifiers");
+  BTOR_ABORT (n && !exps, "no nodes given but 'n' > 0");
+  BTOR_ABORT (n && !values, "no buffer given but 'n' > 0");
+
+  BTOR_TRAPI_PRINT ("%s %p %u ", __FUNCTION__ + 10, btor, n);
+  for (i = 0; i < n; i++)
+    BTOR_TRAPI_PRINT (BTOR_TRAPI_NODE_FMT, BTOR_TRAPI_NODE_ID (exps[i]));
+  BTOR_TRAPI_PRINT ("\n");
+
+  for (i = 0; i < n; i++)
+  {
+    BTOR_ABORT_ARG_NULL (exps[i]);
+    BTOR_ABORT_REFS_NOT_POS (exps[i]);
+    BTOR_ABORT_BTOR_MISMATCH (btor, exps[i]);
+    BTOR_ABORT_IS_NOT_BV (exps[i]);
+    BTOR_ABORT (btor_node_bv_get_width (btor, exps[i]) > 64,
+                "bit-width of node at position %u must not be > 64",
+                i);
+  }
+  for (i = 0; i < n; i++)
+    values[i] = btor_bv_to_uint64 (btor_model_get_bv (btor, exps[i]));
+#ifndef NDEBUG
+  if (btor->clone)
+  {
+    BoolectorNode *cnodes[n ? n : 1];
+    uint64_t *cvalues = 0;
+    for (i = 0; i < n; i++) cnodes[i] = BTOR_CLONED_EXP (exps[i]);
+    if (n) BTOR_NEWN (btor->mm, cvalues, n);
+    boolector_bv_assignments_uint64 (btor->clone, n, cnodes, cvalues);
+    assert (!n || !memcmp (cvalues, values, n * sizeof (*values)));
+    if (n) BTOR_DELETEN (btor->mm, cvalues, n);
+    btor_chkclone (btor, btor->clone);
+  }
+#endif
+}
+
+size_t
+boolector_fun_assignment_words (Btor *btor,
+                                BoolectorNode *n_fun,
+                                uint64_t *table,
+                                size_t size,
+                                uint32_t *num_entries,
+                                bool *has_default)
+{
+  size_t res;
+  BtorNode *e_fun;
+
+  e_fun = BTOR_IMPORT_BOOLECTOR_NODE (n_fun);
+  BTOR_ABORT_ARG_NULL (btor);
+  BTOR_ABORT (btor->last_sat_result != BTOR_RESULT_SAT
+                  || !btor->valid_assignments,
+              "cannot retrieve model if input formula is not SAT");
+  BTOR_ABORT (!btor_opt_get (btor, BTOR_OPT_MODEL_GEN),
+              "model generation has not been enabled");
+  BTOR_ABORT_ARG_NULL (e_fun);
+  BTOR_TRAPI_UNFUN_EXT (e_fun, "%zu", size);
+  BTOR_ABORT (size && !table, "no buffer given but 'size' > 0");
+  BTOR_ABORT_ARG_NULL (num_entries);
+  BTOR_ABORT_ARG_NULL (has_default);
+  BTOR_ABORT_REFS_NOT_POS (e_fun);
+  BTOR_ABORT_BTOR_MISMATCH (btor, e_fun);
+  BTOR_ABORT_IS_NOT_FUN (e_fun);
+
+  res = btor_model_get_fun_words (
+      btor, btor_node_real_addr (e_fun), table, size, num_entries, has_default);
+  BTOR_TRAPI_RETURN ("%zu", res);
+#ifndef NDEBUG
+  if (btor->clone)
+  {
+    uint64_t *ctable = 0;
+    uint32_t cnum_entries;
+    bool chas_default;
+    size_t cres;
+    if (size) BTOR_NEWN (btor->mm, ctable, size);
+    cres = boolector_fun_assignment_words (btor->clone,
+                                           BTOR_CLONED_EXP (e_fun),
+                                           ctable,
+                                           size,
+                                           &cnum_entries,
+                                           &chas_default);
+    assert (cres == res);
+    assert (cnum_entries == *num_entries);
+    assert (chas_default == *has_default);
+    assert (res > size || !memcmp (ctable, table, res * sizeof (*table)));
+    if (size) BTOR_DELETEN (btor->mm, ctable, size);
+    btor_chkclone (btor, btor->clone);
+  }
+#endif
+  return res;
+}
+
+/*------------------------------------------------------------------------*/
+
+BoolectorModel *
+boolector_model_snapshot (Btor *btor)
+{
+  BtorModelSnap *res;
+
+  BTOR_ABORT_ARG_NULL (btor);
+  BTOR_ABORT (btor->last_sat_result != BTOR_RESULT_SAT
+                  || !btor->valid_assignments,
+              "cannot retrieve model if input formula is not SAT");
+  BTOR_ABORT (!btor_opt_get (btor, BTOR_OPT_MODEL_GEN),
+              "model generation has not been enabled");
+  BTOR_ABORT (btor->quantifiers->count,
+              "models are currently not supported with quantifiers");
+  res = btor_model_snap_new (btor);
+  return (BoolectorModel *) res;
+}
+
+void
+boolector_model_delete (BoolectorModel *model)
+{
+  BTOR_ABORT_ARG_NULL (model);
+  btor_model_snap_delete ((BtorModelSnap *) model);
+}
+
+size_t
+boolector_model_bv_words (const BoolectorModel *model,
+                          uint32_t n,
+                          BoolectorNode **nodes,
+                          uint64_t *words,
+                          size_t size)
+{
+  uint32_t i;
+  int32_t idx, id;
+  size_t res;
+  const BtorModelSnap *snap;
+
+  snap = (const BtorModelSnap *) model;
+  BTOR_ABORT_ARG_NULL (snap);
+  BTOR_ABORT (n && !nodes, "no nodes given but 'n' > 0");
+  BTOR_ABORT (size && !words, "no buffer given but 'size' > 0");
+
+  for (i = 0, res = 0; i < n; i++)
+  {
+    BTOR_ABORT_ARG_NULL (nodes[i]);
+    id  = btor_node_get_id (BTOR_IMPORT_BOOLECTOR_NODE (nodes[i]));
+    idx = btor_model_snap_find_bv (snap, id < 0 ? -id : id);
+    BTOR_ABORT (idx < 0,
+                "bit-vector term at position %u is not part of the model "
+                "snapshot",
+                i);
+    res += (snap->bv_width[idx] + 63) / 64;
+  }
+  if (res <= size)
+  {
+    for (i = 0, res = 0; i < n; i++)
+    {
+      id  = btor_node_get_id (BTOR_IMPORT_BOOLECTOR_NODE (nodes[i]));
+      idx = btor_model_snap_find_bv (snap, id < 0 ? -id : id);
+      btor_model_snap_get_bv (snap, idx, id < 0, words + res);
+      res += (snap->bv_width[idx] + 63) / 64;
+    }
+  }
+  return res;
+}
+
+void
+boolector_model_bv_uint64 (const BoolectorModel *model,
+                           uint32_t n,
+                           BoolectorNode **nodes,
+                           uint64_t *values)
+{
+  uint32_t i;
+  int32_t idx, id;
+  const BtorModelSnap *snap;
+
+  snap = (const BtorModelSnap *) model;
+  BTOR_ABORT_ARG_NULL (snap);
+  BTOR_ABORT (n && !nodes, "no nodes given but 'n' > 0");
+  BTOR_ABORT (n && !values, "no buffer given but 'n' > 0");
+
+  for (i = 0; i < n; i++)
+  {
+    BTOR_ABORT_ARG_NULL (nodes[i]);
+    id  = btor_node_get_id (BTOR_IMPORT_BOOLECTOR_NODE (nodes[i]));
+    idx = btor_model_snap_find_bv (snap, id < 0 ? -id : id);
+    BTOR_ABORT (idx < 0,
+                "bit-vector term at position %u is not part of the model "
+                "snapshot",
+                i);
+    BTOR_ABORT (snap->bv_width[idx] > 64,
+                "bit-width of node at position %u must not be > 64",
+                i);
+    btor_model_snap_get_bv (snap, idx, id < 0, values + i);
+  }
+}
+
+size_t
+boolector_model_fun_words (const BoolectorModel *model,
+                           BoolectorNode *n_fun,
+                           uint64_t *table,
+                           size_t size,
+                           uint32_t *num_entries,
+                           bool *has_default)
+{
+  size_t res;
+  int32_t idx;
+  BtorNode *e_fun;
+  const BtorModelSnap *snap;
+
+  snap  = (const BtorModelSnap *) model;
+  e_fun = BTOR_IMPORT_BOOLECTOR_NODE (n_fun);
+  BTOR_ABORT_ARG_NULL (snap);
+  BTOR_ABORT_ARG_NULL (e_fun);
+  BTOR_ABORT (size && !table, "no buffer given but 'size' > 0");
+  BTOR_ABORT_ARG_NULL (num_entries);
+  BTOR_ABORT_ARG_NULL (has_default);
+
+  idx = btor_model_snap_find_fun (snap, btor_node_real_addr (e_fun)->id);
+  BTOR_ABORT (idx < 0, "'n_fun' is not part of the model snapshot");
+  res          = snap->fun_size[idx];
+  *num_entries = snap->fun_entries[idx];
+  *has_default = snap->fun_default[idx];
+  if (res && res <= size)
+    memcpy (table, snap->fun_words + snap->fun_pos[idx], res * sizeof (*table));
+  return res;
+}
+
 void
 boolector_print_model (Btor *btor, char *format, FILE *file)
 {
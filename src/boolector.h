@@ -64,7 +64,15 @@ extern "C" {
 /*!
   Create a new instance of Boolector.
 
+  Boolector instances do not share any mutable state, independent instances
+  can be used concurrently from different threads.  A single instance (and
+  its nodes and sorts) must not be used from more than one thread at a time.
+  Use boolector_model_snapshot to query a model from several threads.
+
   :return: New Boolector instance.
+
+  .. note::
+    The abort callback (see boolector_set_abort) is maintained globally.
 */
 Btor *boolector_new (void);
 
@@ -2147,6 +2155,193 @@ void boolector_free_uf_assignment (Btor *btor,
                                    char **values,
                                    uint32_t size);
 
+/*!
+  Get the assignments of a batch of bit-vector expressions in binary form.
+
+  The assignment of each expression of bit-width ``w`` is written to
+  ``words`` as ``(w + 63) / 64`` 64-bit words, least significant word first,
+  with unused upper bits set to zero.  The words of ``nodes[i + 1]`` directly
+  follow the words of ``nodes[i]``.  No memory is allocated, the buffer is
+  owned by the caller.  If ``size`` is smaller than the number of words
+  required, nothing is written.  Call this function with ``size`` 0 to query
+  the required buffer size.
+
+  :param btor: Boolector instance.
+  :param n: Number of expressions.
+  :param nodes: Array of ``n`` bit-vector expressions.
+  :param words: Buffer of at least ``size`` words.
+  :param size: Size of buffer ``words``.
+  :return: The number of words required for all assignments.
+
+  .. note::
+    This function can only be called if boolector_sat returned
+    BOOLECTOR_SAT and model generation was enabled.
+
+  .. seealso::
+    boolector_bv_assignment, boolector_bv_assignments_uint64
+*/
+size_t boolector_bv_assignments_words (Btor *btor,
+                                       uint32_t n,
+                                       BoolectorNode **nodes,
+                                       uint64_t *words,
+                                       size_t size);
+
+/*!
+  Get the assignments of a batch of bit-vector expressions of bit-width at
+  most 64 as unsigned integers.
+
+  The assignment of ``nodes[i]`` is stored into ``values[i]``.
+
+  :param btor: Boolector instance.
+  :param n: Number of expressions.
+  :param nodes: Array of ``n`` bit-vector expressions of bit-width <= 64.
+  :param values: Buffer of at least ``n`` values.
+
+  .. note::
+    This function can only be called if boolector_sat returned
+    BOOLECTOR_SAT and model generation was enabled.
+
+  .. seealso::
+    boolector_bv_assignments_words
+*/
+void boolector_bv_assignments_uint64 (Btor *btor,
+                                      uint32_t n,
+                                      BoolectorNode **nodes,
+                                      uint64_t *values);
+
+/*!
+  Get the model of an array or uninterpreted function as a packed table of
+  64-bit words.
+
+  Each entry of the table consists of the assignments of the arguments
+  (indices for arrays) in the order of the function's parameters, followed
+  by the assignment of the corresponding value.  Each assignment is encoded
+  as in boolector_bv_assignments_words.  If the model has a default value
+  (constant arrays, see boolector_array_assignment), it is stored in front of
+  the entries and ``has_default`` is set to true.  If ``size`` is smaller
+  than the number of words required, nothing is written.
+
+  :param btor: Boolector instance.
+  :param n_fun: Array or uninterpreted function.
+  :param table: Buffer of at least ``size`` words.
+  :param size: Size of buffer ``table``.
+  :param num_entries: Pointer to the number of argument/value entries.
+  :param has_default: Pointer to flag indicating a default value.
+  :return: The number of words required for the table.
+
+  .. note::
+    This function can only be called if boolector_sat returned
+    BOOLECTOR_SAT and model generation was enabled.
+
+  .. seealso::
+    boolector_array_assignment, boolector_uf_assignment
+*/
+size_t boolector_fun_assignment_words (Btor *btor,
+                                       BoolectorNode *n_fun,
+                                       uint64_t *table,
+                                       size_t size,
+                                       uint32_t *num_entries,
+                                       bool *has_default);
+
+/*!
+  Take a snapshot of the current model.
+
+  The snapshot is an immutable copy of the assignments of all bit-vector
+  terms, arrays and uninterpreted functions that are currently referenced by
+  the user (nodes that have been released or are created after taking the
+  snapshot are not part of it).  It does not depend on the Boolector
+  instance, it is not affected by further calls to boolector_sat and may be
+  deleted after the instance.  A snapshot can be queried concurrently from
+  several threads via boolector_model_bv_words, boolector_model_bv_uint64
+  and boolector_model_fun_words.  Queries only read the ids of the given
+  nodes, hence the nodes must not be released while a query is in
+  progress.
+
+  :param btor: Boolector instance.
+  :return: The model snapshot, to be deleted via boolector_model_delete.
+
+  .. note::
+    This function can only be called if boolector_sat returned
+    BOOLECTOR_SAT and model generation was enabled.  Calls on model
+    snapshots are not recorded in API traces.
+
+  .. seealso::
+    boolector_bv_assignments_words
+*/
+BoolectorModel *boolector_model_snapshot (Btor *btor);
+
+/*!
+  Delete a model snapshot.
+
+  :param model: Model snapshot.
+
+  .. seealso::
+    boolector_model_snapshot
+*/
+void boolector_model_delete (BoolectorModel *model);
+
+/*!
+  Get the assignments of a batch of bit-vector terms from a model snapshot.
+
+  The assignments are encoded as in boolector_bv_assignments_words.  This
+  function is thread safe.
+
+  :param model: Model snapshot.
+  :param n: Number of terms.
+  :param nodes: Array of ``n`` bit-vector terms.
+  :param words: Buffer of at least ``size`` words.
+  :param size: Size of buffer ``words``.
+  :return: The number of words required for all assignments.
+
+  .. seealso::
+    boolector_model_snapshot, boolector_bv_assignments_words
+*/
+size_t boolector_model_bv_words (const BoolectorModel *model,
+                                 uint32_t n,
+                                 BoolectorNode **nodes,
+                                 uint64_t *words,
+                                 size_t size);
+
+/*!
+  Get the assignments of a batch of bit-vector terms of bit-width at most 64
+  from a model snapshot as unsigned integers.  This function is thread safe.
+
+  :param model: Model snapshot.
+  :param n: Number of terms.
+  :param nodes: Array of ``n`` bit-vector terms of bit-width <= 64.
+  :param values: Buffer of at least ``n`` values.
+
+  .. seealso::
+    boolector_model_snapshot, boolector_bv_assignments_uint64
+*/
+void boolector_model_bv_uint64 (const BoolectorModel *model,
+                                uint32_t n,
+                                BoolectorNode **nodes,
+                                uint64_t *values);
+
+/*!
+  Get the model of an array or uninterpreted function from a model snapshot
+  as a packed table, encoded as in boolector_fun_assignment_words.  This
+  function is thread safe.
+
+  :param model: Model snapshot.
+  :param n_fun: Array or uninterpreted function.
+  :param table: Buffer of at least ``size`` words.
+  :param size: Size of buffer ``table``.
+  :param num_entries: Pointer to the number of argument/value entries.
+  :param has_default: Pointer to flag indicating a default value.
+  :return: The number of words required for the table.
+
+  .. seealso::
+    boolector_model_snapshot, boolector_fun_assignment_words
+*/
+size_t boolector_model_fun_words (const BoolectorModel *model,
+                                  BoolectorNode *n_fun,
+                                  uint64_t *table,
+                                  size_t size,
+                                  uint32_t *num_entries,
+                                  bool *has_default);
+
 /*!
   Print model to output file. This function prints the model for all inputs
   to the output file ``file``. Supported output formats for the model to be
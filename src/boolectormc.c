@@ -47,6 +47,21 @@ boolector_mc_delete (BtorMC *mc)
   btor_mc_delete (mc);
 }
 
+BtorMC *
+boolector_mc_clone (BtorMC *mc, uint32_t num_bad, const uint32_t *bad)
+{
+  uint32_t i;
+
+  BTOR_ABORT_ARG_NULL (mc);
+  BTOR_ABORT (mc->state != BTOR_NO_MC_STATE || mc->forward || mc->induction,
+              "model checker can only be cloned before model checking");
+  BTOR_ABORT (num_bad && !bad, "expected bad state property indices");
+  for (i = 0; bad && i < num_bad; i++)
+    BTOR_ABORT (bad[i] >= BTOR_COUNT_STACK (mc->bad),
+                "bad state property index too large");
+  return btor_mc_clone (mc, num_bad, bad);
+}
+
 /*------------------------------------------------------------------------*/
 
 void
@@ -231,6 +246,20 @@ boolector_mc_kind (BtorMC *mc, int32_t mink, int32_t maxk)
   return btor_mc_kind (mc, mink, maxk);
 }
 
+int32_t
+boolector_mc_ic3 (BtorMC *mc, int32_t maxk)
+{
+  BtorPtrHashTableIterator it;
+
+  BTOR_ABORT_ARG_NULL (mc);
+  btor_iter_hashptr_init (&it, mc->states);
+  btor_iter_hashptr_queue (&it, mc->inputs);
+  while (btor_iter_hashptr_has_next (&it))
+    BTOR_ABORT (boolector_is_array (mc->btor, btor_iter_hashptr_next (&it)),
+                "IC3 does not support arrays");
+  return btor_mc_ic3 (mc, maxk);
+}
+
 /*------------------------------------------------------------------------*/
 
 char *
@@ -288,6 +317,41 @@ boolector_mc_set_reached_at_bound_call_back (BtorMC *mc,
   btor_mc_set_reached_at_bound_call_back (mc, state, fun);
 }
 
+int32_t
+boolector_mc_proved_bad_at_bound (BtorMC *mc, int32_t badidx)
+{
+  BTOR_ABORT_ARG_NULL (mc);
+  BTOR_ABORT (mc->state == BTOR_NO_MC_STATE,
+              "model checker was not run before");
+  BTOR_ABORT (badidx < 0, "negative bad state property index");
+  BTOR_ABORT ((size_t) badidx >= BTOR_COUNT_STACK (mc->bad),
+              "bad state property index too large");
+  return btor_mc_proved_bad_at_bound (mc, badidx);
+}
+
+bool
+boolector_mc_has_invariant (BtorMC *mc, int32_t badidx)
+{
+  BTOR_ABORT_ARG_NULL (mc);
+  BTOR_ABORT (badidx < 0, "negative bad state property index");
+  BTOR_ABORT ((size_t) badidx >= BTOR_COUNT_STACK (mc->bad),
+              "bad state property index too large");
+  return btor_mc_has_invariant (mc, badidx);
+}
+
+void
+boolector_mc_dump_invariant (BtorMC *mc, int32_t badidx, FILE *file)
+{
+  BTOR_ABORT_ARG_NULL (mc);
+  BTOR_ABORT_ARG_NULL (file);
+  BTOR_ABORT (badidx < 0, "negative bad state property index");
+  BTOR_ABORT ((size_t) badidx >= BTOR_COUNT_STACK (mc->bad),
+              "bad state property index too large");
+  BTOR_ABORT (!btor_mc_has_invariant (mc, badidx),
+              "no inductive invariant for bad state property");
+  btor_mc_dump_invariant (mc, badidx, file);
+}
+
 /*------------------------------------------------------------------------*/
 
 void
@@ -301,4 +365,12 @@ boolector_mc_set_starting_bound_call_back (BtorMC *mc,
   btor_mc_set_starting_bound_call_back (mc, state, fun);
 }
 
+void
+boolector_mc_set_term (BtorMC *mc, void *state, BtorMCTerminate fun)
+{
+  BTOR_ABORT_ARG_NULL (mc);
+  BTOR_ABORT_ARG_NULL (fun);
+  btor_mc_set_term (mc, state, fun);
+}
+
 /*------------------------------------------------------------------------*/
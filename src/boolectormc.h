@@ -25,6 +25,12 @@ BtorMC *boolector_mc_new (void);
 /* Delete model checker instance. */
 void boolector_mc_delete (BtorMC *mc);
 
+/* Clone model checker instance before model checking.  If 'bad' is not 0,
+ * only the 'num_bad' bad state properties with the given indices are
+ * cloned (bad state property 'i' of the clone is reported as 'bad[i]' in
+ * witnesses).  Clones are independent and can be checked concurrently. */
+BtorMC *boolector_mc_clone (BtorMC *mc, uint32_t num_bad, const uint32_t *bad);
+
 /*------------------------------------------------------------------------*/
 
 /* Set model checker option. */
@@ -84,8 +90,23 @@ void boolector_mc_dump (BtorMC *mc, FILE *file);
 
 int32_t boolector_mc_bmc (BtorMC *, int32_t mink, int32_t maxk);
 
+/* Check bad state properties with k-induction up to bound 'maxk'.  The base
+ * case is checked at every bound (as with 'boolector_mc_bmc'), the inductive
+ * step from bound 'mink' on.  Returns the bound at which a bad state
+ * property was reached and a negative number otherwise.  Properties proven
+ * unreachable can be queried with 'boolector_mc_proved_bad_at_bound'.
+ */
 int32_t boolector_mc_kind (BtorMC *, int32_t mink, int32_t maxk);
 
+/* Check bad state properties with IC3 (property directed reachability)
+ * with at most 'maxk' frames.  Returns the bound at which a bad state
+ * property was reached and a negative number otherwise.  Properties proven
+ * unreachable can be queried with 'boolector_mc_proved_bad_at_bound', their
+ * inductive invariants are dumped with 'boolector_mc_dump_invariant'.
+ * Array states and inputs are not supported.
+ */
+int32_t boolector_mc_ic3 (BtorMC *, int32_t maxk);
+
 /*------------------------------------------------------------------------*/
 
 /* Assumes that 'boolector_mc_set_opt (mc, BTOR_MC_OPT_TRACE_GEN, 1)'
@@ -115,6 +136,20 @@ void boolector_mc_set_reached_at_bound_call_back (BtorMC *mc,
                                                   void *state,
                                                   BtorMCReachedAtBound fun);
 
+/* Return the 'k' at which a previous call to 'boolector_mc_kind' proved that
+ * the bad state property with index 'badidx' is unreachable or a negative
+ * number if it was not proven.
+ */
+int32_t boolector_mc_proved_bad_at_bound (BtorMC *mc, int32_t badidx);
+
+/* Return true if an inductive invariant was computed by 'boolector_mc_ic3'
+ * for the bad state property with index 'badidx'. */
+bool boolector_mc_has_invariant (BtorMC *mc, int32_t badidx);
+
+/* Dump the inductive invariant of the bad state property with index
+ * 'badidx' in BTOR2 format. */
+void boolector_mc_dump_invariant (BtorMC *mc, int32_t badidx, FILE *file);
+
 /*------------------------------------------------------------------------*/
 
 
@@ -122,6 +157,10 @@ void boolector_mc_set_starting_bound_call_back (BtorMC *mc,
                                                 void *state,
                                                 BtorMCStartingBound fun);
 
+/* Set termination call back (see 'BtorMCTerminate').  A terminated model
+ * checking run returns a negative number. */
+void boolector_mc_set_term (BtorMC *mc, void *state, BtorMCTerminate fun);
+
 /*------------------------------------------------------------------------*/
 
 #endif
@@ -26,24 +26,6 @@
 
 /*------------------------------------------------------------------------*/
 
-#define BTOR_INIT_AIG_UNIQUE_TABLE(mm, table) \
-  do                                          \
-  {                                           \
-    assert (mm);                              \
-    (table).size         = 1;                 \
-    (table).num_elements = 0;                 \
-    BTOR_CNEW (mm, (table).chains);           \
-  } while (0)
-
-#define BTOR_RELEASE_AIG_UNIQUE_TABLE(mm, table)     \
-  do                                                 \
-  {                                                  \
-    assert (mm);                                     \
-    BTOR_DELETEN (mm, (table).chains, (table).size); \
-  } while (0)
-
-#define BTOR_AIG_UNIQUE_TABLE_LIMIT 30
-
 #define BTOR_AIG_UNIQUE_TABLE_PRIME 2000000137u
 
 #define BTOR_FIND_AND_AIG_CONTRADICTION_LIMIT 8
@@ -64,6 +46,33 @@
 
 /*------------------------------------------------------------------------*/
 
+#define BTOR_AIG_REFS(amgr, aig)                     \
+  ((amgr)->refs.start[BTOR_REAL_ADDR_AIG (aig)->id])
+
+#define BTOR_AIG_CNF_ID(amgr, aig)                      \
+  ((amgr)->cnf_ids.start[BTOR_REAL_ADDR_AIG (aig)->id])
+
+#define BTOR_AIG_CNF_POL(amgr, aig) \
+  ((amgr)->cnf_pols.start[BTOR_REAL_ADDR_AIG (aig)->id])
+
+/* Add entries for a new AIG with given id to the id-indexed data. */
+static void
+push_aig_data (BtorAIGMgr *amgr, BtorAIG *aig)
+{
+  assert (BTOR_COUNT_STACK (amgr->refs) == BTOR_COUNT_STACK (amgr->id2aig));
+  assert (BTOR_COUNT_STACK (amgr->cnf_ids) == BTOR_COUNT_STACK (amgr->id2aig));
+  assert (BTOR_COUNT_STACK (amgr->cnf_pols)
+          == BTOR_COUNT_STACK (amgr->id2aig));
+  assert (BTOR_COUNT_STACK (amgr->children)
+          == 2 * BTOR_COUNT_STACK (amgr->id2aig));
+  BTOR_PUSH_STACK (amgr->id2aig, aig);
+  BTOR_PUSH_STACK (amgr->refs, 1);
+  BTOR_PUSH_STACK (amgr->cnf_ids, 0);
+  BTOR_PUSH_STACK (amgr->cnf_pols, 0);
+  BTOR_PUSH_STACK (amgr->children, 0);
+  BTOR_PUSH_STACK (amgr->children, 0);
+}
+
 static void
 setup_aig_and_add_to_id_table (BtorAIGMgr *amgr, BtorAIG *aig)
 {
@@ -71,9 +80,8 @@ setup_aig_and_add_to_id_table (BtorAIGMgr *amgr, BtorAIG *aig)
 
   id = BTOR_COUNT_STACK (amgr->id2aig);
   BTOR_ABORT (id == INT32_MAX, "AIG id overflow");
-  aig->refs = 1;
-  aig->id   = id;
-  BTOR_PUSH_STACK (amgr->id2aig, aig);
+  aig->id = id;
+  push_aig_data (amgr, aig);
   assert (aig->id >= 0);
   assert (BTOR_COUNT_STACK (amgr->id2aig) == (size_t) aig->id + 1);
   assert (BTOR_PEEK_STACK (amgr->id2aig, aig->id) == aig);
@@ -87,14 +95,11 @@ new_and_aig (BtorAIGMgr *amgr, BtorAIG *left, BtorAIG *right)
   assert (!btor_aig_is_const (right));
 
   BtorAIG *aig;
-  size_t size;
 
-  size = sizeof (BtorAIG) + 2 * sizeof (int32_t);
-  aig  = btor_mem_malloc (amgr->btor->mm, size);
-  memset (aig, 0, size);
+  BTOR_SLAB_CNEW (amgr->btor->mm, aig);
   setup_aig_and_add_to_id_table (amgr, aig);
-  aig->children[0] = btor_aig_get_id (left);
-  aig->children[1] = btor_aig_get_id (right);
+  amgr->children.start[2 * (size_t) aig->id]     = btor_aig_get_id (left);
+  amgr->children.start[2 * (size_t) aig->id + 1] = btor_aig_get_id (right);
   amgr->cur_num_aigs++;
   if (amgr->max_num_aigs < amgr->cur_num_aigs)
     amgr->max_num_aigs = amgr->cur_num_aigs;
@@ -105,13 +110,17 @@ static void
 release_cnf_id_aig_mgr (BtorAIGMgr *amgr, BtorAIG *aig)
 {
   assert (!BTOR_IS_INVERTED_AIG (aig));
-  assert (aig->cnf_id > 0);
-  assert ((size_t) aig->cnf_id < BTOR_SIZE_STACK (amgr->cnfid2aig));
-  assert (amgr->cnfid2aig.start[aig->cnf_id] == aig->id);
+
+  int32_t cnf_id = BTOR_AIG_CNF_ID (amgr, aig);
+
+  assert (cnf_id > 0);
+  assert ((size_t) cnf_id < BTOR_SIZE_STACK (amgr->cnfid2aig));
+  assert (amgr->cnfid2aig.start[cnf_id] == aig->id);
   if (amgr->smgr->have_restore) return;
-  amgr->cnfid2aig.start[aig->cnf_id] = 0;
-  btor_sat_mgr_release_cnf_id (amgr->smgr, aig->cnf_id);
-  aig->cnf_id = 0;
+  amgr->cnfid2aig.start[cnf_id] = 0;
+  btor_sat_mgr_release_cnf_id (amgr->smgr, cnf_id);
+  BTOR_AIG_CNF_ID (amgr, aig)  = 0;
+  BTOR_AIG_CNF_POL (amgr, aig) = 0;
 }
 
 static void
@@ -120,179 +129,123 @@ delete_aig_node (BtorAIGMgr *amgr, BtorAIG *aig)
   assert (!BTOR_IS_INVERTED_AIG (aig));
   assert (amgr);
   if (btor_aig_is_const (aig)) return;
-  if (aig->cnf_id) release_cnf_id_aig_mgr (amgr, aig);
+  if (BTOR_AIG_CNF_ID (amgr, aig)) release_cnf_id_aig_mgr (amgr, aig);
   amgr->id2aig.start[aig->id] = 0;
   if (aig->is_var)
-  {
     amgr->cur_num_aig_vars--;
-    BTOR_DELETE (amgr->btor->mm, aig);
-  }
   else
-  {
     amgr->cur_num_aigs--;
-    btor_mem_free (
-        amgr->btor->mm, aig, sizeof (BtorAIG) + 2 * sizeof (int32_t));
-  }
+  BTOR_SLAB_DELETE (amgr->btor->mm, aig);
 }
 
 static uint32_t
-hash_aig (int32_t id0, int32_t id1, uint32_t table_size)
+hash_aig (int32_t id0, int32_t id1)
 {
   uint32_t hash;
-  assert (table_size > 0);
-  assert (btor_util_is_power_of_2 (table_size));
-  hash = 547789289u * (uint32_t) abs (id0);
-  hash += 786695309u * (uint32_t) abs (id1);
+  hash = 547789289u * (uint32_t) id0;
+  hash += 786695309u * (uint32_t) id1;
   hash *= BTOR_AIG_UNIQUE_TABLE_PRIME;
-  hash &= table_size - 1;
   return hash;
 }
 
 static uint32_t
-compute_aig_hash (BtorAIG *aig, uint32_t table_size)
+compute_aig_hash (BtorAIGMgr *amgr, int32_t id)
 {
-  uint32_t hash;
-  assert (!BTOR_IS_INVERTED_AIG (aig));
-  assert (btor_aig_is_and (aig));
-  hash = hash_aig (aig->children[0], aig->children[1], table_size);
-  return hash;
+  assert (id > 0);
+  return hash_aig (amgr->children.start[2 * (size_t) id],
+                   amgr->children.start[2 * (size_t) id + 1]);
 }
 
 static void
 delete_aig_nodes_unique_table_entry (BtorAIGMgr *amgr, BtorAIG *aig)
 {
-  uint32_t hash;
-  BtorAIG *cur, *prev;
   assert (amgr);
   assert (!BTOR_IS_INVERTED_AIG (aig));
   assert (btor_aig_is_and (aig));
-  prev = 0;
-  hash = compute_aig_hash (aig, amgr->table.size);
-  cur  = btor_aig_get_by_id (amgr, amgr->table.chains[hash]);
-  while (cur != aig)
-  {
-    assert (!BTOR_IS_INVERTED_AIG (cur));
-    prev = cur;
-    cur  = btor_aig_get_by_id (amgr, cur->next);
-  }
-  assert (cur);
-  if (!prev)
-    amgr->table.chains[hash] = cur->next;
-  else
-    prev->next = cur->next;
-  amgr->table.num_elements--;
+  btor_uniquetable_remove (
+      &amgr->table, aig->id, compute_aig_hash (amgr, aig->id));
 }
 
 static void
-inc_aig_ref_counter (BtorAIG *aig)
+inc_aig_ref_counter (BtorAIGMgr *amgr, BtorAIG *aig)
 {
   if (!btor_aig_is_const (aig))
   {
-    BTOR_ABORT (BTOR_REAL_ADDR_AIG (aig)->refs == UINT32_MAX,
+    BTOR_ABORT (BTOR_AIG_REFS (amgr, aig) == UINT32_MAX,
                 "reference counter overflow");
-    BTOR_REAL_ADDR_AIG (aig)->refs++;
+    BTOR_AIG_REFS (amgr, aig)++;
   }
 }
 
 static BtorAIG *
-inc_aig_ref_counter_and_return (BtorAIG *aig)
+inc_aig_ref_counter_and_return (BtorAIGMgr *amgr, BtorAIG *aig)
 {
-  inc_aig_ref_counter (aig);
+  inc_aig_ref_counter (amgr, aig);
   return aig;
 }
 
-static int32_t *
+struct BtorFindAndAIG
+{
+  BtorAIGMgr *amgr;
+  int32_t lid, rid;
+};
+
+typedef struct BtorFindAndAIG BtorFindAndAIG;
+
+static bool
+equal_and_aig (void *state, int32_t id)
+{
+  BtorFindAndAIG *key     = state;
+  const int32_t *children = key->amgr->children.start;
+
+  assert (btor_aig_is_and (BTOR_PEEK_STACK (key->amgr->id2aig, id)));
+  assert (btor_opt_get (key->amgr->btor, BTOR_OPT_SORT_AIG) == 0
+          || children[2 * (size_t) id] != key->rid
+          || children[2 * (size_t) id + 1] != key->lid
+          || key->lid == key->rid);
+  return children[2 * (size_t) id] == key->lid
+         && children[2 * (size_t) id + 1] == key->rid;
+}
+
+/* Find AND AIG with given children in the unique table, returns its id and 0
+ * if there is no such AIG.  Only the id-indexed arrays of the manager are
+ * accessed. */
+static int32_t
 find_and_aig (BtorAIGMgr *amgr, BtorAIG *left, BtorAIG *right)
 {
   assert (amgr);
   assert (!btor_aig_is_const (left));
   assert (!btor_aig_is_const (right));
 
-  BtorAIG *cur;
-  uint32_t hash;
-  int32_t *result;
+  BtorFindAndAIG key;
 
+  key.amgr = amgr;
+  key.lid  = btor_aig_get_id (left);
+  key.rid  = btor_aig_get_id (right);
   if (btor_opt_get (amgr->btor, BTOR_OPT_SORT_AIG) > 0
-      && BTOR_REAL_ADDR_AIG (right)->id < BTOR_REAL_ADDR_AIG (left)->id)
+      && abs (key.rid) < abs (key.lid))
   {
-    BTOR_SWAP (BtorAIG *, left, right);
+    BTOR_SWAP (int32_t, key.lid, key.rid);
   }
 
-  hash   = hash_aig (BTOR_REAL_ADDR_AIG (left)->id,
-                   BTOR_REAL_ADDR_AIG (right)->id,
-                   amgr->table.size);
-  result = amgr->table.chains + hash;
-  cur    = btor_aig_get_by_id (amgr, *result);
-  while (cur)
-  {
-    assert (!BTOR_IS_INVERTED_AIG (cur));
-    assert (btor_aig_is_and (cur));
-    if (btor_aig_get_left_child (amgr, cur) == left
-        && btor_aig_get_right_child (amgr, cur) == right)
-      break;
-#ifndef NDEBUG
-    if (btor_opt_get (amgr->btor, BTOR_OPT_SORT_AIG) > 0)
-      assert (btor_aig_get_left_child (amgr, cur) != right
-              || btor_aig_get_right_child (amgr, cur) != left);
-#endif
-    result = &cur->next;
-    cur    = cur->next == 0 ? 0 : btor_aig_get_by_id (amgr, cur->next);
-  }
-  return result;
+  return btor_uniquetable_find (
+      &amgr->table, hash_aig (key.lid, key.rid), equal_and_aig, &key);
 }
 
 static BtorAIG *
 find_and_aig_node (BtorAIGMgr *amgr, BtorAIG *left, BtorAIG *right)
 {
-  int32_t *lookup;
-  BtorAIG *res;
-  lookup = find_and_aig (amgr, left, right);
-  assert (lookup);
-  res = *lookup ? btor_aig_get_by_id (amgr, *lookup) : 0;
-  return res;
-}
-
-static void
-enlarge_aig_nodes_unique_table (BtorAIGMgr *amgr)
-{
-  BtorMemMgr *mm;
-  int32_t *new_chains;
-  uint32_t i, size, new_size;
-  uint32_t hash;
-  BtorAIG *temp = 0;
-  BtorAIG *cur  = 0;
-  assert (amgr);
-  size     = amgr->table.size;
-  new_size = size << 1;
-  assert (new_size / size == 2);
-  mm = amgr->btor->mm;
-  BTOR_CNEWN (mm, new_chains, new_size);
-  for (i = 0; i < size; i++)
-  {
-    cur = btor_aig_get_by_id (amgr, amgr->table.chains[i]);
-    while (cur)
-    {
-      assert (!BTOR_IS_INVERTED_AIG (cur));
-      assert (btor_aig_is_and (cur));
-      temp             = btor_aig_get_by_id (amgr, cur->next);
-      hash             = compute_aig_hash (cur, new_size);
-      cur->next        = new_chains[hash];
-      new_chains[hash] = cur->id;
-      cur              = temp;
-    }
-  }
-  BTOR_RELEASE_AIG_UNIQUE_TABLE (mm, amgr->table);
-  amgr->table.size   = new_size;
-  amgr->table.chains = new_chains;
+  int32_t id;
+  id = find_and_aig (amgr, left, right);
+  return id ? btor_aig_get_by_id (amgr, id) : 0;
 }
 
 BtorAIG *
 btor_aig_copy (BtorAIGMgr *amgr, BtorAIG *aig)
 {
   assert (amgr);
-  (void) amgr;
   if (btor_aig_is_const (aig)) return aig;
-  return inc_aig_ref_counter_and_return (aig);
+  return inc_aig_ref_counter_and_return (amgr, aig);
 }
 
 void
@@ -308,14 +261,14 @@ btor_aig_release (BtorAIGMgr *amgr, BtorAIG *aig)
   if (!btor_aig_is_const (aig))
   {
     cur = BTOR_REAL_ADDR_AIG (aig);
-    assert (cur->refs > 0u);
-    if (cur->refs > 1u)
+    assert (BTOR_AIG_REFS (amgr, cur) > 0u);
+    if (BTOR_AIG_REFS (amgr, cur) > 1u)
     {
-      cur->refs--;
+      BTOR_AIG_REFS (amgr, cur)--;
     }
     else
     {
-      assert (cur->refs == 1u);
+      assert (BTOR_AIG_REFS (amgr, cur) == 1u);
       BTOR_INIT_STACK (mm, stack);
       goto BTOR_RELEASE_AIG_WITHOUT_POP;
 
@@ -324,14 +277,14 @@ btor_aig_release (BtorAIGMgr *amgr, BtorAIG *aig)
         cur = BTOR_POP_STACK (stack);
         cur = BTOR_REAL_ADDR_AIG (cur);
 
-        if (cur->refs > 1u)
+        if (BTOR_AIG_REFS (amgr, cur) > 1u)
         {
-          cur->refs--;
+          BTOR_AIG_REFS (amgr, cur)--;
         }
         else
         {
         BTOR_RELEASE_AIG_WITHOUT_POP:
-          assert (cur->refs == 1u);
+          assert (BTOR_AIG_REFS (amgr, cur) == 1u);
           if (!btor_aig_is_var (cur))
           {
             assert (btor_aig_is_and (cur));
@@ -355,7 +308,7 @@ btor_aig_var (BtorAIGMgr *amgr)
 {
   BtorAIG *aig;
   assert (amgr);
-  BTOR_CNEW (amgr->btor->mm, aig);
+  BTOR_SLAB_CNEW (amgr->btor->mm, aig);
   setup_aig_and_add_to_id_table (amgr, aig);
   aig->is_var = 1;
   amgr->cur_num_aig_vars++;
@@ -368,8 +321,7 @@ BtorAIG *
 btor_aig_not (BtorAIGMgr *amgr, BtorAIG *aig)
 {
   assert (amgr);
-  (void) amgr;
-  inc_aig_ref_counter (aig);
+  inc_aig_ref_counter (amgr, aig);
   return BTOR_INVERT_AIG (aig);
 }
 
@@ -412,7 +364,7 @@ simp_aig_by_sat (BtorAIGMgr *amgr, BtorAIG *aig)
    * (returns 0) FIXME why? */
   if (btor_aig_is_const (aig)) return aig;
 
-  lit = btor_aig_get_cnf_id (aig);
+  lit = btor_aig_get_cnf_id (amgr, aig);
   if (!lit) return aig;
   val = btor_sat_fixed (amgr->smgr, lit);
   if (val) return (val < 0) ? BTOR_AIG_FALSE : BTOR_AIG_TRUE;
@@ -430,7 +382,6 @@ BtorAIG *
 btor_aig_and (BtorAIGMgr *amgr, BtorAIG *left, BtorAIG *right)
 {
   BtorAIG *res, *real_left, *real_right;
-  int32_t *lookup;
   uint32_t calls;
 
   assert (amgr);
@@ -446,10 +397,11 @@ btor_aig_and (BtorAIGMgr *amgr, BtorAIG *left, BtorAIG *right)
 BTOR_AIG_TWO_LEVEL_OPT_TRY_AGAIN:
   if (left == BTOR_AIG_FALSE || right == BTOR_AIG_FALSE) return BTOR_AIG_FALSE;
 
-  if (left == BTOR_AIG_TRUE) return inc_aig_ref_counter_and_return (right);
+  if (left == BTOR_AIG_TRUE)
+    return inc_aig_ref_counter_and_return (amgr, right);
 
   if (right == BTOR_AIG_TRUE || (left == right))
-    return inc_aig_ref_counter_and_return (left);
+    return inc_aig_ref_counter_and_return (amgr, left);
   if (left == BTOR_INVERT_AIG (right)) return BTOR_AIG_FALSE;
 
   real_left  = BTOR_REAL_ADDR_AIG (left);
@@ -492,7 +444,7 @@ BTOR_AIG_TWO_LEVEL_OPT_TRY_AGAIN:
     if (btor_aig_get_left_child (amgr, real_left) == BTOR_INVERT_AIG (right)
         || btor_aig_get_right_child (amgr, real_left)
                == BTOR_INVERT_AIG (right))
-      return inc_aig_ref_counter_and_return (right);
+      return inc_aig_ref_counter_and_return (amgr, right);
   }
   /* use commutativity */
   if (btor_aig_is_and (real_right) && BTOR_IS_INVERTED_AIG (right))
@@ -500,7 +452,7 @@ BTOR_AIG_TWO_LEVEL_OPT_TRY_AGAIN:
     if (btor_aig_get_left_child (amgr, real_right) == BTOR_INVERT_AIG (left)
         || btor_aig_get_right_child (amgr, real_right)
                == BTOR_INVERT_AIG (left))
-      return inc_aig_ref_counter_and_return (left);
+      return inc_aig_ref_counter_and_return (amgr, left);
   }
   /* second rule of subsumption */
   if (btor_aig_is_and (real_right) && btor_aig_is_and (real_left)
@@ -514,7 +466,7 @@ BTOR_AIG_TWO_LEVEL_OPT_TRY_AGAIN:
                == BTOR_INVERT_AIG (btor_aig_get_left_child (amgr, real_right))
         || btor_aig_get_right_child (amgr, real_left)
                == BTOR_INVERT_AIG (btor_aig_get_right_child (amgr, real_right)))
-      return inc_aig_ref_counter_and_return (right);
+      return inc_aig_ref_counter_and_return (amgr, right);
   }
   /* use commutativity */
   if (btor_aig_is_and (real_right) && btor_aig_is_and (real_left)
@@ -528,7 +480,7 @@ BTOR_AIG_TWO_LEVEL_OPT_TRY_AGAIN:
                == BTOR_INVERT_AIG (btor_aig_get_left_child (amgr, real_right))
         || btor_aig_get_right_child (amgr, real_left)
                == BTOR_INVERT_AIG (btor_aig_get_right_child (amgr, real_right)))
-      return inc_aig_ref_counter_and_return (left);
+      return inc_aig_ref_counter_and_return (amgr, left);
   }
   /* rule of resolution */
   if (btor_aig_is_and (real_right) && btor_aig_is_and (real_left)
@@ -545,6 +497,7 @@ BTOR_AIG_TWO_LEVEL_OPT_TRY_AGAIN:
                    == BTOR_INVERT_AIG (
                           btor_aig_get_left_child (amgr, real_right))))
       return inc_aig_ref_counter_and_return (
+          amgr,
           BTOR_INVERT_AIG (btor_aig_get_left_child (amgr, real_left)));
   }
   /* use commutativity */
@@ -561,6 +514,7 @@ BTOR_AIG_TWO_LEVEL_OPT_TRY_AGAIN:
                    == BTOR_INVERT_AIG (
                           btor_aig_get_right_child (amgr, real_left))))
       return inc_aig_ref_counter_and_return (
+          amgr,
           BTOR_INVERT_AIG (btor_aig_get_right_child (amgr, real_right)));
   }
   /* asymmetric rule of idempotency */
@@ -568,14 +522,14 @@ BTOR_AIG_TWO_LEVEL_OPT_TRY_AGAIN:
   {
     if (btor_aig_get_left_child (amgr, real_left) == right
         || btor_aig_get_right_child (amgr, real_left) == right)
-      return inc_aig_ref_counter_and_return (left);
+      return inc_aig_ref_counter_and_return (amgr, left);
   }
   /* use commutativity */
   if (btor_aig_is_and (real_right) && !BTOR_IS_INVERTED_AIG (right))
   {
     if (btor_aig_get_left_child (amgr, real_right) == left
         || btor_aig_get_right_child (amgr, real_right) == left)
-      return inc_aig_ref_counter_and_return (right);
+      return inc_aig_ref_counter_and_return (amgr, right);
   }
   /* symmetric rule of idempotency */
   if (btor_aig_is_and (real_right) && btor_aig_is_and (real_left)
@@ -703,7 +657,7 @@ BTOR_AIG_TWO_LEVEL_OPT_TRY_AGAIN:
             find_and_aig_node (amgr, BTOR_INVERT_AIG (l), BTOR_INVERT_AIG (r));
         if (res)
         {
-          inc_aig_ref_counter (res);
+          inc_aig_ref_counter (amgr, res);
           return BTOR_INVERT_AIG (res);
         }
       }
@@ -712,32 +666,23 @@ BTOR_AIG_TWO_LEVEL_OPT_TRY_AGAIN:
 
   // TODO Implicit ITE normalization ....
 
-  lookup = find_and_aig (amgr, left, right);
-  assert (lookup);
-  res = *lookup ? btor_aig_get_by_id (amgr, *lookup) : 0;
+  res = find_and_aig_node (amgr, left, right);
   if (!res)
   {
-    if (amgr->table.num_elements == amgr->table.size
-        && btor_util_log_2 (amgr->table.size) < BTOR_AIG_UNIQUE_TABLE_LIMIT)
-    {
-      enlarge_aig_nodes_unique_table (amgr);
-      lookup = find_and_aig (amgr, left, right);
-    }
     if (btor_opt_get (amgr->btor, BTOR_OPT_SORT_AIG) > 0
         && real_right->id < real_left->id)
     {
       BTOR_SWAP (BtorAIG *, left, right);
     }
-    res     = new_and_aig (amgr, left, right);
-    *lookup = res->id;
-    inc_aig_ref_counter (left);
-    inc_aig_ref_counter (right);
-    assert (amgr->table.num_elements < INT32_MAX);
-    amgr->table.num_elements++;
+    res = new_and_aig (amgr, left, right);
+    btor_uniquetable_insert (
+        &amgr->table, res->id, compute_aig_hash (amgr, res->id));
+    inc_aig_ref_counter (amgr, left);
+    inc_aig_ref_counter (amgr, right);
   }
   else
   {
-    inc_aig_ref_counter (res);
+    inc_aig_ref_counter (amgr, res);
   }
   return res;
 }
@@ -791,11 +736,15 @@ btor_aig_mgr_new (Btor *btor)
 
   BTOR_CNEW (btor->mm, amgr);
   amgr->btor = btor;
-  BTOR_INIT_AIG_UNIQUE_TABLE (btor->mm, amgr->table);
+  btor_uniquetable_init (btor->mm, &amgr->table);
   amgr->smgr = btor_sat_mgr_new (btor);
   BTOR_INIT_STACK (btor->mm, amgr->id2aig);
-  BTOR_PUSH_STACK (amgr->id2aig, BTOR_AIG_FALSE);
-  BTOR_PUSH_STACK (amgr->id2aig, BTOR_AIG_TRUE);
+  BTOR_INIT_STACK (btor->mm, amgr->children);
+  BTOR_INIT_STACK (btor->mm, amgr->cnf_ids);
+  BTOR_INIT_STACK (btor->mm, amgr->cnf_pols);
+  BTOR_INIT_STACK (btor->mm, amgr->refs);
+  push_aig_data (amgr, BTOR_AIG_FALSE);
+  push_aig_data (amgr, BTOR_AIG_TRUE);
   assert ((size_t) BTOR_AIG_FALSE == 0);
   assert ((size_t) BTOR_AIG_TRUE == 1);
   BTOR_INIT_STACK (btor->mm, amgr->cnfid2aig);
@@ -807,21 +756,34 @@ clone_aig (BtorMemMgr *mm, BtorAIG *aig)
 {
   assert (mm);
 
-  size_t size;
-  BtorAIG *res, *real_aig;
+  BtorAIG *res;
 
   if (btor_aig_is_const (aig)) return aig;
 
-  real_aig = BTOR_REAL_ADDR_AIG (aig);
-  size     = sizeof (BtorAIG);
-  if (!real_aig->is_var) size += 2 * sizeof (int32_t);
-  res = btor_mem_malloc (mm, size);
-  memcpy (res, real_aig, size);
+  res = btor_mem_slab_malloc (mm, sizeof (BtorAIG));
+  memcpy (res, BTOR_REAL_ADDR_AIG (aig), sizeof (BtorAIG));
 
   res = BTOR_IS_INVERTED_AIG (aig) ? BTOR_INVERT_AIG (res) : res;
   return res;
 }
 
+#define BTOR_CLONE_AIG_DATA_STACK(mm, stack, clone_stack)                 \
+  do                                                                      \
+  {                                                                       \
+    size_t size;                                                          \
+    BTOR_INIT_STACK (mm, clone_stack);                                    \
+    size = BTOR_SIZE_STACK (stack);                                       \
+    if (size)                                                             \
+    {                                                                     \
+      BTOR_NEWN (mm, (clone_stack).start, size);                          \
+      (clone_stack).end = (clone_stack).start + size;                     \
+      (clone_stack).top = (clone_stack).start + BTOR_COUNT_STACK (stack); \
+      memcpy ((clone_stack).start,                                        \
+              (stack).start,                                              \
+              BTOR_COUNT_STACK (stack) * sizeof (*(stack).start));        \
+    }                                                                     \
+  } while (0)
+
 static void
 clone_aigs (BtorAIGMgr *amgr, BtorAIGMgr *clone)
 {
@@ -850,13 +812,14 @@ clone_aigs (BtorAIGMgr *amgr, BtorAIGMgr *clone)
     BTOR_POKE_STACK (clone->id2aig, i, aig);
   }
 
+  /* clone AIG data indexed by id */
+  BTOR_CLONE_AIG_DATA_STACK (mm, amgr->children, clone->children);
+  BTOR_CLONE_AIG_DATA_STACK (mm, amgr->cnf_ids, clone->cnf_ids);
+  BTOR_CLONE_AIG_DATA_STACK (mm, amgr->cnf_pols, clone->cnf_pols);
+  BTOR_CLONE_AIG_DATA_STACK (mm, amgr->refs, clone->refs);
+
   /* clone unique table */
-  BTOR_CNEWN (mm, clone->table.chains, amgr->table.size);
-  clone->table.size         = amgr->table.size;
-  clone->table.num_elements = amgr->table.num_elements;
-  memcpy (clone->table.chains,
-          amgr->table.chains,
-          amgr->table.size * sizeof (int32_t));
+  btor_uniquetable_clone (mm, &amgr->table, &clone->table);
 
   /* clone cnfid2aig table */
   BTOR_INIT_STACK (mm, clone->cnfid2aig);
@@ -896,6 +859,10 @@ btor_aig_mgr_clone (Btor *btor, BtorAIGMgr *amgr)
   res->num_cnf_vars     = amgr->num_cnf_vars;
   res->num_cnf_clauses  = amgr->num_cnf_clauses;
   res->num_cnf_literals = amgr->num_cnf_literals;
+  res->num_sweep_checks = amgr->num_sweep_checks;
+  res->num_sweep_merged = amgr->num_sweep_merged;
+  res->num_cut_rewrites = amgr->num_cut_rewrites;
+  res->num_cut_removed  = amgr->num_cut_removed;
   clone_aigs (amgr, res);
   return res;
 }
@@ -908,9 +875,14 @@ btor_aig_mgr_delete (BtorAIGMgr *amgr)
   assert (getenv ("BTORLEAK") || getenv ("BTORLEAKAIG")
           || amgr->table.num_elements == 0);
   mm = amgr->btor->mm;
-  BTOR_RELEASE_AIG_UNIQUE_TABLE (mm, amgr->table);
+  btor_uniquetable_release (&amgr->table);
   btor_sat_mgr_delete (amgr->smgr);
   BTOR_RELEASE_STACK (amgr->id2aig);
+  BTOR_RELEASE_STACK (amgr->children);
+  BTOR_RELEASE_STACK (amgr->cnf_ids);
+  BTOR_RELEASE_STACK (amgr->cnf_pols);
+  BTOR_RELEASE_STACK (amgr->refs);
+  if (amgr->eval_cache) btor_hashint_map_delete (amgr->eval_cache);
   BTOR_RELEASE_STACK (amgr->cnfid2aig);
   BTOR_DELETE (mm, amgr);
 }
@@ -928,14 +900,14 @@ is_xor_aig (BtorAIGMgr *amgr, BtorAIG *aig, BtorAIGPtrStack *leafs)
   if (!BTOR_IS_INVERTED_AIG (l)) return false;
   l = BTOR_REAL_ADDR_AIG (l);
 #ifdef BTOR_AIG_TO_CNF_EXTRACT_ONLY_NON_SHARED
-  if (l->refs > 1) return false;
+  if (BTOR_AIG_REFS (amgr, l) > 1) return false;
 #endif
 
   r = btor_aig_get_right_child (amgr, aig);
   if (!BTOR_IS_INVERTED_AIG (r)) return false;
   r = BTOR_REAL_ADDR_AIG (r);
 #ifdef BTOR_AIG_TO_CNF_EXTRACT_ONLY_NON_SHARED
-  if (r->refs > 1) return false;
+  if (BTOR_AIG_REFS (amgr, r) > 1) return false;
 #endif
 
   ll = btor_aig_get_left_child (amgr, l);
@@ -976,14 +948,14 @@ is_ite_aig (BtorAIGMgr *amgr, BtorAIG *aig, BtorAIGPtrStack *leafs)
   if (!BTOR_IS_INVERTED_AIG (l)) return false;
   l = BTOR_REAL_ADDR_AIG (l);
 #ifdef BTOR_AIG_TO_CNF_EXTRACT_ONLY_NON_SHARED
-  if (l->refs > 1) return false;
+  if (BTOR_AIG_REFS (amgr, l) > 1) return false;
 #endif
 
   r = btor_aig_get_right_child (amgr, aig);
   if (!BTOR_IS_INVERTED_AIG (r)) return false;
   r = BTOR_REAL_ADDR_AIG (r);
 #ifdef BTOR_AIG_TO_CNF_EXTRACT_ONLY_NON_SHARED
-  if (r->refs > 1) return false;
+  if (BTOR_AIG_REFS (amgr, r) > 1) return false;
 #endif
 
   ll = btor_aig_get_left_child (amgr, l);
@@ -1040,12 +1012,16 @@ static void
 set_next_id_aig_mgr (BtorAIGMgr *amgr, BtorAIG *root)
 {
   assert (!BTOR_IS_INVERTED_AIG (root));
-  assert (!root->cnf_id);
-  root->cnf_id = btor_sat_mgr_next_cnf_id (amgr->smgr);
-  assert (root->cnf_id > 0);
-  BTOR_FIT_STACK (amgr->cnfid2aig, (size_t) root->cnf_id);
-  amgr->cnfid2aig.start[root->cnf_id] = root->id;
-  assert (amgr->cnfid2aig.start[root->cnf_id] == root->id);
+
+  int32_t cnf_id;
+
+  assert (!BTOR_AIG_CNF_ID (amgr, root));
+  cnf_id = btor_sat_mgr_next_cnf_id (amgr->smgr);
+  assert (cnf_id > 0);
+  BTOR_AIG_CNF_ID (amgr, root) = cnf_id;
+  BTOR_FIT_STACK (amgr->cnfid2aig, (size_t) cnf_id);
+  amgr->cnfid2aig.start[cnf_id] = root->id;
+  assert (amgr->cnfid2aig.start[cnf_id] == root->id);
   amgr->num_cnf_vars++;
 }
 
@@ -1110,12 +1086,171 @@ is_or_aig (BtorAIGMgr *amgr, BtorAIG *root, BtorAIGPtrStack *leafs)
 }
 #endif
 
+static void
+add_clause_aig_mgr (BtorAIGMgr *amgr, int32_t a, int32_t b, int32_t c)
+{
+  btor_sat_add (amgr->smgr, a);
+  btor_sat_add (amgr->smgr, b);
+  amgr->num_cnf_literals += 2;
+  if (c)
+  {
+    btor_sat_add (amgr->smgr, c);
+    amgr->num_cnf_literals += 1;
+  }
+  btor_sat_add (amgr->smgr, 0);
+  amgr->num_cnf_clauses += 1;
+}
+
+/* Plaisted-Greenbaum encoding: encode 'start' in polarities 'pol' into CNF,
+ * i.e., only add the clauses required for the given polarities.  Children
+ * of AND and ITE gates inherit the polarities of the gate (flipped for
+ * inverted edges), XOR inputs and ITE conditions are encoded in both
+ * polarities.  Clauses of polarities that have already been encoded are not
+ * added again, hence AIGs that are encoded in one polarity can later be
+ * extended to both polarities. */
+static void
+aig_to_sat_pol (BtorAIGMgr *amgr, BtorAIG *start, uint8_t pol)
+{
+  assert (amgr);
+  assert (pol > 0 && pol <= BTOR_AIG_POL_BOTH);
+
+  BtorAIGPtrStack stack, leafs;
+  BtorCharStack pols;
+  BtorAIG *cur, *real_cur, *leaf, **p;
+  BtorMemMgr *mm;
+  int32_t x, a, b, c;
+  uint8_t cur_pol, missing, leaf_pol;
+  bool isxor, isite, opt_xor_ite;
+
+  if (btor_aig_is_const (start)) return;
+
+  mm          = amgr->btor->mm;
+  opt_xor_ite = btor_opt_get (amgr->btor, BTOR_OPT_CNF_XOR_ITE) != 0;
+
+  BTOR_INIT_STACK (mm, stack);
+  BTOR_INIT_STACK (mm, pols);
+  BTOR_INIT_STACK (mm, leafs);
+
+  BTOR_PUSH_STACK (stack, start);
+  BTOR_PUSH_STACK (pols, pol);
+
+  while (!BTOR_EMPTY_STACK (stack))
+  {
+    cur      = BTOR_POP_STACK (stack);
+    cur_pol  = BTOR_POP_STACK (pols);
+    real_cur = BTOR_REAL_ADDR_AIG (cur);
+    assert (!btor_aig_is_const (real_cur));
+
+    /* an inverted edge flips the polarity */
+    if (BTOR_IS_INVERTED_AIG (cur))
+      cur_pol = ((cur_pol & BTOR_AIG_POL_POS) ? BTOR_AIG_POL_NEG : 0)
+                | ((cur_pol & BTOR_AIG_POL_NEG) ? BTOR_AIG_POL_POS : 0);
+
+    if (!BTOR_AIG_CNF_ID (amgr, real_cur)) set_next_id_aig_mgr (amgr, real_cur);
+
+    if (btor_aig_is_var (real_cur))
+    {
+      BTOR_AIG_CNF_POL (amgr, real_cur) = BTOR_AIG_POL_BOTH;
+      continue;
+    }
+
+    missing = cur_pol & ~BTOR_AIG_CNF_POL (amgr, real_cur);
+    if (!missing) continue;
+    BTOR_AIG_CNF_POL (amgr, real_cur) |= missing;
+
+    assert (BTOR_EMPTY_STACK (leafs));
+    if (!opt_xor_ite)
+      isxor = isite = false;
+    else if ((isxor = is_xor_aig (amgr, real_cur, &leafs)))
+      isite = false;
+    else
+      isite = is_ite_aig (amgr, real_cur, &leafs);
+    if (!isxor && !isite)
+    {
+      BTOR_PUSH_STACK (leafs, btor_aig_get_left_child (amgr, real_cur));
+      BTOR_PUSH_STACK (leafs, btor_aig_get_right_child (amgr, real_cur));
+    }
+
+    for (p = leafs.start; p < leafs.top; p++)
+    {
+      leaf = BTOR_REAL_ADDR_AIG (*p);
+      if (!btor_aig_is_const (leaf) && !BTOR_AIG_CNF_ID (amgr, leaf))
+        set_next_id_aig_mgr (amgr, leaf);
+    }
+
+    x = BTOR_AIG_CNF_ID (amgr, real_cur);
+    if (isxor)
+    {
+      /* x <-> (a <-> b) */
+      assert (BTOR_COUNT_STACK (leafs) == 2);
+      a = btor_aig_get_cnf_id (amgr, leafs.start[0]);
+      b = btor_aig_get_cnf_id (amgr, leafs.start[1]);
+      if (missing & BTOR_AIG_POL_POS)
+      {
+        add_clause_aig_mgr (amgr, -x, a, -b);
+        add_clause_aig_mgr (amgr, -x, -a, b);
+      }
+      if (missing & BTOR_AIG_POL_NEG)
+      {
+        add_clause_aig_mgr (amgr, x, -a, -b);
+        add_clause_aig_mgr (amgr, x, a, b);
+      }
+    }
+    else if (isite)
+    {
+      /* x <-> (c ? b : a) */
+      assert (BTOR_COUNT_STACK (leafs) == 3);
+      a = btor_aig_get_cnf_id (amgr, leafs.start[0]);
+      b = btor_aig_get_cnf_id (amgr, leafs.start[1]);
+      c = btor_aig_get_cnf_id (amgr, leafs.start[2]);
+      if (missing & BTOR_AIG_POL_POS)
+      {
+        add_clause_aig_mgr (amgr, -x, -c, b);
+        add_clause_aig_mgr (amgr, -x, c, a);
+      }
+      if (missing & BTOR_AIG_POL_NEG)
+      {
+        add_clause_aig_mgr (amgr, x, -c, -b);
+        add_clause_aig_mgr (amgr, x, c, -a);
+      }
+    }
+    else
+    {
+      /* x <-> (a & b) */
+      a = btor_aig_get_cnf_id (amgr, leafs.start[0]);
+      b = btor_aig_get_cnf_id (amgr, leafs.start[1]);
+      if (missing & BTOR_AIG_POL_POS)
+      {
+        add_clause_aig_mgr (amgr, -x, a, 0);
+        add_clause_aig_mgr (amgr, -x, b, 0);
+      }
+      if (missing & BTOR_AIG_POL_NEG) add_clause_aig_mgr (amgr, x, -a, -b);
+    }
+
+    for (p = leafs.start; p < leafs.top; p++)
+    {
+      leaf = *p;
+      if (btor_aig_is_const (leaf)) continue;
+      /* XOR inputs and ITE conditions occur in both polarities */
+      leaf_pol = isxor || (isite && p == leafs.start + 2) ? BTOR_AIG_POL_BOTH
+                                                          : missing;
+      BTOR_PUSH_STACK (stack, leaf);
+      BTOR_PUSH_STACK (pols, leaf_pol);
+    }
+    BTOR_RESET_STACK (leafs);
+  }
+
+  BTOR_RELEASE_STACK (leafs);
+  BTOR_RELEASE_STACK (pols);
+  BTOR_RELEASE_STACK (stack);
+}
+
 void
 btor_aig_to_sat_tseitin (BtorAIGMgr *amgr, BtorAIG *start)
 {
   BtorAIGPtrStack stack, tree, leafs, marked;
   int32_t x, y, a, b, c;
-  bool isxor, isite;
+  bool isxor, isite, opt_xor_ite;
   BtorAIG *root, *cur;
   BtorSATMgr *smgr;
   BtorMemMgr *mm;
@@ -1126,8 +1261,9 @@ btor_aig_to_sat_tseitin (BtorAIGMgr *amgr, BtorAIG *start)
 
   assert (amgr);
 
-  smgr = amgr->smgr;
-  mm   = amgr->btor->mm;
+  smgr        = amgr->smgr;
+  mm          = amgr->btor->mm;
+  opt_xor_ite = btor_opt_get (amgr->btor, BTOR_OPT_CNF_XOR_ITE) != 0;
 
   BTOR_INIT_STACK (mm, stack);
   BTOR_INIT_STACK (mm, tree);
@@ -1143,17 +1279,24 @@ btor_aig_to_sat_tseitin (BtorAIGMgr *amgr, BtorAIG *start)
 
     if (root->mark == 2)
     {
-      assert (root->cnf_id);
-      assert (root->local < root->refs);
+      assert (BTOR_AIG_CNF_ID (amgr, root));
+      assert (root->local < BTOR_AIG_REFS (amgr, root));
       root->local++;
       continue;
     }
 
-    if (root->cnf_id) continue;
+    if (BTOR_AIG_CNF_ID (amgr, root))
+    {
+      /* partially encoded via Plaisted-Greenbaum encoding */
+      if (BTOR_AIG_CNF_POL (amgr, root) != BTOR_AIG_POL_BOTH)
+        aig_to_sat_pol (amgr, root, BTOR_AIG_POL_BOTH);
+      continue;
+    }
 
     if (btor_aig_is_var (root))
     {
       set_next_id_aig_mgr (amgr, root);
+      BTOR_AIG_CNF_POL (amgr, root) = BTOR_AIG_POL_BOTH;
       continue;
     }
 
@@ -1162,8 +1305,10 @@ btor_aig_to_sat_tseitin (BtorAIGMgr *amgr, BtorAIG *start)
     assert (BTOR_EMPTY_STACK (tree));
     assert (BTOR_EMPTY_STACK (leafs));
 
-    if ((isxor = is_xor_aig (amgr, root, &leafs)))
-      isite = 0;
+    if (!opt_xor_ite)
+      isxor = isite = false;
+    else if ((isxor = is_xor_aig (amgr, root, &leafs)))
+      isite = false;
     else
       isite = is_ite_aig (amgr, root, &leafs);
 
@@ -1178,7 +1323,7 @@ btor_aig_to_sat_tseitin (BtorAIGMgr *amgr, BtorAIG *start)
         cur = BTOR_POP_STACK (tree);
 
         if (BTOR_IS_INVERTED_AIG (cur) || btor_aig_is_var (cur)
-            || cur->refs > 1u || cur->cnf_id)
+            || BTOR_AIG_REFS (amgr, cur) > 1u || BTOR_AIG_CNF_ID (amgr, cur))
         {
           BTOR_PUSH_STACK (leafs, cur);
         }
@@ -1197,7 +1342,7 @@ btor_aig_to_sat_tseitin (BtorAIGMgr *amgr, BtorAIG *start)
     if (root->mark == 0)
     {
       root->mark = 1;
-      assert (root->refs >= 1);
+      assert (BTOR_AIG_REFS (amgr, root) >= 1);
       assert (!root->local);
       root->local = 1;
       BTOR_PUSH_STACK (marked, root);
@@ -1210,14 +1355,15 @@ btor_aig_to_sat_tseitin (BtorAIGMgr *amgr, BtorAIG *start)
       root->mark = 2;
 
       set_next_id_aig_mgr (amgr, root);
-      x = root->cnf_id;
+      BTOR_AIG_CNF_POL (amgr, root) = BTOR_AIG_POL_BOTH;
+      x = BTOR_AIG_CNF_ID (amgr, root);
       assert (x);
 
       if (isxor)
       {
         assert (BTOR_COUNT_STACK (leafs) == 2);
-        a = btor_aig_get_cnf_id (leafs.start[0]);
-        b = btor_aig_get_cnf_id (leafs.start[1]);
+        a = btor_aig_get_cnf_id (amgr, leafs.start[0]);
+        b = btor_aig_get_cnf_id (amgr, leafs.start[1]);
 
         btor_sat_add (smgr, -x);
         btor_sat_add (smgr, a);
@@ -1244,9 +1390,9 @@ btor_aig_to_sat_tseitin (BtorAIGMgr *amgr, BtorAIG *start)
       else if (isite)
       {
         assert (BTOR_COUNT_STACK (leafs) == 3);
-        a = btor_aig_get_cnf_id (leafs.start[0]);  // else
-        b = btor_aig_get_cnf_id (leafs.start[1]);  // then
-        c = btor_aig_get_cnf_id (leafs.start[2]);  // cond
+        a = btor_aig_get_cnf_id (amgr, leafs.start[0]);  // else
+        b = btor_aig_get_cnf_id (amgr, leafs.start[1]);  // then
+        c = btor_aig_get_cnf_id (amgr, leafs.start[2]);  // cond
 
         btor_sat_add (smgr, -x);
         btor_sat_add (smgr, -c);
@@ -1275,7 +1421,7 @@ btor_aig_to_sat_tseitin (BtorAIGMgr *amgr, BtorAIG *start)
         for (p = leafs.start; p < leafs.top; p++)
         {
           cur = *p;
-          y   = btor_aig_get_cnf_id (cur);
+          y   = btor_aig_get_cnf_id (amgr, cur);
           assert (y);
           btor_sat_add (smgr, -y);
           amgr->num_cnf_literals++;
@@ -1288,7 +1434,7 @@ btor_aig_to_sat_tseitin (BtorAIGMgr *amgr, BtorAIG *start)
         for (p = leafs.start; p < leafs.top; p++)
         {
           cur = *p;
-          y   = btor_aig_get_cnf_id (cur);
+          y   = btor_aig_get_cnf_id (amgr, cur);
           btor_sat_add (smgr, -x);
           btor_sat_add (smgr, y);
           btor_sat_add (smgr, 0);
@@ -1309,14 +1455,14 @@ btor_aig_to_sat_tseitin (BtorAIGMgr *amgr, BtorAIG *start)
     assert (!BTOR_IS_INVERTED_AIG (cur));
     assert (cur->mark > 0);
     cur->mark = 0;
-    assert (cur->cnf_id);
+    assert (BTOR_AIG_CNF_ID (amgr, cur));
     assert (btor_aig_is_and (cur));
     local = cur->local;
     assert (local > 0);
     cur->local = 0;
     if (cur == start) continue;
-    assert (cur->refs >= local);
-    if (cur->refs > local) continue;
+    assert (BTOR_AIG_REFS (amgr, cur) >= local);
+    if (BTOR_AIG_REFS (amgr, cur) > local) continue;
     release_cnf_id_aig_mgr (amgr, cur);
   }
   BTOR_RELEASE_STACK (marked);
@@ -1338,7 +1484,11 @@ btor_aig_to_sat (BtorAIGMgr *amgr, BtorAIG *aig)
 {
   assert (amgr);
   if (!btor_sat_is_initialized (amgr->smgr)) return;
-  if (!btor_aig_is_const (aig)) aig_to_sat_tseitin (amgr, aig);
+  if (btor_aig_is_const (aig)) return;
+  if (btor_opt_get (amgr->btor, BTOR_OPT_CNF_ENC) == BTOR_CNF_ENC_PG)
+    aig_to_sat_pol (amgr, aig, BTOR_AIG_POL_BOTH);
+  else
+    aig_to_sat_tseitin (amgr, aig);
 }
 
 void
@@ -1405,8 +1555,9 @@ btor_aig_add_toplevel_to_sat (BtorAIGMgr *amgr, BtorAIG *root)
         for (p = leafs.start; p < leafs.top; p++)
         {
           left = *p;
-          assert (btor_aig_get_cnf_id (left));
-          btor_sat_add (smgr, btor_aig_get_cnf_id (BTOR_INVERT_AIG (left)));
+          assert (btor_aig_get_cnf_id (amgr, left));
+          btor_sat_add (smgr,
+                        btor_aig_get_cnf_id (amgr, BTOR_INVERT_AIG (left)));
           amgr->num_cnf_literals++;
         }
         btor_sat_add (smgr, 0);
@@ -1415,7 +1566,7 @@ btor_aig_add_toplevel_to_sat (BtorAIGMgr *amgr, BtorAIG *root)
       else
       {
         btor_aig_to_sat (amgr, aig);
-        btor_sat_add (smgr, btor_aig_get_cnf_id (aig));
+        btor_sat_add (smgr, btor_aig_get_cnf_id (amgr, aig));
         btor_sat_add (smgr, 0);
         amgr->num_cnf_literals++;
         amgr->num_cnf_clauses++;
@@ -1429,8 +1580,8 @@ btor_aig_add_toplevel_to_sat (BtorAIGMgr *amgr, BtorAIG *root)
         right = BTOR_INVERT_AIG (btor_aig_get_right_child (amgr, real_aig));
         btor_aig_to_sat (amgr, left);
         btor_aig_to_sat (amgr, right);
-        btor_sat_add (smgr, btor_aig_get_cnf_id (left));
-        btor_sat_add (smgr, btor_aig_get_cnf_id (right));
+        btor_sat_add (smgr, btor_aig_get_cnf_id (amgr, left));
+        btor_sat_add (smgr, btor_aig_get_cnf_id (amgr, right));
         btor_sat_add (smgr, 0);
         amgr->num_cnf_clauses++;
         amgr->num_cnf_literals += 2;
@@ -1438,7 +1589,7 @@ btor_aig_add_toplevel_to_sat (BtorAIGMgr *amgr, BtorAIG *root)
       else
       {
         btor_aig_to_sat (amgr, aig);
-        btor_sat_add (smgr, btor_aig_get_cnf_id (aig));
+        btor_sat_add (smgr, btor_aig_get_cnf_id (amgr, aig));
         btor_sat_add (smgr, 0);
         amgr->num_cnf_clauses++;
         amgr->num_cnf_literals++;
@@ -1455,8 +1606,11 @@ btor_aig_add_toplevel_to_sat (BtorAIGMgr *amgr, BtorAIG *root)
     btor_sat_add (amgr->smgr, 0);
     return;
   }
-  btor_aig_to_sat (amgr, root);
-  btor_sat_add (amgr->smgr, btor_aig_get_cnf_id (root));
+  if (btor_opt_get (amgr->btor, BTOR_OPT_CNF_ENC) == BTOR_CNF_ENC_PG)
+    aig_to_sat_pol (amgr, root, BTOR_AIG_POL_POS);
+  else
+    btor_aig_to_sat (amgr, root);
+  btor_sat_add (amgr->smgr, btor_aig_get_cnf_id (amgr, root));
   btor_sat_add (amgr->smgr, 0);
 #endif
 }
@@ -1467,24 +1621,166 @@ btor_aig_get_sat_mgr (const BtorAIGMgr *amgr)
   return amgr ? amgr->smgr : 0;
 }
 
-int32_t
-btor_aig_get_assignment (BtorAIGMgr *amgr, BtorAIG *aig)
+static int32_t
+get_sat_assignment (BtorAIGMgr *amgr, BtorAIG *aig)
 {
-  assert (amgr);
-  if (aig == BTOR_AIG_TRUE) return 1;
-  if (aig == BTOR_AIG_FALSE) return -1;
+  assert (BTOR_IS_REGULAR_AIG (aig));
 
   /* Note: If an AIG is not yet encoded to SAT or if the SAT solver returns
    * undefined for a variable, we implicitly initialize it with false (-1). */
   int32_t val = -1;
-  if (BTOR_REAL_ADDR_AIG (aig)->cnf_id > 0)
+  if (BTOR_AIG_CNF_ID (amgr, aig) > 0)
   {
-    val = btor_sat_deref (amgr->smgr, BTOR_REAL_ADDR_AIG (aig)->cnf_id);
+    val = btor_sat_deref (amgr->smgr, BTOR_AIG_CNF_ID (amgr, aig));
     if (val == 0)
     {
       val = -1;
     }
   }
+  return val;
+}
+
+/* Compute the assignment of an AND AIG that is not encoded in both
+ * polarities from the assignment of its children.  The SAT solver does not
+ * necessarily assign the value of the gate to its CNF id in this case (e.g.,
+ * for Plaisted-Greenbaum encoded gates). */
+static int32_t
+eval_aig (BtorAIGMgr *amgr, BtorAIG *aig)
+{
+  assert (BTOR_IS_REGULAR_AIG (aig));
+  assert (btor_aig_is_and (aig));
+
+  BtorAIGPtrStack stack;
+  BtorHashTableData *d;
+  BtorAIG *cur, *child, *real_child;
+  int32_t val, cval;
+  uint32_t i;
+  bool pushed;
+
+  if (!amgr->eval_cache || amgr->eval_satcalls != amgr->smgr->satcalls)
+  {
+    if (amgr->eval_cache) btor_hashint_map_delete (amgr->eval_cache);
+    amgr->eval_cache    = btor_hashint_map_new (amgr->btor->mm);
+    amgr->eval_satcalls = amgr->smgr->satcalls;
+  }
+
+  if ((d = btor_hashint_map_get (amgr->eval_cache, aig->id)))
+    return d->as_int;
+
+  BTOR_INIT_STACK (amgr->btor->mm, stack);
+  BTOR_PUSH_STACK (stack, aig);
+  while (!BTOR_EMPTY_STACK (stack))
+  {
+    cur = BTOR_TOP_STACK (stack);
+    if (btor_hashint_map_contains (amgr->eval_cache, cur->id))
+    {
+      (void) BTOR_POP_STACK (stack);
+      continue;
+    }
+    val    = 1;
+    pushed = false;
+    for (i = 0; i < 2; i++)
+    {
+      child      = i ? btor_aig_get_right_child (amgr, cur)
+                     : btor_aig_get_left_child (amgr, cur);
+      real_child = BTOR_REAL_ADDR_AIG (child);
+      if (btor_aig_is_var (real_child)
+          || btor_aig_is_encoded (amgr, real_child))
+        cval = get_sat_assignment (amgr, real_child);
+      else if ((d = btor_hashint_map_get (amgr->eval_cache, real_child->id)))
+        cval = d->as_int;
+      else
+      {
+        BTOR_PUSH_STACK (stack, real_child);
+        pushed = true;
+        continue;
+      }
+      if (BTOR_IS_INVERTED_AIG (child)) cval = -cval;
+      if (cval < 0) val = -1;
+    }
+    if (pushed) continue;
+    btor_hashint_map_add (amgr->eval_cache, cur->id)->as_int = val;
+    (void) BTOR_POP_STACK (stack);
+  }
+  BTOR_RELEASE_STACK (stack);
+
+  return btor_hashint_map_get (amgr->eval_cache, aig->id)->as_int;
+}
+
+void
+btor_aig_collect_cone (BtorAIGMgr *amgr,
+                       BtorAIGPtrStack *roots,
+                       BtorAIGPtrStack *nodes,
+                       BtorIntHashTable *idx)
+{
+  assert (amgr);
+  assert (roots);
+  assert (nodes);
+  assert (idx);
+
+  size_t i;
+  BtorMemMgr *mm;
+  BtorAIG *cur, *child;
+  BtorAIGPtrStack visit;
+  BtorIntHashTable *mark;
+
+  mm   = amgr->btor->mm;
+  mark = btor_hashint_table_new (mm);
+  BTOR_INIT_STACK (mm, visit);
+  for (i = 0; i < BTOR_COUNT_STACK (*roots); i++)
+  {
+    cur = BTOR_PEEK_STACK (*roots, i);
+    if (!btor_aig_is_const (cur))
+      BTOR_PUSH_STACK (visit, BTOR_REAL_ADDR_AIG (cur));
+  }
+
+  while (!BTOR_EMPTY_STACK (visit))
+  {
+    cur = BTOR_POP_STACK (visit);
+    assert (BTOR_IS_REGULAR_AIG (cur));
+
+    if (btor_hashint_map_contains (idx, cur->id)) continue;
+
+    if (btor_hashint_table_contains (mark, cur->id))
+    {
+      btor_hashint_map_add (idx, cur->id)->as_int = BTOR_COUNT_STACK (*nodes);
+      BTOR_PUSH_STACK (*nodes, cur);
+      continue;
+    }
+
+    btor_hashint_table_add (mark, cur->id);
+    BTOR_PUSH_STACK (visit, cur);
+    if (btor_aig_is_and (cur))
+    {
+      for (i = 0; i < 2; i++)
+      {
+        child = BTOR_REAL_ADDR_AIG (i ? btor_aig_get_right_child (amgr, cur)
+                                      : btor_aig_get_left_child (amgr, cur));
+        if (!btor_hashint_map_contains (idx, child->id))
+          BTOR_PUSH_STACK (visit, child);
+      }
+    }
+  }
+  BTOR_RELEASE_STACK (visit);
+  btor_hashint_table_delete (mark);
+}
+
+int32_t
+btor_aig_get_assignment (BtorAIGMgr *amgr, BtorAIG *aig)
+{
+  assert (amgr);
+  if (aig == BTOR_AIG_TRUE) return 1;
+  if (aig == BTOR_AIG_FALSE) return -1;
+
+  BtorAIG *real_aig;
+  int32_t val;
+
+  real_aig = BTOR_REAL_ADDR_AIG (aig);
+  if (btor_aig_is_and (real_aig) && !btor_aig_is_encoded (amgr, real_aig)
+      && btor_sat_is_initialized (amgr->smgr))
+    val = eval_aig (amgr, real_aig);
+  else
+    val = get_sat_assignment (amgr, real_aig);
   return BTOR_IS_INVERTED_AIG (aig) ? -val : val;
 }
 
@@ -17,7 +17,9 @@
 #include "btortypes.h"
 #include "utils/btorhashptr.h"
 #include "utils/btormem.h"
+#include "utils/btorhashint.h"
 #include "utils/btorstack.h"
+#include "utils/btoruniquetable.h"
 
 #include <stdint.h>
 #include <stdio.h>
@@ -26,39 +28,48 @@ struct BtorAIGMap;
 
 /*------------------------------------------------------------------------*/
 
+/* The data of an AIG that is accessed when building and encoding AIGs
+ * (children, CNF id and polarities, reference count) is not stored in
+ * the AIG itself, but in arrays of the AIG manager that are indexed by AIG
+ * id (see BtorAIGMgr). */
 struct BtorAIG
 {
   int32_t id;
-  int32_t cnf_id;
-  uint32_t refs;
-  int32_t next; /* next AIG id for unique table */
   uint8_t mark : 2;
   uint8_t is_var : 1; /* is it an AIG variable or an AND? */
   uint32_t local;
-  int32_t children[]; /* only allocated for AIG AND */
 };
 
 typedef struct BtorAIG BtorAIG;
 
 BTOR_DECLARE_STACK (BtorAIGPtr, BtorAIG *);
 
-struct BtorAIGUniqueTable
-{
-  uint32_t size;
-  uint32_t num_elements;
-  int32_t *chains;
-};
-
-typedef struct BtorAIGUniqueTable BtorAIGUniqueTable;
+/* Polarities in which an AIG is encoded into CNF.  For an AIG x = f(...),
+ * the positive polarity denotes the clauses of x -> f(...), the negative
+ * polarity the clauses of f(...) -> x. */
+#define BTOR_AIG_POL_POS 1
+#define BTOR_AIG_POL_NEG 2
+#define BTOR_AIG_POL_BOTH 3
 
 struct BtorAIGMgr
 {
   Btor *btor;
-  BtorAIGUniqueTable table;
+  BtorUniqueTable table;
   BtorSATMgr *smgr;
   BtorAIGPtrStack id2aig; /* id to AIG node */
   BtorIntStack cnfid2aig; /* cnf id to AIG id */
 
+  /* AIG data indexed by AIG id */
+  BtorIntStack children; /* children ids of AND AIG i at 2 * i, 2 * i + 1 */
+  BtorIntStack cnf_ids;  /* cnf id */
+  BtorCharStack cnf_pols; /* polarities encoded into CNF (BTOR_AIG_POL_*) */
+  BtorUIntStack refs;    /* reference counter */
+
+  /* values of AIGs that are not encoded in both polarities, computed from
+   * the assignment of the SAT solver after SAT call 'eval_satcalls' */
+  BtorIntHashTable *eval_cache;
+  int32_t eval_satcalls;
+
   uint_least64_t cur_num_aigs;     /* current number of ANDs */
   uint_least64_t cur_num_aig_vars; /* current number of AIG variables */
 
@@ -68,6 +79,10 @@ struct BtorAIGMgr
   uint_least64_t num_cnf_vars;
   uint_least64_t num_cnf_clauses;
   uint_least64_t num_cnf_literals;
+  uint_least64_t num_sweep_checks; /* SAT calls of SAT sweeping */
+  uint_least64_t num_sweep_merged; /* AIGs merged by SAT sweeping */
+  uint_least64_t num_cut_rewrites; /* AIGs replaced by cut rewriting */
+  uint_least64_t num_cut_removed;  /* ANDs removed by cut rewriting */
 };
 
 typedef struct BtorAIGMgr BtorAIGMgr;
@@ -139,30 +154,50 @@ btor_aig_get_by_id (BtorAIGMgr *amgr, int32_t id)
 }
 
 static inline int32_t
-btor_aig_get_cnf_id (const BtorAIG *aig)
+btor_aig_get_cnf_id (const BtorAIGMgr *amgr, const BtorAIG *aig)
 {
+  assert (amgr);
+  int32_t cnf_id;
   if (btor_aig_is_true (aig)) return 1;
   if (btor_aig_is_false (aig)) return -1;
-  return BTOR_IS_INVERTED_AIG (aig) ? -BTOR_REAL_ADDR_AIG (aig)->cnf_id
-                                    : aig->cnf_id;
+  cnf_id = BTOR_PEEK_STACK (amgr->cnf_ids, BTOR_REAL_ADDR_AIG (aig)->id);
+  return BTOR_IS_INVERTED_AIG (aig) ? -cnf_id : cnf_id;
 }
 
-static inline BtorAIG *
-btor_aig_get_left_child (BtorAIGMgr *amgr, const BtorAIG *aig)
+/* Returns true if 'aig' is encoded into CNF in both polarities, i.e., the
+ * value of its CNF id in the SAT solver is the value of 'aig'. */
+static inline bool
+btor_aig_is_encoded (const BtorAIGMgr *amgr, const BtorAIG *aig)
+{
+  assert (amgr);
+  if (btor_aig_is_const (aig)) return true;
+  return BTOR_PEEK_STACK (amgr->cnf_pols, BTOR_REAL_ADDR_AIG (aig)->id)
+         == BTOR_AIG_POL_BOTH;
+}
+
+/* Get the id of the child with index 'i' of AND AIG 'aig'. */
+static inline int32_t
+btor_aig_get_child_id (const BtorAIGMgr *amgr, const BtorAIG *aig, uint32_t i)
 {
   assert (amgr);
   assert (aig);
   assert (!btor_aig_is_const (aig));
-  return btor_aig_get_by_id (amgr, BTOR_REAL_ADDR_AIG (aig)->children[0]);
+  assert (btor_aig_is_and (BTOR_REAL_ADDR_AIG (aig)));
+  assert (i < 2);
+  return BTOR_PEEK_STACK (amgr->children,
+                          2 * (size_t) BTOR_REAL_ADDR_AIG (aig)->id + i);
+}
+
+static inline BtorAIG *
+btor_aig_get_left_child (BtorAIGMgr *amgr, const BtorAIG *aig)
+{
+  return btor_aig_get_by_id (amgr, btor_aig_get_child_id (amgr, aig, 0));
 }
 
 static inline BtorAIG *
 btor_aig_get_right_child (BtorAIGMgr *amgr, const BtorAIG *aig)
 {
-  assert (amgr);
-  assert (aig);
-  assert (!btor_aig_is_const (aig));
-  return btor_aig_get_by_id (amgr, BTOR_REAL_ADDR_AIG (aig)->children[1]);
+  return btor_aig_get_by_id (amgr, btor_aig_get_child_id (amgr, aig, 1));
 }
 
 /*------------------------------------------------------------------------*/
@@ -208,6 +243,8 @@ void btor_aig_to_sat (BtorAIGMgr *amgr, BtorAIG *aig);
 
 /* As 'btor_aig_to_sat' but also add the argument as new SAT constraint.
  * Actually this will result in less constraints being generated.
+ * With Plaisted-Greenbaum encoding (BTOR_OPT_CNF_ENC) the argument is only
+ * encoded in positive polarity.
  */
 void btor_aig_add_toplevel_to_sat (BtorAIGMgr *, BtorAIG *);
 
@@ -218,9 +255,20 @@ void btor_aig_add_toplevel_to_sat (BtorAIGMgr *, BtorAIG *);
 void btor_aig_to_sat_tseitin (BtorAIGMgr *amgr, BtorAIG *aig);
 
 /* Gets current assignment of AIG aig (in the SAT case).
+ * The assignment of AIGs that are not encoded in both polarities is
+ * computed from the assignment of their children.
  */
 int32_t btor_aig_get_assignment (BtorAIGMgr *amgr, BtorAIG *aig);
 
+/* Collects all non-constant AIGs in the cones of 'roots' in topological
+ * order (children before parents) on 'nodes', and maps their ids to their
+ * position on 'nodes' in 'idx' (a map created with btor_hashint_map_new).
+ */
+void btor_aig_collect_cone (BtorAIGMgr *amgr,
+                            BtorAIGPtrStack *roots,
+                            BtorAIGPtrStack *nodes,
+                            BtorIntHashTable *idx);
+
 /* Orders AIGs (actually assume left child of an AND node is smaller
  * than right child
  */
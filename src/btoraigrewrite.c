@@ -0,0 +1,755 @@
+/*  Boolector: Satisfiability Modulo Theories (SMT) solver.
+ *
+ *  Copyright (C) 2020 Aina Niemetz.
+ *  Copyright (C) 2020 Mathias Preiner.
+ *
+ *  This file is part of Boolector.
+ *  See COPYING for more information on using this software.
+ */
+
+#include "btoraigrewrite.h"
+
+#include "btorcore.h"
+#include "utils/btorhashint.h"
+#include "utils/btorutil.h"
+
+#include <assert.h>
+
+/*------------------------------------------------------------------------*/
+
+#define BTOR_AIG_CUT_SIZE 4
+
+#define BTOR_AIG_MAX_CUTS 8
+
+/* Truth tables are defined over the 4 variables of a cut, where variables
+ * beyond the size of a cut are irrelevant. */
+#define BTOR_AIG_TT_MASK 0xffffu
+
+#define BTOR_AIG_TT_NUM (1u << 16)
+
+static const uint32_t tt_vars[BTOR_AIG_CUT_SIZE] = {
+    0xaaaa, 0xcccc, 0xf0f0, 0xff00};
+
+struct BtorAIGCut
+{
+  uint32_t size;
+  uint32_t truth;
+  uint32_t leaves[BTOR_AIG_CUT_SIZE]; /* positions of leaves, ascending */
+};
+
+typedef struct BtorAIGCut BtorAIGCut;
+
+struct BtorAIGCutSet
+{
+  uint32_t num;
+  BtorAIGCut cuts[BTOR_AIG_MAX_CUTS]; /* non-trivial cuts */
+};
+
+typedef struct BtorAIGCutSet BtorAIGCutSet;
+
+enum BtorAIGImplKind
+{
+  BTOR_AIG_IMPL_CONST,
+  BTOR_AIG_IMPL_LIT, /* cut variable 'arg' */
+  BTOR_AIG_IMPL_AND, /* AND of functions over variables 'arg' and rest */
+  BTOR_AIG_IMPL_XOR, /* XOR of functions over variables 'arg' and rest */
+  BTOR_AIG_IMPL_ITE, /* Shannon expansion w.r.t. cut variable 'arg' */
+};
+
+typedef enum BtorAIGImplKind BtorAIGImplKind;
+
+#define BTOR_AIG_IMPL_UNKNOWN UINT8_MAX
+
+/* Implementation of a truth table, the cost is the number of ANDs. */
+struct BtorAIGImpl
+{
+  uint8_t cost;
+  uint8_t kind;
+  uint8_t arg;
+  uint8_t neg; /* implementation is negated */
+};
+
+typedef struct BtorAIGImpl BtorAIGImpl;
+
+struct BtorAIGRewriter
+{
+  BtorAIGMgr *amgr;
+  BtorAIGPtrStack nodes;  /* AIGs in the cones in topological order */
+  BtorIntHashTable *idx;  /* maps AIG ids to positions in 'nodes' */
+  BtorAIGPtrStack mapped; /* rewritten AIG of the AIG at position i */
+  BtorAIGCutSet **cuts;   /* cuts of the AIG at position i */
+  uint32_t *fanouts;      /* fanouts in the cones and root references */
+  uint32_t *pending;      /* fanouts whose cuts are not computed yet */
+  BtorAIGImpl *impls;     /* implementations indexed by truth table */
+  BtorIntStack visit;
+  BtorIntStack touched;
+  BtorIntStack mffc; /* ids of the rewritten AIGs of the current MFFC */
+  uint32_t rewrites;
+};
+
+typedef struct BtorAIGRewriter BtorAIGRewriter;
+
+/*------------------------------------------------------------------------*/
+/* truth tables                                                           */
+/*------------------------------------------------------------------------*/
+
+static inline uint32_t
+tt_cofactor (uint32_t t, uint32_t var, bool val)
+{
+  uint32_t m, s;
+
+  m = tt_vars[var];
+  s = 1u << var;
+  if (val)
+  {
+    t &= m;
+    return t | (t >> s);
+  }
+  t &= ~m & BTOR_AIG_TT_MASK;
+  return (t | (t << s)) & BTOR_AIG_TT_MASK;
+}
+
+static uint32_t
+tt_support (uint32_t t)
+{
+  uint32_t j, res;
+
+  for (res = 0, j = 0; j < BTOR_AIG_CUT_SIZE; j++)
+    if (tt_cofactor (t, j, false) != tt_cofactor (t, j, true)) res |= 1u << j;
+  return res;
+}
+
+/* Existentially quantify the variables in 'vars'. */
+static uint32_t
+tt_exists (uint32_t t, uint32_t vars)
+{
+  uint32_t j;
+
+  for (j = 0; j < BTOR_AIG_CUT_SIZE; j++)
+    if (vars & (1u << j))
+      t = tt_cofactor (t, j, false) | tt_cofactor (t, j, true);
+  return t;
+}
+
+/* Set the variables in 'vars' to false. */
+static uint32_t
+tt_cofactor_false (uint32_t t, uint32_t vars)
+{
+  uint32_t j;
+
+  for (j = 0; j < BTOR_AIG_CUT_SIZE; j++)
+    if (vars & (1u << j)) t = tt_cofactor (t, j, false);
+  return t;
+}
+
+/* Functions 'g' over 'vars' and 'h' over the remaining variables of the
+ * support 's' with t = g ^ h, if such a decomposition exists. */
+static inline void
+tt_xor_decomp (uint32_t t, uint32_t s, uint32_t vars, uint32_t *g, uint32_t *h)
+{
+  *g = tt_cofactor_false (t, s & ~vars);
+  *h = tt_cofactor_false (t, vars) ^ ((t & 1) ? BTOR_AIG_TT_MASK : 0);
+}
+
+/*------------------------------------------------------------------------*/
+/* implementations                                                        */
+/*------------------------------------------------------------------------*/
+
+static void compute_impl (BtorAIGRewriter *rw, uint32_t t);
+
+static uint32_t
+impl_cost (BtorAIGRewriter *rw, uint32_t t)
+{
+  assert (t < BTOR_AIG_TT_NUM);
+  if (rw->impls[t].cost == BTOR_AIG_IMPL_UNKNOWN) compute_impl (rw, t);
+  return rw->impls[t].cost;
+}
+
+static inline void
+set_impl (BtorAIGImpl *impl,
+          uint32_t cost,
+          BtorAIGImplKind kind,
+          uint32_t arg,
+          bool neg)
+{
+  if (cost >= impl->cost) return;
+  impl->cost = cost;
+  impl->kind = kind;
+  impl->arg  = arg;
+  impl->neg  = neg;
+}
+
+/* Determine the cheapest implementation of 't' that is obtained from AND,
+ * OR and XOR bi-decomposition and Shannon expansion.  Recursion depth is
+ * bounded by the size of the support of 't', which strictly decreases. */
+static void
+compute_impl (BtorAIGRewriter *rw, uint32_t t)
+{
+  uint32_t j, s, a, b, u, g, h, low, neg;
+  BtorAIGImpl *impl;
+
+  impl       = rw->impls + t;
+  impl->cost = BTOR_AIG_IMPL_UNKNOWN - 1;
+
+  if (t == 0 || t == BTOR_AIG_TT_MASK)
+  {
+    impl->cost = 0;
+    impl->kind = BTOR_AIG_IMPL_CONST;
+    return;
+  }
+  for (j = 0; j < BTOR_AIG_CUT_SIZE; j++)
+  {
+    if (t == tt_vars[j] || t == (~tt_vars[j] & BTOR_AIG_TT_MASK))
+    {
+      set_impl (impl, 0, BTOR_AIG_IMPL_LIT, j, t != tt_vars[j]);
+      return;
+    }
+  }
+
+  s   = tt_support (t);
+  low = s & -s;
+  /* proper non-empty subsets of the support that contain its lowest
+   * variable, the remaining variables form the other part */
+  for (a = (s - 1) & s; a; a = (a - 1) & s)
+  {
+    if (!(a & low)) continue;
+    b = s & ~a;
+    for (neg = 0; neg < 2; neg++)
+    {
+      u = neg ? ~t & BTOR_AIG_TT_MASK : t;
+      g = tt_exists (u, b);
+      h = tt_exists (u, a);
+      if ((g & h) == u)
+        set_impl (impl,
+                  1 + impl_cost (rw, g) + impl_cost (rw, h),
+                  BTOR_AIG_IMPL_AND,
+                  a,
+                  neg);
+    }
+    tt_xor_decomp (t, s, a, &g, &h);
+    if ((g ^ h) == t)
+      set_impl (impl,
+                3 + impl_cost (rw, g) + impl_cost (rw, h),
+                BTOR_AIG_IMPL_XOR,
+                a,
+                false);
+  }
+  for (j = 0; j < BTOR_AIG_CUT_SIZE; j++)
+  {
+    if (!(s & (1u << j))) continue;
+    set_impl (impl,
+              3 + impl_cost (rw, tt_cofactor (t, j, false))
+                  + impl_cost (rw, tt_cofactor (t, j, true)),
+              BTOR_AIG_IMPL_ITE,
+              j,
+              false);
+  }
+  assert (impl->cost < BTOR_AIG_IMPL_UNKNOWN);
+}
+
+/* Build the implementation of 't' over the given cut leaves. */
+static BtorAIG *
+build_impl (BtorAIGRewriter *rw, uint32_t t, BtorAIG **leaves)
+{
+  uint32_t s, u, g, h;
+  BtorAIG *res, *left, *right;
+  BtorAIGImpl *impl;
+  BtorAIGMgr *amgr;
+
+  amgr = rw->amgr;
+  (void) impl_cost (rw, t);
+  impl = rw->impls + t;
+
+  switch (impl->kind)
+  {
+    case BTOR_AIG_IMPL_CONST: return t ? BTOR_AIG_TRUE : BTOR_AIG_FALSE;
+
+    case BTOR_AIG_IMPL_LIT:
+      res = btor_aig_copy (amgr, leaves[impl->arg]);
+      break;
+
+    case BTOR_AIG_IMPL_AND:
+      s     = tt_support (t);
+      u     = impl->neg ? ~t & BTOR_AIG_TT_MASK : t;
+      left  = build_impl (rw, tt_exists (u, s & ~impl->arg), leaves);
+      right = build_impl (rw, tt_exists (u, impl->arg), leaves);
+      res   = btor_aig_and (amgr, left, right);
+      btor_aig_release (amgr, left);
+      btor_aig_release (amgr, right);
+      break;
+
+    case BTOR_AIG_IMPL_XOR:
+      tt_xor_decomp (t, tt_support (t), impl->arg, &g, &h);
+      left  = build_impl (rw, g, leaves);
+      right = build_impl (rw, h, leaves);
+      res   = BTOR_INVERT_AIG (btor_aig_eq (amgr, left, right));
+      btor_aig_release (amgr, left);
+      btor_aig_release (amgr, right);
+      break;
+
+    default:
+      assert (impl->kind == BTOR_AIG_IMPL_ITE);
+      left  = build_impl (rw, tt_cofactor (t, impl->arg, true), leaves);
+      right = build_impl (rw, tt_cofactor (t, impl->arg, false), leaves);
+      res   = btor_aig_cond (amgr, leaves[impl->arg], left, right);
+      btor_aig_release (amgr, left);
+      btor_aig_release (amgr, right);
+  }
+  return impl->neg ? BTOR_INVERT_AIG (res) : res;
+}
+
+/*------------------------------------------------------------------------*/
+/* cuts                                                                   */
+/*------------------------------------------------------------------------*/
+
+static inline void
+init_trivial_cut (BtorAIGCut *cut, uint32_t pos)
+{
+  cut->size      = 1;
+  cut->truth     = tt_vars[0];
+  cut->leaves[0] = pos;
+}
+
+static bool
+merge_cut_leaves (const BtorAIGCut *c0, const BtorAIGCut *c1, BtorAIGCut *res)
+{
+  uint32_t i, j, n;
+
+  for (i = 0, j = 0, n = 0; i < c0->size || j < c1->size; n++)
+  {
+    if (n == BTOR_AIG_CUT_SIZE) return false;
+    if (j == c1->size || (i < c0->size && c0->leaves[i] < c1->leaves[j]))
+      res->leaves[n] = c0->leaves[i++];
+    else if (i == c0->size || c1->leaves[j] < c0->leaves[i])
+      res->leaves[n] = c1->leaves[j++];
+    else
+    {
+      res->leaves[n] = c0->leaves[i++];
+      j++;
+    }
+  }
+  res->size = n;
+  return true;
+}
+
+/* Express the truth table of cut 'from' over the leaves of cut 'to', which
+ * contains all leaves of 'from'. */
+static uint32_t
+expand_truth (const BtorAIGCut *from, const BtorAIGCut *to)
+{
+  uint32_t i, j, m, src, res, pos[BTOR_AIG_CUT_SIZE];
+
+  for (i = 0, j = 0; i < from->size; i++)
+  {
+    while (to->leaves[j] != from->leaves[i]) j++;
+    pos[i] = j;
+  }
+  for (res = 0, m = 0; m < 16; m++)
+  {
+    for (src = 0, i = 0; i < from->size; i++)
+      if (m & (1u << pos[i])) src |= 1u << i;
+    if (from->truth & (1u << src)) res |= 1u << m;
+  }
+  return res;
+}
+
+static bool
+is_subset_cut (const BtorAIGCut *c0, const BtorAIGCut *c1)
+{
+  uint32_t i, j;
+
+  if (c0->size > c1->size) return false;
+  for (i = 0, j = 0; i < c0->size; i++)
+  {
+    while (j < c1->size && c1->leaves[j] < c0->leaves[i]) j++;
+    if (j == c1->size || c1->leaves[j] != c0->leaves[i]) return false;
+  }
+  return true;
+}
+
+/* Add 'cut' unless it is dominated by a cut in 'set', remove the cuts that
+ * are dominated by 'cut'.  If the set is full, 'cut' replaces the largest
+ * cut if it is smaller. */
+static void
+add_cut (BtorAIGCutSet *set, const BtorAIGCut *cut)
+{
+  uint32_t i, max;
+
+  for (i = 0; i < set->num; i++)
+    if (is_subset_cut (set->cuts + i, cut)) return;
+  for (i = 0; i < set->num;)
+  {
+    if (is_subset_cut (cut, set->cuts + i))
+      set->cuts[i] = set->cuts[--set->num];
+    else
+      i++;
+  }
+  if (set->num < BTOR_AIG_MAX_CUTS)
+  {
+    set->cuts[set->num++] = *cut;
+    return;
+  }
+  for (max = 0, i = 1; i < set->num; i++)
+    if (set->cuts[i].size > set->cuts[max].size) max = i;
+  if (set->cuts[max].size > cut->size) set->cuts[max] = *cut;
+}
+
+static void
+get_child (BtorAIGRewriter *rw, BtorAIG *aig, uint32_t i, uint32_t *pos)
+{
+  BtorAIG *child;
+
+  child = i ? btor_aig_get_right_child (rw->amgr, aig)
+            : btor_aig_get_left_child (rw->amgr, aig);
+  *pos = btor_hashint_map_get (rw->idx, BTOR_REAL_ADDR_AIG (child)->id)->as_int;
+}
+
+static void
+compute_cuts (BtorAIGRewriter *rw, uint32_t i)
+{
+  int32_t j, k;
+  uint32_t pos[2], truth[2], num[2];
+  bool inv[2];
+  BtorAIG *aig;
+  BtorAIGCut trivial[2], cut;
+  const BtorAIGCut *c[2];
+  BtorAIGCutSet *set;
+
+  aig = BTOR_PEEK_STACK (rw->nodes, i);
+  for (j = 0; j < 2; j++)
+  {
+    inv[j] = BTOR_IS_INVERTED_AIG (j ? btor_aig_get_right_child (rw->amgr, aig)
+                                     : btor_aig_get_left_child (rw->amgr, aig));
+    get_child (rw, aig, j, pos + j);
+    num[j] = rw->cuts[pos[j]] ? rw->cuts[pos[j]]->num : 0;
+    init_trivial_cut (trivial + j, pos[j]);
+  }
+
+  BTOR_CNEW (rw->amgr->btor->mm, set);
+  for (j = -1; j < (int32_t) num[0]; j++)
+  {
+    c[0] = j < 0 ? trivial : rw->cuts[pos[0]]->cuts + j;
+    for (k = -1; k < (int32_t) num[1]; k++)
+    {
+      c[1] = k < 0 ? trivial + 1 : rw->cuts[pos[1]]->cuts + k;
+      if (!merge_cut_leaves (c[0], c[1], &cut)) continue;
+      truth[0]  = expand_truth (c[0], &cut) ^ (inv[0] ? BTOR_AIG_TT_MASK : 0);
+      truth[1]  = expand_truth (c[1], &cut) ^ (inv[1] ? BTOR_AIG_TT_MASK : 0);
+      cut.truth = truth[0] & truth[1];
+      add_cut (set, &cut);
+    }
+  }
+  rw->cuts[i] = set;
+}
+
+static void
+release_cuts (BtorAIGRewriter *rw, uint32_t i)
+{
+  if (!rw->cuts[i]) return;
+  BTOR_DELETE (rw->amgr->btor->mm, rw->cuts[i]);
+  rw->cuts[i] = 0;
+}
+
+/*------------------------------------------------------------------------*/
+/* rewriting                                                              */
+/*------------------------------------------------------------------------*/
+
+static bool
+is_leaf (const BtorAIGCut *cut, uint32_t pos)
+{
+  uint32_t i;
+  for (i = 0; i < cut->size; i++)
+    if (cut->leaves[i] == pos) return true;
+  return false;
+}
+
+/* Returns the size of the maximum fanout-free cone of the AIG at position
+ * 'i' w.r.t. 'cut', i.e., the number of AIGs that are not needed anymore if
+ * the AIG is replaced.  The ids of the rewritten AIGs of the cone are
+ * collected in 'rw->mffc', where 'aig' is the rewritten AIG at 'i'. */
+static uint32_t
+mffc_size (BtorAIGRewriter *rw,
+           uint32_t i,
+           BtorAIG *aig,
+           const BtorAIGCut *cut)
+{
+  uint32_t j, k, pos, res;
+
+  BTOR_RESET_STACK (rw->mffc);
+  BTOR_RESET_STACK (rw->touched);
+  BTOR_PUSH_STACK (rw->visit, i);
+  res = 0;
+  while (!BTOR_EMPTY_STACK (rw->visit))
+  {
+    k = BTOR_POP_STACK (rw->visit);
+    if (k != i) aig = BTOR_PEEK_STACK (rw->mapped, k);
+    res++;
+    if (!btor_aig_is_const (aig))
+      BTOR_PUSH_STACK (rw->mffc, BTOR_REAL_ADDR_AIG (aig)->id);
+    for (j = 0; j < 2; j++)
+    {
+      get_child (rw, BTOR_PEEK_STACK (rw->nodes, k), j, &pos);
+      if (is_leaf (cut, pos)) continue;
+      assert (btor_aig_is_and (BTOR_PEEK_STACK (rw->nodes, pos)));
+      assert (rw->fanouts[pos] > 0);
+      BTOR_PUSH_STACK (rw->touched, pos);
+      if (--rw->fanouts[pos] == 0) BTOR_PUSH_STACK (rw->visit, pos);
+    }
+  }
+  while (!BTOR_EMPTY_STACK (rw->touched))
+    rw->fanouts[BTOR_POP_STACK (rw->touched)]++;
+  return res;
+}
+
+static bool
+is_in_mffc (BtorAIGRewriter *rw, int32_t id)
+{
+  size_t i;
+  for (i = 0; i < BTOR_COUNT_STACK (rw->mffc); i++)
+    if (BTOR_PEEK_STACK (rw->mffc, i) == id) return true;
+  return false;
+}
+
+/* Returns the number of AIGs in the cone of 'aig' that are either new,
+ * i.e., have an id >= 'new_id', or part of the current MFFC. */
+static uint32_t
+count_added (BtorAIGRewriter *rw, BtorAIG *aig, int32_t new_id)
+{
+  size_t i;
+  uint32_t res;
+  BtorAIG *cur;
+  BtorAIGPtrStack visit;
+  BtorIntStack cache;
+
+  res = 0;
+  BTOR_INIT_STACK (rw->amgr->btor->mm, visit);
+  BTOR_INIT_STACK (rw->amgr->btor->mm, cache);
+  BTOR_PUSH_STACK (visit, aig);
+  while (!BTOR_EMPTY_STACK (visit))
+  {
+    cur = BTOR_REAL_ADDR_AIG (BTOR_POP_STACK (visit));
+    if (!btor_aig_is_and (cur)) continue;
+    if (cur->id < new_id && !is_in_mffc (rw, cur->id)) continue;
+    for (i = 0; i < BTOR_COUNT_STACK (cache); i++)
+      if (BTOR_PEEK_STACK (cache, i) == cur->id) break;
+    if (i < BTOR_COUNT_STACK (cache)) continue;
+    BTOR_PUSH_STACK (cache, cur->id);
+    res++;
+    BTOR_PUSH_STACK (visit, btor_aig_get_left_child (rw->amgr, cur));
+    BTOR_PUSH_STACK (visit, btor_aig_get_right_child (rw->amgr, cur));
+  }
+  BTOR_RELEASE_STACK (visit);
+  BTOR_RELEASE_STACK (cache);
+  return res;
+}
+
+/* Replace 'aig', the rebuilt AIG at position 'i', by the implementation of
+ * one of its cuts with the highest gain. */
+static BtorAIG *
+rewrite_aig (BtorAIGRewriter *rw, uint32_t i, BtorAIG *aig)
+{
+  int32_t gain, best_gain, new_id;
+  uint32_t j, k, size;
+  BtorAIG *impl, *best, *leaves[BTOR_AIG_CUT_SIZE];
+  BtorAIGCut *cut;
+  BtorAIGMgr *amgr;
+
+  amgr      = rw->amgr;
+  best      = 0;
+  best_gain = 0;
+  for (j = 0; j < rw->cuts[i]->num; j++)
+  {
+    cut  = rw->cuts[i]->cuts + j;
+    size = mffc_size (rw, i, aig, cut);
+    if (impl_cost (rw, cut->truth) >= size) continue;
+
+    for (k = 0; k < cut->size; k++)
+      leaves[k] = BTOR_PEEK_STACK (rw->mapped, cut->leaves[k]);
+    new_id = BTOR_COUNT_STACK (amgr->id2aig);
+    impl   = build_impl (rw, cut->truth, leaves);
+    gain   = (int32_t) size - (int32_t) count_added (rw, impl, new_id);
+    if (impl != aig && gain > best_gain)
+    {
+      if (best) btor_aig_release (amgr, best);
+      best      = impl;
+      best_gain = gain;
+    }
+    else
+      btor_aig_release (amgr, impl);
+  }
+  if (best)
+  {
+    btor_aig_release (amgr, aig);
+    aig = best;
+    rw->rewrites++;
+  }
+  return aig;
+}
+
+static size_t
+count_ands (BtorAIGPtrStack *nodes)
+{
+  size_t i, res;
+  for (i = 0, res = 0; i < BTOR_COUNT_STACK (*nodes); i++)
+    if (btor_aig_is_and (BTOR_PEEK_STACK (*nodes, i))) res++;
+  return res;
+}
+
+static BtorAIG *
+map_aig (BtorAIGRewriter *rw, BtorAIG *aig)
+{
+  BtorAIG *res;
+  size_t k;
+
+  if (btor_aig_is_const (aig)) return aig;
+  k   = btor_hashint_map_get (rw->idx, BTOR_REAL_ADDR_AIG (aig)->id)->as_int;
+  res = BTOR_PEEK_STACK (rw->mapped, k);
+  return BTOR_IS_INVERTED_AIG (aig) ? BTOR_INVERT_AIG (res) : res;
+}
+
+void
+btor_aig_rewrite (BtorAIGMgr *amgr, BtorAIGPtrStack *roots)
+{
+  assert (amgr);
+  assert (roots);
+
+  uint32_t i, j, n, pos;
+  size_t before, after;
+  double start;
+  BtorAIG *cur, *res;
+  BtorAIGPtrStack new_roots, nodes;
+  BtorIntHashTable *idx;
+  BtorAIGRewriter rw;
+  BtorMemMgr *mm;
+  Btor *btor;
+
+  for (i = 0; i < BTOR_COUNT_STACK (*roots); i++)
+    if (!btor_aig_is_const (BTOR_PEEK_STACK (*roots, i))) break;
+  if (i == BTOR_COUNT_STACK (*roots)) return;
+
+  btor  = amgr->btor;
+  mm    = btor->mm;
+  start = btor_util_time_stamp ();
+
+  rw.amgr     = amgr;
+  rw.rewrites = 0;
+  BTOR_INIT_STACK (mm, rw.nodes);
+  BTOR_INIT_STACK (mm, rw.mapped);
+  BTOR_INIT_STACK (mm, rw.visit);
+  BTOR_INIT_STACK (mm, rw.touched);
+  BTOR_INIT_STACK (mm, rw.mffc);
+  rw.idx = btor_hashint_map_new (mm);
+  btor_aig_collect_cone (amgr, roots, &rw.nodes, rw.idx);
+  n = BTOR_COUNT_STACK (rw.nodes);
+
+  BTOR_CNEWN (mm, rw.cuts, n);
+  BTOR_CNEWN (mm, rw.fanouts, n);
+  BTOR_CNEWN (mm, rw.pending, n);
+  BTOR_NEWN (mm, rw.impls, BTOR_AIG_TT_NUM);
+  for (i = 0; i < BTOR_AIG_TT_NUM; i++)
+    rw.impls[i].cost = BTOR_AIG_IMPL_UNKNOWN;
+
+  for (i = 0; i < n; i++)
+  {
+    cur = BTOR_PEEK_STACK (rw.nodes, i);
+    if (!btor_aig_is_and (cur)) continue;
+    for (j = 0; j < 2; j++)
+    {
+      get_child (&rw, cur, j, &pos);
+      rw.fanouts[pos]++;
+      rw.pending[pos]++;
+    }
+  }
+  for (i = 0; i < BTOR_COUNT_STACK (*roots); i++)
+  {
+    cur = BTOR_PEEK_STACK (*roots, i);
+    if (btor_aig_is_const (cur)) continue;
+    rw.fanouts[btor_hashint_map_get (rw.idx, BTOR_REAL_ADDR_AIG (cur)->id)
+                   ->as_int]++;
+  }
+
+  /* Rebuild the cones in topological order, where every AIG is replaced by
+   * the best implementation of one of its cuts (if any).  Cuts are computed
+   * on the original AIGs and released as soon as all their fanouts have
+   * been processed. */
+  for (i = 0; i < n; i++)
+  {
+    cur = BTOR_PEEK_STACK (rw.nodes, i);
+    if (btor_aig_is_var (cur))
+    {
+      res = btor_aig_copy (amgr, cur);
+    }
+    else
+    {
+      compute_cuts (&rw, i);
+      res = btor_aig_and (amgr,
+                          map_aig (&rw, btor_aig_get_left_child (amgr, cur)),
+                          map_aig (&rw, btor_aig_get_right_child (amgr, cur)));
+      if (!btor_aig_is_const (res) && !btor_terminate (btor))
+        res = rewrite_aig (&rw, i, res);
+      for (j = 0; j < 2; j++)
+      {
+        get_child (&rw, cur, j, &pos);
+        if (--rw.pending[pos] == 0) release_cuts (&rw, pos);
+      }
+    }
+    BTOR_PUSH_STACK (rw.mapped, res);
+    if (!rw.pending[i]) release_cuts (&rw, i);
+  }
+
+  /* only keep the result if the number of ANDs in the cones decreased */
+  BTOR_INIT_STACK (mm, new_roots);
+  for (i = 0; i < BTOR_COUNT_STACK (*roots); i++)
+  {
+    res = map_aig (&rw, BTOR_PEEK_STACK (*roots, i));
+    BTOR_PUSH_STACK (new_roots, btor_aig_copy (amgr, res));
+  }
+  before = count_ands (&rw.nodes);
+  BTOR_INIT_STACK (mm, nodes);
+  idx = btor_hashint_map_new (mm);
+  btor_aig_collect_cone (amgr, &new_roots, &nodes, idx);
+  after = count_ands (&nodes);
+  BTOR_RELEASE_STACK (nodes);
+  btor_hashint_map_delete (idx);
+
+  if (after < before)
+  {
+    for (i = 0; i < BTOR_COUNT_STACK (*roots); i++)
+    {
+      btor_aig_release (amgr, BTOR_PEEK_STACK (*roots, i));
+      BTOR_POKE_STACK (*roots, i, BTOR_PEEK_STACK (new_roots, i));
+    }
+    amgr->num_cut_rewrites += rw.rewrites;
+    amgr->num_cut_removed += before - after;
+  }
+  else
+  {
+    while (!BTOR_EMPTY_STACK (new_roots))
+      btor_aig_release (amgr, BTOR_POP_STACK (new_roots));
+  }
+  BTOR_RELEASE_STACK (new_roots);
+
+  while (!BTOR_EMPTY_STACK (rw.mapped))
+    btor_aig_release (amgr, BTOR_POP_STACK (rw.mapped));
+#ifndef NDEBUG
+  for (i = 0; i < n; i++) assert (!rw.cuts[i]);
+#endif
+  BTOR_DELETEN (mm, rw.cuts, n);
+  BTOR_DELETEN (mm, rw.fanouts, n);
+  BTOR_DELETEN (mm, rw.pending, n);
+  BTOR_DELETEN (mm, rw.impls, BTOR_AIG_TT_NUM);
+  BTOR_RELEASE_STACK (rw.mapped);
+  BTOR_RELEASE_STACK (rw.nodes);
+  BTOR_RELEASE_STACK (rw.visit);
+  BTOR_RELEASE_STACK (rw.touched);
+  BTOR_RELEASE_STACK (rw.mffc);
+  btor_hashint_map_delete (rw.idx);
+
+  BTOR_MSG (btor->msg,
+            1,
+            "cut rewriting: %zu ANDs, %zu after %u rewrites in %.2f seconds",
+            before,
+            after < before ? after : before,
+            after < before ? rw.rewrites : 0,
+            btor_util_time_stamp () - start);
+}
@@ -0,0 +1,31 @@
+/*  Boolector: Satisfiability Modulo Theories (SMT) solver.
+ *
+ *  Copyright (C) 2020 Aina Niemetz.
+ *  Copyright (C) 2020 Mathias Preiner.
+ *
+ *  This file is part of Boolector.
+ *  See COPYING for more information on using this software.
+ */
+
+#ifndef BTORAIGREWRITE_H_INCLUDED
+#define BTORAIGREWRITE_H_INCLUDED
+
+#include "btoraig.h"
+
+/* DAG-aware cut rewriting.
+ *
+ * Enumerates 4-feasible cuts of the AIGs in the cones of the given roots and
+ * replaces the subgraph between an AIG and one of its cuts by a smaller
+ * implementation of the function of the cut.  Implementations are derived
+ * per truth table (by AND, OR, XOR bi-decomposition and Shannon expansion)
+ * and cached.  A replacement is only performed if the number of AIGs it
+ * adds (AIGs that are shared with the rest of the graph are not counted) is
+ * smaller than the number of AIGs it frees (the maximum fanout-free cone of
+ * the AIG w.r.t. the cut).
+ *
+ * The roots on the stack are replaced by their rewritten counterparts, the
+ * references to the original roots are released.
+ */
+void btor_aig_rewrite (BtorAIGMgr *amgr, BtorAIGPtrStack *roots);
+
+#endif
@@ -0,0 +1,464 @@
+/*  Boolector: Satisfiability Modulo Theories (SMT) solver.
+ *
+ *  Copyright (C) 2020 Aina Niemetz.
+ *  Copyright (C) 2020 Mathias Preiner.
+ *
+ *  This file is part of Boolector.
+ *  See COPYING for more information on using this software.
+ */
+
+#include "btoraigsweep.h"
+
+#include "btorcore.h"
+#include "btoropt.h"
+#include "btorsat.h"
+#include "utils/btorhashint.h"
+#include "utils/btorrng.h"
+#include "utils/btorutil.h"
+
+#include <assert.h>
+
+/*------------------------------------------------------------------------*/
+
+/* Number of 64-bit words of random input patterns simulated per AIG, i.e.,
+ * 64 * BTOR_AIG_SWEEP_WORDS random patterns are used to determine candidate
+ * equivalences.  An additional word collects input patterns from
+ * counterexamples to candidate equivalences. */
+#define BTOR_AIG_SWEEP_WORDS 4
+
+#define BTOR_AIG_SWEEP_CEX BTOR_AIG_SWEEP_WORDS
+
+#define BTOR_AIG_SWEEP_STRIDE (BTOR_AIG_SWEEP_WORDS + 1)
+
+struct BtorAIGSweeper
+{
+  BtorAIGMgr *amgr;
+  BtorSATMgr *smgr;       /* SAT manager for equivalence checks */
+  BtorIntHashTable *lits; /* maps AIG ids to CNF ids of 'smgr' */
+  int32_t limit;          /* limit per SAT call, -1 for no limit */
+
+  BtorAIGPtrStack nodes; /* AIGs in the cones in topological order */
+  BtorIntHashTable *idx; /* maps AIG ids to positions in 'nodes' */
+  uint64_t *sims;        /* simulation values of AIG i at i * STRIDE */
+  uint32_t num_cex;      /* number of counterexample patterns */
+
+  uint32_t checks;
+  uint32_t merged;
+};
+
+typedef struct BtorAIGSweeper BtorAIGSweeper;
+
+/*------------------------------------------------------------------------*/
+
+/* Simulate words 'from' to 'to' (exclusive) of AND AIG 'i' from the
+ * simulation values of its children. */
+static void
+simulate_and (BtorAIGSweeper *sweeper, size_t i, size_t from, size_t to)
+{
+  size_t j, k, w;
+  uint64_t mask[2];
+  uint64_t *s, *c[2];
+  BtorAIG *cur, *child;
+
+  cur = BTOR_PEEK_STACK (sweeper->nodes, i);
+  s   = sweeper->sims + i * BTOR_AIG_SWEEP_STRIDE;
+  assert (btor_aig_is_and (cur));
+  for (j = 0; j < 2; j++)
+  {
+    child = j ? btor_aig_get_right_child (sweeper->amgr, cur)
+              : btor_aig_get_left_child (sweeper->amgr, cur);
+    k     = btor_hashint_map_get (sweeper->idx, BTOR_REAL_ADDR_AIG (child)->id)
+            ->as_int;
+    assert (k < i);
+    c[j]    = sweeper->sims + k * BTOR_AIG_SWEEP_STRIDE;
+    mask[j] = BTOR_IS_INVERTED_AIG (child) ? ~(uint64_t) 0 : 0;
+  }
+  for (w = from; w < to; w++) s[w] = (c[0][w] ^ mask[0]) & (c[1][w] ^ mask[1]);
+}
+
+/* Simulate random input patterns on all AIGs. */
+static void
+simulate (BtorAIGSweeper *sweeper)
+{
+  size_t i, w;
+  uint64_t *s;
+  BtorRNG rng;
+
+  btor_rng_init (&rng, btor_opt_get (sweeper->amgr->btor, BTOR_OPT_SEED));
+  for (i = 0; i < BTOR_COUNT_STACK (sweeper->nodes); i++)
+  {
+    if (btor_aig_is_var (BTOR_PEEK_STACK (sweeper->nodes, i)))
+    {
+      s = sweeper->sims + i * BTOR_AIG_SWEEP_STRIDE;
+      for (w = 0; w < BTOR_AIG_SWEEP_STRIDE; w++)
+        s[w] = ((uint64_t) btor_rng_rand (&rng) << 32) | btor_rng_rand (&rng);
+    }
+    else
+    {
+      simulate_and (sweeper, i, 0, BTOR_AIG_SWEEP_STRIDE);
+    }
+  }
+  btor_rng_delete (&rng);
+}
+
+/* Add the input pattern of the current model of the SAT manager as
+ * counterexample pattern and update the simulation values of the AIGs up
+ * to position 'n' (exclusive).  Inputs that are not encoded keep their
+ * value. */
+static void
+refine (BtorAIGSweeper *sweeper, size_t n)
+{
+  size_t i;
+  uint64_t bit, *s;
+  BtorAIG *cur;
+  BtorHashTableData *d;
+
+  bit = (uint64_t) 1 << (sweeper->num_cex++ % 64);
+  for (i = 0; i < n; i++)
+  {
+    cur = BTOR_PEEK_STACK (sweeper->nodes, i);
+    if (btor_aig_is_var (cur))
+    {
+      d = btor_hashint_map_get (sweeper->lits, cur->id);
+      if (!d) continue;
+      s = sweeper->sims + i * BTOR_AIG_SWEEP_STRIDE;
+      if (btor_sat_deref (sweeper->smgr, d->as_int) > 0)
+        s[BTOR_AIG_SWEEP_CEX] |= bit;
+      else
+        s[BTOR_AIG_SWEEP_CEX] &= ~bit;
+    }
+    else
+    {
+      simulate_and (sweeper, i, BTOR_AIG_SWEEP_CEX, BTOR_AIG_SWEEP_CEX + 1);
+    }
+  }
+}
+
+/* Simulation values are normalized such that the first bit is 0, AIGs with
+ * equal normalized simulation values are candidates for being equal (in the
+ * same phase) or complementary (in opposite phases). */
+static inline uint64_t
+sim_phase_mask (const uint64_t *s)
+{
+  return (s[0] & 1) ? ~(uint64_t) 0 : 0;
+}
+
+/* The hash value of a candidate class is computed from the random patterns
+ * only, since the counterexample patterns of an AIG change over time. */
+static int32_t
+sim_hash (const uint64_t *s)
+{
+  size_t w;
+  uint64_t h, mask;
+
+  mask = sim_phase_mask (s);
+  for (h = 0, w = 0; w < BTOR_AIG_SWEEP_WORDS; w++)
+    h = (h + (s[w] ^ mask)) * 0x9e3779b97f4a7c15ull;
+  /* keys of int hash tables must be non-zero */
+  return (int32_t) (h >> 33) | 1;
+}
+
+static bool
+sim_is_const (const uint64_t *s)
+{
+  size_t w;
+  uint64_t mask;
+
+  mask = sim_phase_mask (s);
+  for (w = 0; w < BTOR_AIG_SWEEP_STRIDE; w++)
+    if (s[w] ^ mask) return false;
+  return true;
+}
+
+static bool
+sim_is_equal (const uint64_t *s0, const uint64_t *s1)
+{
+  size_t w;
+  uint64_t mask0, mask1;
+
+  mask0 = sim_phase_mask (s0);
+  mask1 = sim_phase_mask (s1);
+  for (w = 0; w < BTOR_AIG_SWEEP_STRIDE; w++)
+    if ((s0[w] ^ mask0) != (s1[w] ^ mask1)) return false;
+  return true;
+}
+
+/*------------------------------------------------------------------------*/
+
+/* Encode the cone of 'aig' into the SAT manager of the sweeper (if not
+ * encoded yet) and return the literal of 'aig'. */
+static int32_t
+encode (BtorAIGSweeper *sweeper, BtorAIG *aig)
+{
+  int32_t x, a, b;
+  BtorAIG *cur, *left, *right;
+  BtorAIGMgr *amgr;
+  BtorSATMgr *smgr;
+  BtorAIGPtrStack visit;
+  BtorHashTableData *d;
+
+  amgr = sweeper->amgr;
+  smgr = sweeper->smgr;
+
+  if (btor_aig_is_true (aig)) return smgr->true_lit;
+  if (btor_aig_is_false (aig)) return -smgr->true_lit;
+
+  BTOR_INIT_STACK (amgr->btor->mm, visit);
+  BTOR_PUSH_STACK (visit, BTOR_REAL_ADDR_AIG (aig));
+  while (!BTOR_EMPTY_STACK (visit))
+  {
+    cur = BTOR_POP_STACK (visit);
+    d   = btor_hashint_map_get (sweeper->lits, cur->id);
+
+    if (d && d->as_int) continue;
+
+    if (btor_aig_is_var (cur))
+    {
+      btor_hashint_map_add (sweeper->lits, cur->id)->as_int =
+          btor_sat_mgr_next_cnf_id (smgr);
+      continue;
+    }
+
+    left  = btor_aig_get_left_child (amgr, cur);
+    right = btor_aig_get_right_child (amgr, cur);
+
+    if (!d)
+    {
+      btor_hashint_map_add (sweeper->lits, cur->id)->as_int = 0;
+      BTOR_PUSH_STACK (visit, cur);
+      BTOR_PUSH_STACK (visit, BTOR_REAL_ADDR_AIG (right));
+      BTOR_PUSH_STACK (visit, BTOR_REAL_ADDR_AIG (left));
+      continue;
+    }
+
+    a = btor_hashint_map_get (sweeper->lits, BTOR_REAL_ADDR_AIG (left)->id)
+            ->as_int;
+    b = btor_hashint_map_get (sweeper->lits, BTOR_REAL_ADDR_AIG (right)->id)
+            ->as_int;
+    assert (a > 0);
+    assert (b > 0);
+    if (BTOR_IS_INVERTED_AIG (left)) a = -a;
+    if (BTOR_IS_INVERTED_AIG (right)) b = -b;
+    x = btor_sat_mgr_next_cnf_id (smgr);
+    btor_sat_add (smgr, -x);
+    btor_sat_add (smgr, a);
+    btor_sat_add (smgr, 0);
+    btor_sat_add (smgr, -x);
+    btor_sat_add (smgr, b);
+    btor_sat_add (smgr, 0);
+    btor_sat_add (smgr, x);
+    btor_sat_add (smgr, -a);
+    btor_sat_add (smgr, -b);
+    btor_sat_add (smgr, 0);
+    d->as_int = x;
+  }
+  BTOR_RELEASE_STACK (visit);
+
+  x = btor_hashint_map_get (sweeper->lits, BTOR_REAL_ADDR_AIG (aig)->id)
+          ->as_int;
+  return BTOR_IS_INVERTED_AIG (aig) ? -x : x;
+}
+
+/* Returns true if the conjunction of the given literals is unsatisfiable,
+ * 'lit1' is ignored if 0.  If it is satisfiable, the model is added as
+ * counterexample pattern for the AIGs up to position 'n' (exclusive). */
+static bool
+check_unsat (BtorAIGSweeper *sweeper, size_t n, int32_t lit0, int32_t lit1)
+{
+  BtorSolverResult res;
+
+  sweeper->checks++;
+  btor_sat_assume (sweeper->smgr, lit0);
+  if (lit1) btor_sat_assume (sweeper->smgr, lit1);
+  res = btor_sat_check_sat (sweeper->smgr, sweeper->limit);
+  if (res == BTOR_RESULT_SAT) refine (sweeper, n);
+  return res == BTOR_RESULT_UNSAT;
+}
+
+/* Prove that 'aig', the rebuilt AIG at position 'i', is equal to 'rep',
+ * which may be constant. */
+static bool
+prove_equal (BtorAIGSweeper *sweeper, size_t i, BtorAIG *aig, BtorAIG *rep)
+{
+  assert (!btor_aig_is_const (aig));
+
+  bool res;
+  int32_t a, r;
+
+  a = encode (sweeper, aig);
+  r = encode (sweeper, rep);
+
+  if (btor_aig_is_const (rep))
+    res = check_unsat (sweeper, i + 1, btor_aig_is_true (rep) ? -a : a, 0);
+  else
+    res = check_unsat (sweeper, i + 1, a, -r)
+          && check_unsat (sweeper, i + 1, -a, r);
+
+  if (res)
+  {
+    /* the equivalence holds, add it to simplify subsequent checks */
+    btor_sat_add (sweeper->smgr, -a);
+    btor_sat_add (sweeper->smgr, r);
+    btor_sat_add (sweeper->smgr, 0);
+    btor_sat_add (sweeper->smgr, a);
+    btor_sat_add (sweeper->smgr, -r);
+    btor_sat_add (sweeper->smgr, 0);
+  }
+  return res;
+}
+
+/*------------------------------------------------------------------------*/
+
+static BtorAIG *
+map_child (BtorAIGSweeper *sweeper, BtorAIGPtrStack *mapped, BtorAIG *child)
+{
+  BtorAIG *res;
+  size_t k;
+
+  k = btor_hashint_map_get (sweeper->idx, BTOR_REAL_ADDR_AIG (child)->id)
+          ->as_int;
+  res = BTOR_PEEK_STACK (*mapped, k);
+  return BTOR_IS_INVERTED_AIG (child) ? BTOR_INVERT_AIG (res) : res;
+}
+
+void
+btor_aig_sweep (BtorAIGMgr *amgr, BtorAIGPtrStack *roots)
+{
+  assert (amgr);
+  assert (roots);
+
+  size_t i, k, n;
+  double start;
+  uint64_t *s, *t;
+  BtorAIG *cur, *res, *rep, *left, *right;
+  BtorAIGPtrStack mapped;
+  BtorIntHashTable *classes;
+  BtorHashTableData *d;
+  BtorAIGSweeper sweeper;
+  BtorMemMgr *mm;
+  Btor *btor;
+
+  btor  = amgr->btor;
+  mm    = btor->mm;
+  start = btor_util_time_stamp ();
+
+  /* the DIMACS printer would dump the CNF of every equivalence check */
+  if (btor_opt_get (btor, BTOR_OPT_PRINT_DIMACS)) return;
+
+  sweeper.amgr    = amgr;
+  sweeper.smgr    = btor_sat_mgr_new (btor);
+  sweeper.limit   = btor_opt_get (btor, BTOR_OPT_SAT_SWEEP_LIMIT);
+  sweeper.num_cex = 0;
+  sweeper.checks  = 0;
+  sweeper.merged  = 0;
+  if (!sweeper.limit) sweeper.limit = -1;
+
+  btor_sat_enable_solver (sweeper.smgr);
+  if (!btor_sat_mgr_has_incremental_support (sweeper.smgr))
+  {
+    BTOR_MSG (btor->msg,
+              1,
+              "SAT solver '%s' does not support incremental mode, "
+              "disabling SAT sweeping",
+              sweeper.smgr->name);
+    btor_opt_set (btor, BTOR_OPT_SAT_SWEEP, 0);
+    btor_sat_mgr_delete (sweeper.smgr);
+    return;
+  }
+  btor_sat_init (sweeper.smgr);
+  sweeper.lits = btor_hashint_map_new (mm);
+
+  BTOR_INIT_STACK (mm, sweeper.nodes);
+  sweeper.idx = btor_hashint_map_new (mm);
+  btor_aig_collect_cone (amgr, roots, &sweeper.nodes, sweeper.idx);
+  n = BTOR_COUNT_STACK (sweeper.nodes);
+
+  BTOR_NEWN (mm, sweeper.sims, n * BTOR_AIG_SWEEP_STRIDE);
+  simulate (&sweeper);
+
+  /* Rebuild the cones in topological order.  Every AIG is either merged
+   * into the first AIG with equal simulation values (its representative) or
+   * into a constant, or becomes the representative of its candidate class. */
+  classes = btor_hashint_map_new (mm);
+  BTOR_INIT_STACK (mm, mapped);
+  for (i = 0; i < n; i++)
+  {
+    cur = BTOR_PEEK_STACK (sweeper.nodes, i);
+    s   = sweeper.sims + i * BTOR_AIG_SWEEP_STRIDE;
+
+    if (btor_aig_is_var (cur))
+    {
+      res = btor_aig_copy (amgr, cur);
+    }
+    else
+    {
+      left  = btor_aig_get_left_child (amgr, cur);
+      right = btor_aig_get_right_child (amgr, cur);
+      res   = btor_aig_and (amgr,
+                          map_child (&sweeper, &mapped, left),
+                          map_child (&sweeper, &mapped, right));
+    }
+
+    if (!btor_aig_is_const (res) && !btor_terminate (btor))
+    {
+      rep = 0;
+      if (sim_is_const (s))
+      {
+        rep = (s[0] & 1) ? BTOR_AIG_TRUE : BTOR_AIG_FALSE;
+      }
+      else if ((d = btor_hashint_map_get (classes, sim_hash (s))))
+      {
+        k = d->as_int;
+        t = sweeper.sims + k * BTOR_AIG_SWEEP_STRIDE;
+        if (sim_is_equal (s, t))
+        {
+          rep = BTOR_PEEK_STACK (mapped, k);
+          if ((s[0] & 1) != (t[0] & 1)) rep = BTOR_INVERT_AIG (rep);
+        }
+      }
+      else
+      {
+        btor_hashint_map_add (classes, sim_hash (s))->as_int = i;
+      }
+
+      if (rep && rep != res && !btor_aig_is_var (res)
+          && prove_equal (&sweeper, i, res, rep))
+      {
+        btor_aig_release (amgr, res);
+        res = btor_aig_copy (amgr, rep);
+        sweeper.merged++;
+      }
+    }
+    BTOR_PUSH_STACK (mapped, res);
+  }
+
+  for (i = 0; i < BTOR_COUNT_STACK (*roots); i++)
+  {
+    cur = BTOR_PEEK_STACK (*roots, i);
+    res = btor_aig_is_const (cur)
+              ? cur
+              : btor_aig_copy (amgr, map_child (&sweeper, &mapped, cur));
+    btor_aig_release (amgr, cur);
+    BTOR_POKE_STACK (*roots, i, res);
+  }
+
+  while (!BTOR_EMPTY_STACK (mapped))
+    btor_aig_release (amgr, BTOR_POP_STACK (mapped));
+  BTOR_RELEASE_STACK (mapped);
+  BTOR_RELEASE_STACK (sweeper.nodes);
+  BTOR_DELETEN (mm, sweeper.sims, n * BTOR_AIG_SWEEP_STRIDE);
+  btor_hashint_map_delete (classes);
+  btor_hashint_map_delete (sweeper.idx);
+  btor_hashint_map_delete (sweeper.lits);
+  btor_sat_mgr_delete (sweeper.smgr);
+
+  amgr->num_sweep_checks += sweeper.checks;
+  amgr->num_sweep_merged += sweeper.merged;
+  BTOR_MSG (btor->msg,
+            1,
+            "SAT sweeping: %zu AIGs, %u merged, %u SAT checks in %.2f seconds",
+            n,
+            sweeper.merged,
+            sweeper.checks,
+            btor_util_time_stamp () - start);
+}
@@ -0,0 +1,29 @@
+/*  Boolector: Satisfiability Modulo Theories (SMT) solver.
+ *
+ *  Copyright (C) 2020 Aina Niemetz.
+ *  Copyright (C) 2020 Mathias Preiner.
+ *
+ *  This file is part of Boolector.
+ *  See COPYING for more information on using this software.
+ */
+
+#ifndef BTORAIGSWEEP_H_INCLUDED
+#define BTORAIGSWEEP_H_INCLUDED
+
+#include "btoraig.h"
+
+/* SAT sweeping (functionally reduced AIGs).
+ *
+ * Merges functionally equivalent AIGs in the cones of the given roots.
+ * Candidate pairs of equivalent (or constant) AIGs are determined by random
+ * simulation of 64 input patterns per machine word and proven with
+ * incremental SAT calls on a separate SAT manager.  The cones are rebuilt
+ * bottom-up, where every AIG proven equivalent to a representative is
+ * replaced by this representative.
+ *
+ * The roots on the stack are replaced by their swept counterparts, the
+ * references to the original roots are released.
+ */
+void btor_aig_sweep (BtorAIGMgr *amgr, BtorAIGPtrStack *roots);
+
+#endif
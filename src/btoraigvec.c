@@ -588,6 +588,7 @@ mul_aigvec (BtorAIGVecMgr *avmgr, BtorAIGVec *a, BtorAIGVec *b)
       tmp = res->aigs[j];
       cin = cout;
       res->aigs[j] = full_adder (amgr, tmp, and, cin, &cout);
+      avmgr->stats.mul_full_adders += 1;
       btor_aig_release (amgr, and);
       btor_aig_release (amgr, tmp);
       btor_aig_release (amgr, cin);
@@ -598,10 +599,176 @@ mul_aigvec (BtorAIGVecMgr *avmgr, BtorAIGVec *a, BtorAIGVec *b)
   return res;
 }
 
+/* Pop the next input bit of column 'c' for a full or half adder.  Bits of
+ * the current stage are used first, then bits that were already produced in
+ * this stage (only needed for the Dadda reduction). */
+static BtorAIG *
+pop_column_bit (BtorAIGPtrStack *cols, BtorAIGPtrStack *next, uint32_t c)
+{
+  if (!BTOR_EMPTY_STACK (cols[c])) return BTOR_POP_STACK (cols[c]);
+  assert (!BTOR_EMPTY_STACK (next[c]));
+  return BTOR_POP_STACK (next[c]);
+}
+
+/* Reduce the columns of partial products 'cols' with full and half adders
+ * into the columns 'next' of the next stage.  Column 'c' has weight 2^c,
+ * carries out of the most significant column are dropped (modulo 2^width).
+ * The Wallace reduction uses as many full adders as possible, the Dadda
+ * reduction only reduces the height of each column to 'target'. */
+static void
+reduce_columns_aigvec (BtorAIGVecMgr *avmgr,
+                       BtorAIGPtrStack *cols,
+                       BtorAIGPtrStack *next,
+                       uint32_t width,
+                       uint32_t target,
+                       bool wallace)
+{
+  BtorAIGMgr *amgr;
+  BtorAIG *x, *y, *z, *sum, *carry;
+  uint32_t c, height;
+
+  amgr = avmgr->amgr;
+
+  for (c = 0; c < width; c++)
+  {
+    height = BTOR_COUNT_STACK (cols[c]) + BTOR_COUNT_STACK (next[c]);
+    while (wallace ? BTOR_COUNT_STACK (cols[c]) >= 3 : height > target)
+    {
+      x = pop_column_bit (cols, next, c);
+      y = pop_column_bit (cols, next, c);
+      if (wallace || height - target >= 2)
+      {
+        z   = pop_column_bit (cols, next, c);
+        sum = full_adder (amgr, x, y, z, &carry);
+        btor_aig_release (amgr, z);
+        avmgr->stats.mul_full_adders += 1;
+        height -= 2;
+      }
+      else
+      {
+        sum = half_adder (amgr, x, y, &carry);
+        avmgr->stats.mul_half_adders += 1;
+        height -= 1;
+      }
+      btor_aig_release (amgr, x);
+      btor_aig_release (amgr, y);
+      BTOR_PUSH_STACK (next[c], sum);
+      if (c + 1 < width)
+        BTOR_PUSH_STACK (next[c + 1], carry);
+      else
+        btor_aig_release (amgr, carry);
+    }
+    while (!BTOR_EMPTY_STACK (cols[c]))
+      BTOR_PUSH_STACK (next[c], BTOR_POP_STACK (cols[c]));
+  }
+}
+
+/* Tree multiplier: all partial products are generated first and sorted into
+ * columns of equal weight, which are then reduced with a Wallace or Dadda
+ * tree to two rows that are summed up with a ripple-carry adder.  The depth
+ * of the resulting circuit is logarithmic in the width for the reduction
+ * (instead of linear as for the array multiplier). */
+static BtorAIGVec *
+mul_tree_aigvec (BtorAIGVecMgr *avmgr,
+                 BtorAIGVec *a,
+                 BtorAIGVec *b,
+                 BtorOptMulEnc enc)
+{
+  BtorMemMgr *mm;
+  BtorAIGMgr *amgr;
+  BtorAIGVec *res;
+  BtorAIGPtrStack *cols, *next, *tmp;
+  BtorAIG *pp, *x, *y, *cin, *cout;
+  uint32_t i, j, c, width, max_height, target;
+
+  width = a->width;
+  mm    = avmgr->btor->mm;
+  amgr  = avmgr->amgr;
+
+  assert (width > 0);
+  assert (width == b->width);
+  assert (enc != BTOR_MUL_ENC_ARRAY);
+
+  if (btor_opt_get (avmgr->btor, BTOR_OPT_SORT_AIGVEC) > 0
+      && compare_aigvec_lsb_first (a, b) > 0)
+  {
+    BTOR_SWAP (BtorAIGVec *, a, b);
+  }
+
+  BTOR_NEWN (mm, cols, width);
+  BTOR_NEWN (mm, next, width);
+  for (c = 0; c < width; c++)
+  {
+    BTOR_INIT_STACK (mm, cols[c]);
+    BTOR_INIT_STACK (mm, next[c]);
+  }
+
+  /* partial products a_i * b_j with i + j < width (MSB is at index 0) */
+  for (i = 0; i < width; i++)
+    for (j = 0; i + j < width; j++)
+    {
+      pp = btor_aig_and (amgr, a->aigs[width - 1 - i], b->aigs[width - 1 - j]);
+      if (enc == BTOR_MUL_ENC_SPARSE && pp == BTOR_AIG_FALSE)
+      {
+        avmgr->stats.mul_pps_dropped += 1;
+        continue;
+      }
+      BTOR_PUSH_STACK (cols[i + j], pp);
+    }
+
+  for (;;)
+  {
+    for (c = 0, max_height = 0; c < width; c++)
+      if (BTOR_COUNT_STACK (cols[c]) > max_height)
+        max_height = BTOR_COUNT_STACK (cols[c]);
+    if (max_height <= 2) break;
+    /* Dadda: largest d_k < max_height with d_1 = 2, d_k+1 = floor(1.5 d_k) */
+    for (target = 2; target * 3 / 2 < max_height; target = target * 3 / 2)
+      ;
+    reduce_columns_aigvec (
+        avmgr, cols, next, width, target, enc == BTOR_MUL_ENC_WALLACE);
+    tmp  = cols;
+    cols = next;
+    next = tmp;
+  }
+
+  res  = new_aigvec (avmgr, width);
+  cout = cin = BTOR_AIG_FALSE; /* for 'cout' to avoid warning */
+  for (c = 0; c < width; c++)
+  {
+    x = BTOR_EMPTY_STACK (cols[c]) ? BTOR_AIG_FALSE : BTOR_POP_STACK (cols[c]);
+    y = BTOR_EMPTY_STACK (cols[c]) ? BTOR_AIG_FALSE : BTOR_POP_STACK (cols[c]);
+    res->aigs[width - 1 - c] = full_adder (amgr, x, y, cin, &cout);
+    avmgr->stats.mul_full_adders += 1;
+    btor_aig_release (amgr, x);
+    btor_aig_release (amgr, y);
+    btor_aig_release (amgr, cin);
+    cin = cout;
+  }
+  btor_aig_release (amgr, cout);
+
+  for (c = 0; c < width; c++)
+  {
+    assert (BTOR_EMPTY_STACK (cols[c]));
+    assert (BTOR_EMPTY_STACK (next[c]));
+    BTOR_RELEASE_STACK (cols[c]);
+    BTOR_RELEASE_STACK (next[c]);
+  }
+  BTOR_DELETEN (mm, cols, width);
+  BTOR_DELETEN (mm, next, width);
+
+  return res;
+}
+
 BtorAIGVec *
 btor_aigvec_mul (BtorAIGVecMgr *avmgr, BtorAIGVec *a, BtorAIGVec *b)
 {
-  return mul_aigvec (avmgr, a, b);
+  BtorOptMulEnc enc;
+
+  enc = btor_opt_get (avmgr->btor, BTOR_OPT_MUL_ENC);
+  avmgr->stats.muls[enc] += 1;
+  if (enc == BTOR_MUL_ENC_ARRAY) return mul_aigvec (avmgr, a, b);
+  return mul_tree_aigvec (avmgr, a, b, enc);
 }
 
 static void
@@ -910,6 +1077,7 @@ btor_aigvec_mgr_clone (Btor *btor, BtorAIGVecMgr *avmgr)
   res->amgr            = btor_aig_mgr_clone (btor, avmgr->amgr);
   res->max_num_aigvecs = avmgr->max_num_aigvecs;
   res->cur_num_aigvecs = avmgr->cur_num_aigvecs;
+  res->stats           = avmgr->stats;
   return res;
 }
 
@@ -38,6 +38,13 @@ struct BtorAIGVecMgr
   BtorAIGMgr *amgr;
   uint_least64_t max_num_aigvecs;
   uint_least64_t cur_num_aigvecs;
+  struct
+  {
+    uint_least64_t muls[BTOR_MUL_ENC_MAX + 1]; /* multipliers per encoding */
+    uint_least64_t mul_full_adders;
+    uint_least64_t mul_half_adders;
+    uint_least64_t mul_pps_dropped; /* zero partial products dropped */
+  } stats;
 };
 
 /*------------------------------------------------------------------------*/
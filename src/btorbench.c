@@ -0,0 +1,795 @@
+/*  Boolector: Satisfiability Modulo Theories (SMT) solver.
+ *
+ *  Copyright (C) 2020 Aina Niemetz.
+ *  Copyright (C) 2020 Mathias Preiner.
+ *
+ *  This file is part of Boolector.
+ *  See COPYING for more information on using this software.
+ */
+
+#include <assert.h>
+#include <ctype.h>
+#include <dirent.h>
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "boolector.h"
+#include "btorcore.h"
+#include "btoropt.h"
+#include "btorsat.h"
+#include "utils/btorhashptr.h"
+#include "utils/btormem.h"
+#include "utils/btorstack.h"
+
+/*------------------------------------------------------------------------*/
+
+#define BTORBENCH_USAGE                                                       \
+  "usage: btorbench [ <option> ... ] <file or directory> ...\n"               \
+  "\n"                                                                        \
+  "Runs all .smt2, .smt, .btor and .btor2 files (directories are searched\n" \
+  "recursively) through Boolector and reports the result and the time\n"      \
+  "spent in each solving phase as CSV or JSON.\n"                             \
+  "\n"                                                                        \
+  "where <option> is one of the following:\n"                                 \
+  "\n"                                                                        \
+  "  -h, --help                 print this message and exit\n"                \
+  "  -v, --verbose              print progress to stderr\n"                   \
+  "  --csv                      print results as CSV (default)\n"             \
+  "  --json                     print results as JSON\n"                      \
+  "  -o <file>                  write results to <file>\n"                    \
+  "  -t <seconds>               time limit per benchmark run\n"               \
+  "  -r <runs>                  number of runs per benchmark (default: 1)\n"  \
+  "  -c <options>               add configuration, <options> is a list of\n"  \
+  "                             boolector options separated by spaces\n"      \
+  "                             (e.g. -c '--engine=prop --seed=2')\n"         \
+  "  --<btoropt>[=<val>]        set boolector option for all configurations\n" \
+  "  --no-<btoropt>             disable boolector option\n"                   \
+  "\n"                                                                        \
+  "Each benchmark is run once (per run) for every configuration given via\n"  \
+  "'-c' (or with the default configuration if no configuration is given).\n"  \
+  "Reported phases (in seconds of process time) are parse, rewrite,\n"        \
+  "simplify, bit-blast, sat (pure SAT solving), solve (total time in\n"       \
+  "the solver) and model generation.  All phases except 'parse' are only\n"   \
+  "available if Boolector was compiled with time statistics, otherwise\n"     \
+  "'parse' includes the time for 'check-sat' commands of SMT-LIB scripts.\n"  \
+  "Peak memory is the maximum number of bytes allocated by Boolector\n"       \
+  "(including the SAT solver) in MB.\n"
+
+/*------------------------------------------------------------------------*/
+
+struct BtorBenchOpt
+{
+  BtorOption opt;
+  uint32_t val;
+};
+
+typedef struct BtorBenchOpt BtorBenchOpt;
+
+BTOR_DECLARE_STACK (BtorBenchOpt, BtorBenchOpt);
+
+struct BtorBenchConfig
+{
+  char *name;
+  BtorBenchOptStack opts;
+};
+
+typedef struct BtorBenchConfig BtorBenchConfig;
+
+BTOR_DECLARE_STACK (BtorBenchConfigPtr, BtorBenchConfig *);
+
+struct BtorBenchResult
+{
+  const char *file;
+  const char *config;
+  uint32_t run;
+  const char *status;   /* sat, unsat, unknown, timeout, error */
+  const char *expected; /* status of the benchmark (if given) */
+  double wall;
+  double cpu;
+  double parse;
+  double rewrite;
+  double simplify;
+  double bitblast;
+  double sat;
+  double solve;
+  double model_gen;
+  double peak_mem;
+};
+
+typedef struct BtorBenchResult BtorBenchResult;
+
+struct BtorBench
+{
+  BtorMemMgr *mm;
+  BtorCharPtrStack files;
+  BtorBenchConfigPtrStack configs;
+  BtorBenchOptStack opts; /* options for all configurations */
+  uint32_t runs;
+  double time_limit;
+  double deadline; /* wall clock time limit of current run */
+  bool timeout;    /* current run hit the time limit */
+  bool json;
+  bool verbose;
+  FILE *out;
+  FILE *devnull;
+  uint32_t nresults;
+};
+
+typedef struct BtorBench BtorBench;
+
+static BtorBench *g_bench;
+
+/*------------------------------------------------------------------------*/
+
+static void
+btorbench_error (char *msg, ...)
+{
+  va_list list;
+  va_start (list, msg);
+  fputs ("btorbench: ", stderr);
+  vfprintf (stderr, msg, list);
+  fprintf (stderr, "\n");
+  va_end (list);
+  exit (1);
+}
+
+static void
+btorbench_msg (char *msg, ...)
+{
+  va_list list;
+  if (!g_bench->verbose) return;
+  va_start (list, msg);
+  fputs ("[btorbench] ", stderr);
+  vfprintf (stderr, msg, list);
+  fprintf (stderr, "\n");
+  fflush (stderr);
+  va_end (list);
+}
+
+/*------------------------------------------------------------------------*/
+
+/* Note: the timers of the library are only enabled if compiled with time
+ *       statistics, the benchmark harness always measures time itself. */
+
+static double
+wall_time (void)
+{
+  struct timeval tv;
+  if (gettimeofday (&tv, 0)) return 0;
+  return tv.tv_sec + 1e-6 * tv.tv_usec;
+}
+
+static double
+cpu_time (void)
+{
+  double res = 0;
+  struct rusage u;
+  if (!getrusage (RUSAGE_SELF, &u))
+  {
+    res += u.ru_utime.tv_sec + 1e-6 * u.ru_utime.tv_usec;
+    res += u.ru_stime.tv_sec + 1e-6 * u.ru_stime.tv_usec;
+  }
+  return res;
+}
+
+static bool
+has_time_stats (void)
+{
+#ifdef BTOR_TIME_STATISTICS
+  return true;
+#else
+  return false;
+#endif
+}
+
+/*------------------------------------------------------------------------*/
+
+static BtorBench *
+btorbench_new (void)
+{
+  BtorMemMgr *mm;
+  BtorBench *bench;
+
+  mm = btor_mem_mgr_new ();
+  BTOR_CNEW (mm, bench);
+  bench->mm   = mm;
+  bench->runs = 1;
+  bench->out  = stdout;
+  BTOR_INIT_STACK (mm, bench->files);
+  BTOR_INIT_STACK (mm, bench->configs);
+  BTOR_INIT_STACK (mm, bench->opts);
+  return bench;
+}
+
+static void
+btorbench_delete (BtorBench *bench)
+{
+  BtorMemMgr *mm;
+  BtorBenchConfig *config;
+
+  mm = bench->mm;
+  while (!BTOR_EMPTY_STACK (bench->files))
+    btor_mem_freestr (mm, BTOR_POP_STACK (bench->files));
+  BTOR_RELEASE_STACK (bench->files);
+  while (!BTOR_EMPTY_STACK (bench->configs))
+  {
+    config = BTOR_POP_STACK (bench->configs);
+    btor_mem_freestr (mm, config->name);
+    BTOR_RELEASE_STACK (config->opts);
+    BTOR_DELETE (mm, config);
+  }
+  BTOR_RELEASE_STACK (bench->configs);
+  BTOR_RELEASE_STACK (bench->opts);
+  if (bench->out != stdout) fclose (bench->out);
+  if (bench->devnull) fclose (bench->devnull);
+  BTOR_DELETE (mm, bench);
+  btor_mem_mgr_delete (mm);
+}
+
+/*------------------------------------------------------------------------*/
+
+/* Parse boolector option of the form --<lng>[=<val>], -<shrt>[=<val>] or
+ * --no-<lng> and add it to 'opts'. */
+static void
+parse_btor_opt (Btor *btor, const char *arg, BtorBenchOptStack *opts)
+{
+  BtorOption o;
+  BtorOpt *bo;
+  BtorBenchOpt bopt;
+  BtorPtrHashBucket *b;
+  const char *name, *val, *lng, *shrt;
+  char *end;
+  size_t len;
+  bool disable;
+  uint64_t v;
+
+  name = arg;
+  while (*name == '-') name++;
+  disable = !strncmp (name, "no-", 3);
+  if (disable) name += 3;
+  val = strchr (name, '=');
+  len = val ? (size_t) (val - name) : strlen (name);
+  if (val) val += 1;
+
+  for (o = btor_opt_first (btor); o < BTOR_OPT_NUM_OPTS;
+       o = btor_opt_next (btor, o))
+  {
+    lng  = btor_opt_get_lng (btor, o);
+    shrt = btor_opt_get_shrt (btor, o);
+    if ((strlen (lng) == len && !strncmp (lng, name, len))
+        || (shrt && strlen (shrt) == len && !strncmp (shrt, name, len)))
+      break;
+  }
+  if (o == BTOR_OPT_NUM_OPTS)
+    btorbench_error ("invalid option '%s' (try '-h')", arg);
+
+  bo = &btor->options[o];
+  if (disable)
+  {
+    if (val) btorbench_error ("unexpected argument to '%s'", arg);
+    v = 0;
+  }
+  else if (!val)
+    v = 1;
+  else if (bo->options && (b = btor_hashptr_table_get (bo->options, val)))
+    v = ((BtorOptHelp *) b->data.as_ptr)->val;
+  else
+  {
+    v = strtoull (val, &end, 10);
+    if (!*val || *end) btorbench_error ("invalid argument to '%s'", arg);
+  }
+  if (v < bo->min || v > bo->max)
+    btorbench_error ("argument to '%s' out of range", arg);
+
+  bopt.opt = o;
+  bopt.val = (uint32_t) v;
+  BTOR_PUSH_STACK (*opts, bopt);
+}
+
+static void
+add_config (BtorBench *bench, Btor *btor, const char *str)
+{
+  BtorBenchConfig *config;
+  char *opts, *tok;
+
+  BTOR_NEW (bench->mm, config);
+  config->name = btor_mem_strdup (bench->mm, str);
+  BTOR_INIT_STACK (bench->mm, config->opts);
+
+  opts = btor_mem_strdup (bench->mm, str);
+  for (tok = strtok (opts, " \t"); tok; tok = strtok (0, " \t"))
+    parse_btor_opt (btor, tok, &config->opts);
+  btor_mem_freestr (bench->mm, opts);
+
+  BTOR_PUSH_STACK (bench->configs, config);
+}
+
+/*------------------------------------------------------------------------*/
+
+static bool
+has_suffix (const char *str, const char *suffix)
+{
+  size_t len, slen;
+
+  len  = strlen (str);
+  slen = strlen (suffix);
+  return len >= slen && !strcmp (str + len - slen, suffix);
+}
+
+static bool
+is_benchmark (const char *path)
+{
+  return has_suffix (path, ".smt2") || has_suffix (path, ".smt")
+         || has_suffix (path, ".btor") || has_suffix (path, ".btor2");
+}
+
+static int32_t
+cmp_str (const void *p1, const void *p2)
+{
+  return strcmp (*(char **) p1, *(char **) p2);
+}
+
+static void
+collect_files (BtorBench *bench, const char *path, bool explicit)
+{
+  DIR *dir;
+  struct dirent *de;
+  struct stat st;
+  BtorCharPtrStack entries;
+  char *entry;
+  size_t len;
+  uint32_t i;
+
+  if (stat (path, &st)) btorbench_error ("can not access '%s'", path);
+
+  if (!S_ISDIR (st.st_mode))
+  {
+    if (explicit || is_benchmark (path))
+      BTOR_PUSH_STACK (bench->files, btor_mem_strdup (bench->mm, path));
+    return;
+  }
+
+  if (!(dir = opendir (path))) btorbench_error ("can not open '%s'", path);
+  BTOR_INIT_STACK (bench->mm, entries);
+  while ((de = readdir (dir)))
+  {
+    if (de->d_name[0] == '.') continue;
+    len = strlen (path) + strlen (de->d_name) + 2;
+    BTOR_NEWN (bench->mm, entry, len);
+    sprintf (entry, "%s/%s", path, de->d_name);
+    BTOR_PUSH_STACK (entries, entry);
+  }
+  closedir (dir);
+
+  /* sort entries for a reproducible order of the benchmarks */
+  qsort (entries.start, BTOR_COUNT_STACK (entries), sizeof (char *), cmp_str);
+  for (i = 0; i < BTOR_COUNT_STACK (entries); i++)
+  {
+    entry = BTOR_PEEK_STACK (entries, i);
+    collect_files (bench, entry, false);
+    btor_mem_freestr (bench->mm, entry);
+  }
+  BTOR_RELEASE_STACK (entries);
+}
+
+/*------------------------------------------------------------------------*/
+
+static int32_t
+terminate_bench (void *state)
+{
+  BtorBench *bench = (BtorBench *) state;
+
+  if (bench->timeout) return 1;
+  if (bench->deadline > 0 && wall_time () >= bench->deadline)
+    bench->timeout = true;
+  return bench->timeout;
+}
+
+static const char *
+status_to_str (int32_t status)
+{
+  switch (status)
+  {
+    case BOOLECTOR_SAT: return "sat";
+    case BOOLECTOR_UNSAT: return "unsat";
+    default: return "unknown";
+  }
+}
+
+/* Solve benchmark 'file', called in the child process of a run. */
+static void
+solve_benchmark (BtorBench *bench,
+                 const char *file,
+                 BtorBenchConfig *config,
+                 BtorBenchResult *result)
+{
+  uint32_t i;
+  int32_t res, status;
+  bool parsed_smt2;
+  double wall, cpu;
+  char *error_msg;
+  FILE *infile;
+  Btor *btor;
+  BtorSATMgr *smgr;
+
+  if (!(infile = fopen (file, "r")))
+  {
+    btorbench_msg ("can not read '%s'", file);
+    return;
+  }
+
+  btor = boolector_new ();
+  for (i = 0; i < BTOR_COUNT_STACK (bench->opts); i++)
+    boolector_set_opt (
+        btor, bench->opts.start[i].opt, bench->opts.start[i].val);
+  if (config)
+  {
+    for (i = 0; i < BTOR_COUNT_STACK (config->opts); i++)
+      boolector_set_opt (
+          btor, config->opts.start[i].opt, config->opts.start[i].val);
+  }
+  boolector_set_term (btor, terminate_bench, bench);
+
+  wall            = wall_time ();
+  cpu             = cpu_time ();
+  bench->timeout  = false;
+  bench->deadline = bench->time_limit > 0 ? wall + bench->time_limit : 0;
+
+  status      = BOOLECTOR_UNKNOWN;
+  parsed_smt2 = false;
+  res         = boolector_parse (btor,
+                         infile,
+                         file,
+                         bench->devnull,
+                         &error_msg,
+                         &status,
+                         &parsed_smt2);
+  /* time spent in 'check-sat' commands is not part of parsing */
+  result->parse = cpu_time () - cpu - btor->time.sat;
+  fclose (infile);
+
+  if (res == BOOLECTOR_PARSE_ERROR)
+  {
+    btorbench_msg ("%s", error_msg);
+  }
+  else
+  {
+    if (res == BOOLECTOR_PARSE_UNKNOWN && !parsed_smt2
+        && !boolector_terminate (btor))
+      res = boolector_sat (btor);
+    result->status = bench->timeout && res != BOOLECTOR_SAT
+                             && res != BOOLECTOR_UNSAT
+                         ? "timeout"
+                         : status_to_str (res);
+  }
+
+  result->cpu       = cpu_time () - cpu;
+  result->expected  = status_to_str (status);
+  result->rewrite   = btor->time.rewrite;
+  result->simplify  = btor->time.simplify;
+  result->bitblast  = btor->time.synth_exp;
+  result->solve     = btor->time.sat;
+  result->model_gen = btor->time.model_gen;
+  smgr              = btor_get_sat_mgr (btor);
+  result->sat       = smgr ? smgr->sat_time : 0;
+  result->peak_mem =
+      (btor->mm->maxallocated + btor->mm->sat_maxallocated) / (double) (1 << 20);
+
+  boolector_delete (btor);
+}
+
+/* Each run is executed in a separate process.  Not all phases of the solver
+ * check the termination callback, the run is killed if it does not finish
+ * within one second after the time limit.  Crashes and aborts of the library
+ * (e.g., 'push' without incremental usage enabled) are reported as 'error'. */
+static void
+run_benchmark (BtorBench *bench,
+               const char *file,
+               BtorBenchConfig *config,
+               uint32_t run,
+               BtorBenchResult *result)
+{
+  int32_t fds[2], wstatus;
+  pid_t pid;
+  double wall;
+  ssize_t n;
+  struct rusage u;
+
+  BTOR_CLR (result);
+  result->file     = file;
+  result->config   = config ? config->name : "";
+  result->run      = run;
+  result->status   = "error";
+  result->expected = "unknown";
+
+  fflush (bench->out);
+  fflush (stderr);
+  if (pipe (fds)) btorbench_error ("can not create pipe");
+
+  wall = wall_time ();
+  if (!(pid = fork ()))
+  {
+    close (fds[0]);
+    solve_benchmark (bench, file, config, result);
+    if (write (fds[1], result, sizeof *result) != sizeof *result) _exit (1);
+    _exit (0);
+  }
+  close (fds[1]);
+  if (pid < 0) btorbench_error ("can not fork");
+
+  while (!wait4 (pid, &wstatus, WNOHANG, &u))
+  {
+    if (bench->time_limit > 0 && wall_time () - wall > bench->time_limit + 1)
+    {
+      kill (pid, SIGKILL);
+      wait4 (pid, &wstatus, 0, &u);
+      result->status = "timeout";
+      break;
+    }
+    usleep (1000);
+  }
+
+  /* the result struct only contains pointers to static strings and strings
+   * of 'bench', which are valid in both processes */
+  n = read (fds[0], result, sizeof *result);
+  close (fds[0]);
+  if (n != sizeof *result)
+  {
+    result->cpu = u.ru_utime.tv_sec + 1e-6 * u.ru_utime.tv_usec
+                  + u.ru_stime.tv_sec + 1e-6 * u.ru_stime.tv_usec;
+    if (!strcmp (result->status, "error"))
+      btorbench_msg ("run of '%s' did not terminate normally", file);
+  }
+  result->wall = wall_time () - wall;
+}
+
+/*------------------------------------------------------------------------*/
+
+static void
+print_header (BtorBench *bench)
+{
+  if (bench->json)
+  {
+    fprintf (bench->out, "{\n");
+    fprintf (bench->out,
+             "  \"time_stats\": %s,\n",
+             has_time_stats () ? "true" : "false");
+    fprintf (bench->out, "  \"results\": [");
+  }
+  else
+  {
+    fprintf (bench->out,
+             "file,config,run,status,expected,wall,cpu,parse,rewrite,"
+             "simplify,bitblast,sat,solve,model_gen,peak_mem_mb\n");
+  }
+}
+
+static void
+print_footer (BtorBench *bench)
+{
+  if (bench->json) fprintf (bench->out, "\n  ]\n}\n");
+}
+
+static void
+print_json_str (FILE *out, const char *str)
+{
+  const char *p;
+
+  fputc ('"', out);
+  for (p = str; *p; p++)
+  {
+    if (*p == '"' || *p == '\\')
+      fprintf (out, "\\%c", *p);
+    else if ((unsigned char) *p < 0x20)
+      fprintf (out, "\\u%04x", (unsigned char) *p);
+    else
+      fputc (*p, out);
+  }
+  fputc ('"', out);
+}
+
+static void
+print_csv_str (FILE *out, const char *str)
+{
+  const char *p;
+
+  if (!strpbrk (str, ",\"\n"))
+  {
+    fputs (str, out);
+    return;
+  }
+  fputc ('"', out);
+  for (p = str; *p; p++)
+  {
+    if (*p == '"') fputc ('"', out);
+    fputc (*p, out);
+  }
+  fputc ('"', out);
+}
+
+static void
+print_result (BtorBench *bench, BtorBenchResult *r)
+{
+  FILE *out = bench->out;
+
+  if (bench->json)
+  {
+    fprintf (out, "%s\n    {\"file\": ", bench->nresults ? "," : "");
+    print_json_str (out, r->file);
+    fprintf (out, ", \"config\": ");
+    print_json_str (out, r->config);
+    fprintf (out,
+             ", \"run\": %u, \"status\": \"%s\", \"expected\": \"%s\", "
+             "\"wall\": %.3f, \"cpu\": %.3f, \"parse\": %.3f, "
+             "\"rewrite\": %.3f, \"simplify\": %.3f, \"bitblast\": %.3f, "
+             "\"sat\": %.3f, \"solve\": %.3f, \"model_gen\": %.3f, "
+             "\"peak_mem_mb\": %.1f}",
+             r->run,
+             r->status,
+             r->expected,
+             r->wall,
+             r->cpu,
+             r->parse,
+             r->rewrite,
+             r->simplify,
+             r->bitblast,
+             r->sat,
+             r->solve,
+             r->model_gen,
+             r->peak_mem);
+  }
+  else
+  {
+    print_csv_str (out, r->file);
+    fputc (',', out);
+    print_csv_str (out, r->config);
+    fprintf (out,
+             ",%u,%s,%s,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.1f\n",
+             r->run,
+             r->status,
+             r->expected,
+             r->wall,
+             r->cpu,
+             r->parse,
+             r->rewrite,
+             r->simplify,
+             r->bitblast,
+             r->sat,
+             r->solve,
+             r->model_gen,
+             r->peak_mem);
+  }
+  fflush (out);
+  bench->nresults += 1;
+}
+
+/*------------------------------------------------------------------------*/
+
+int32_t
+main (int32_t argc, char **argv)
+{
+  int32_t i;
+  uint32_t j, k, l, nconfigs, nmismatch;
+  char *end;
+  const char *file;
+  Btor *tmpbtor;
+  BtorBenchConfig *config;
+  BtorBenchResult result;
+  BtorCharPtrStack paths;
+
+  g_bench = btorbench_new ();
+  tmpbtor = boolector_new ();
+  BTOR_INIT_STACK (g_bench->mm, paths);
+
+  for (i = 1; i < argc; i++)
+  {
+    if (!strcmp (argv[i], "-h") || !strcmp (argv[i], "--help"))
+    {
+      printf ("%s", BTORBENCH_USAGE);
+      exit (0);
+    }
+    else if (!strcmp (argv[i], "-v") || !strcmp (argv[i], "--verbose"))
+      g_bench->verbose = true;
+    else if (!strcmp (argv[i], "--csv"))
+      g_bench->json = false;
+    else if (!strcmp (argv[i], "--json"))
+      g_bench->json = true;
+    else if (!strcmp (argv[i], "-o"))
+    {
+      if (++i == argc) btorbench_error ("argument to '-o' missing");
+      if (g_bench->out != stdout) fclose (g_bench->out);
+      if (!(g_bench->out = fopen (argv[i], "w")))
+        btorbench_error ("can not write '%s'", argv[i]);
+    }
+    else if (!strcmp (argv[i], "-t"))
+    {
+      if (++i == argc) btorbench_error ("argument to '-t' missing");
+      g_bench->time_limit = strtod (argv[i], &end);
+      if (*end || g_bench->time_limit < 0)
+        btorbench_error ("invalid argument to '-t'");
+    }
+    else if (!strcmp (argv[i], "-r"))
+    {
+      if (++i == argc) btorbench_error ("argument to '-r' missing");
+      g_bench->runs = (uint32_t) strtoul (argv[i], &end, 10);
+      if (*end || !g_bench->runs) btorbench_error ("invalid argument to '-r'");
+    }
+    else if (!strcmp (argv[i], "-c"))
+    {
+      if (++i == argc) btorbench_error ("argument to '-c' missing");
+      add_config (g_bench, tmpbtor, argv[i]);
+    }
+    else if (argv[i][0] == '-')
+      parse_btor_opt (tmpbtor, argv[i], &g_bench->opts);
+    else
+      BTOR_PUSH_STACK (paths, argv[i]);
+  }
+  boolector_delete (tmpbtor);
+
+  if (BTOR_EMPTY_STACK (paths))
+    btorbench_error ("no benchmark file or directory given (try '-h')");
+  for (j = 0; j < BTOR_COUNT_STACK (paths); j++)
+    collect_files (g_bench, BTOR_PEEK_STACK (paths, j), true);
+  BTOR_RELEASE_STACK (paths);
+
+  if (!(g_bench->devnull = fopen ("/dev/null", "w")))
+    btorbench_error ("can not open '/dev/null'");
+
+  if (!has_time_stats ())
+    btorbench_msg (
+        "compiled without time statistics, "
+        "only parse, wall and cpu times are available");
+
+  nconfigs = BTOR_COUNT_STACK (g_bench->configs);
+  btorbench_msg ("%u benchmark(s), %u configuration(s), %u run(s)",
+                 BTOR_COUNT_STACK (g_bench->files),
+                 nconfigs ? nconfigs : 1,
+                 g_bench->runs);
+
+  print_header (g_bench);
+  nmismatch = 0;
+  for (j = 0; j < BTOR_COUNT_STACK (g_bench->files); j++)
+  {
+    file = BTOR_PEEK_STACK (g_bench->files, j);
+    for (k = 0; k < (nconfigs ? nconfigs : 1); k++)
+    {
+      config = nconfigs ? BTOR_PEEK_STACK (g_bench->configs, k) : 0;
+      for (l = 0; l < g_bench->runs; l++)
+      {
+        run_benchmark (g_bench, file, config, l, &result);
+        btorbench_msg ("%s [%s] run %u: %s in %.2f seconds",
+                       file,
+                       result.config,
+                       l,
+                       result.status,
+                       result.wall);
+        if ((!strcmp (result.status, "sat")
+             && !strcmp (result.expected, "unsat"))
+            || (!strcmp (result.status, "unsat")
+                && !strcmp (result.expected, "sat")))
+        {
+          fprintf (stderr,
+                   "btorbench: '%s' but status of benchmark '%s' is '%s'\n",
+                   result.status,
+                   file,
+                   result.expected);
+          nmismatch += 1;
+        }
+        print_result (g_bench, &result);
+      }
+    }
+  }
+  print_footer (g_bench);
+
+  btorbench_delete (g_bench);
+  return nmismatch ? 1 : 0;
+}
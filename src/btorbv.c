@@ -67,6 +67,69 @@ set_rem_bits_to_zero (BtorBitVector *bv)
   if (bv->width != BTOR_BV_TYPE_BW * bv->len)
     bv->bits[0] &= BTOR_MASK_REM_BITS (bv);
 }
+
+/*------------------------------------------------------------------------*/
+
+/* Bit-vectors of width <= 64 fit into a single 64-bit word. These are
+ * allocated from the slab pools of the memory manager, and all operations on
+ * them are performed on the word directly (no chunk loops). */
+#define BTOR_BV_IS_WORD(bv) ((bv)->width <= 64)
+
+static inline uint64_t
+bv_word_mask (uint32_t bw)
+{
+  assert (bw > 0);
+  assert (bw <= 64);
+  return UINT64_MAX >> (64 - bw);
+}
+
+static inline uint64_t
+bv_get_word (const BtorBitVector *bv)
+{
+  assert (BTOR_BV_IS_WORD (bv));
+  assert (bv->len == 1 || bv->len == 2);
+  if (bv->len == 1) return bv->bits[0];
+  return ((uint64_t) bv->bits[0] << BTOR_BV_TYPE_BW) | bv->bits[1];
+}
+
+static inline void
+bv_set_word (BtorBitVector *bv, uint64_t value)
+{
+  assert (BTOR_BV_IS_WORD (bv));
+  value &= bv_word_mask (bv->width);
+  if (bv->len == 1)
+  {
+    bv->bits[0] = (BTOR_BV_TYPE) value;
+  }
+  else
+  {
+    assert (bv->len == 2);
+    bv->bits[0] = (BTOR_BV_TYPE) (value >> BTOR_BV_TYPE_BW);
+    bv->bits[1] = (BTOR_BV_TYPE) value;
+  }
+}
+
+/* Create a new bit-vector of given bit-width <= 64 from given word, bits
+ * beyond the bit-width are discarded. */
+static BtorBitVector *
+new_word_bv (BtorMemMgr *mm, uint64_t value, uint32_t bw)
+{
+  BtorBitVector *res;
+  assert (bw <= 64);
+  res = btor_mem_slab_malloc (
+      mm, sizeof (BtorBitVector) + sizeof (BTOR_BV_TYPE) * (bw > 32 ? 2 : 1));
+  res->width = bw;
+  res->len   = bw > 32 ? 2 : 1;
+  bv_set_word (res, value);
+  return res;
+}
+
+/* Create a new bit-vector of width 1 representing given Boolean value. */
+static inline BtorBitVector *
+new_bool_bv (BtorMemMgr *mm, bool value)
+{
+  return new_word_bv (mm, value ? 1 : 0, 1);
+}
 #endif
 
 #ifndef NDEBUG
@@ -116,6 +179,7 @@ btor_bv_new (BtorMemMgr *mm, uint32_t bw)
   if (bw % BTOR_BV_TYPE_BW > 0) i += 1;
 
   assert (i > 0);
+  if (bw <= 64) return new_word_bv (mm, 0, bw);
   res =
       btor_mem_malloc (mm, sizeof (BtorBitVector) + sizeof (BTOR_BV_TYPE) * i);
   BTOR_CLRN (res->bits, i);
@@ -263,11 +327,11 @@ btor_bv_uint64_to_bv (BtorMemMgr *mm, uint64_t value, uint32_t bw)
   mpz_init_set_ui (res->val, value);
   mpz_fdiv_r_2exp (res->val, res->val, bw);
 #else
+  if (bw <= 64) return new_word_bv (mm, value, bw);
   res = btor_bv_new (mm, bw);
   assert (res->len > 0);
   res->bits[res->len - 1] = (BTOR_BV_TYPE) value;
-  if (res->width > 32)
-    res->bits[res->len - 2] = (BTOR_BV_TYPE) (value >> BTOR_BV_TYPE_BW);
+  res->bits[res->len - 2] = (BTOR_BV_TYPE) (value >> BTOR_BV_TYPE_BW);
 
   set_rem_bits_to_zero (res);
   assert (rem_bits_zero_dbg (res));
@@ -290,6 +354,7 @@ btor_bv_int64_to_bv (BtorMemMgr *mm, int64_t value, uint32_t bw)
   mpz_fdiv_r_2exp (res->val, res->val, bw);
 #else
   BtorBitVector *tmp;
+  if (bw <= 64) return new_word_bv (mm, (uint64_t) value, bw);
   res = btor_bv_new (mm, bw);
   assert (res->len > 0);
 
@@ -469,11 +534,15 @@ btor_bv_copy (BtorMemMgr *mm, const BtorBitVector *bv)
 
   BtorBitVector *res;
 
+#ifdef BTOR_USE_GMP
   res = btor_bv_new (mm, bv->width);
   assert (res->width == bv->width);
-#ifdef BTOR_USE_GMP
   mpz_set (res->val, bv->val);
 #else
+  if (BTOR_BV_IS_WORD (bv))
+    return new_word_bv (mm, bv_get_word (bv), bv->width);
+  res = btor_bv_new (mm, bv->width);
+  assert (res->width == bv->width);
   assert (res->len == bv->len);
   memcpy (res->bits, bv->bits, sizeof (*(bv->bits)) * bv->len);
 #endif
@@ -506,8 +575,12 @@ btor_bv_free (BtorMemMgr *mm, BtorBitVector *bv)
   mpz_clear (bv->val);
   btor_mem_free (mm, bv, sizeof (BtorBitVector));
 #else
-  btor_mem_free (
-      mm, bv, sizeof (BtorBitVector) + sizeof (BTOR_BV_TYPE) * bv->len);
+  if (BTOR_BV_IS_WORD (bv))
+    btor_mem_slab_free (
+        mm, bv, sizeof (BtorBitVector) + sizeof (BTOR_BV_TYPE) * bv->len);
+  else
+    btor_mem_free (
+        mm, bv, sizeof (BtorBitVector) + sizeof (BTOR_BV_TYPE) * bv->len);
 #endif
 }
 
@@ -522,6 +595,13 @@ btor_bv_compare (const BtorBitVector *a, const BtorBitVector *b)
   return mpz_cmp (a->val, b->val);
 #else
   uint32_t i;
+  uint64_t x, y;
+  if (BTOR_BV_IS_WORD (a))
+  {
+    x = bv_get_word (a);
+    y = bv_get_word (b);
+    return x == y ? 0 : (x > y ? 1 : -1);
+  }
   /* find index on which a and b differ */
   for (i = 0; i < a->len && a->bits[i] == b->bits[i]; i++)
     ;
@@ -824,16 +904,38 @@ btor_bv_to_uint64 (const BtorBitVector *bv)
 #ifdef BTOR_USE_GMP
   res = mpz_get_ui (bv->val);
 #else
-  assert (bv->len <= 2);
-  uint32_t i;
-  res = 0;
-  for (i = 0; i < bv->len; i++)
-    res |= ((uint64_t) bv->bits[i]) << (BTOR_BV_TYPE_BW * (bv->len - 1 - i));
+  res = bv_get_word (bv);
 #endif
 
   return res;
 }
 
+void
+btor_bv_to_words (const BtorBitVector *bv, uint64_t *words)
+{
+  assert (bv);
+  assert (words);
+
+  uint32_t i, n;
+
+  n = (bv->width + 63) / 64;
+#ifdef BTOR_USE_GMP
+  size_t count;
+  mpz_export (words, &count, -1, sizeof (uint64_t), 0, 0, bv->val);
+  assert (count <= n);
+  for (i = count; i < n; i++) words[i] = 0;
+#else
+  int64_t lo, hi;
+  for (i = 0; i < n; i++)
+  {
+    lo       = (int64_t) bv->len - 1 - 2 * i;
+    hi       = lo - 1;
+    words[i] = lo >= 0 ? bv->bits[lo] : 0;
+    if (hi >= 0) words[i] |= (uint64_t) bv->bits[hi] << 32;
+  }
+#endif
+}
+
 /*------------------------------------------------------------------------*/
 
 uint32_t
@@ -951,6 +1053,7 @@ btor_bv_is_zero (const BtorBitVector *bv)
   return mpz_cmp_ui (bv->val, 0) == 0;
 #else
   uint32_t i;
+  if (BTOR_BV_IS_WORD (bv)) return bv_get_word (bv) == 0;
   for (i = 0; i < bv->len; i++)
     if (bv->bits[i] != 0) return false;
   return true;
@@ -982,6 +1085,7 @@ btor_bv_is_ones (const BtorBitVector *bv)
   m = mp_bits_per_limb - bv->width % mp_bits_per_limb;
   return ((uint64_t) limb) == (max >> m);
 #else
+  if (BTOR_BV_IS_WORD (bv)) return bv_get_word (bv) == bv_word_mask (bv->width);
   for (i = bv->len - 1; i >= 1; i--)
   {
     if (bv->bits[i] != UINT32_MAX) return false;
@@ -1002,6 +1106,7 @@ btor_bv_is_one (const BtorBitVector *bv)
   return mpz_cmp_ui (bv->val, 1) == 0;
 #else
   uint32_t i;
+  if (BTOR_BV_IS_WORD (bv)) return bv_get_word (bv) == 1;
   if (bv->bits[bv->len - 1] != 1) return false;
   for (i = 0; i < bv->len - 1; i++)
     if (bv->bits[i] != 0) return false;
@@ -1396,6 +1501,7 @@ btor_bv_neg (BtorMemMgr *mm, const BtorBitVector *bv)
   mpz_fdiv_r_2exp (res->val, res->val, bw);
 #else
   BtorBitVector *not_bv, *one;
+  if (BTOR_BV_IS_WORD (bv)) return new_word_bv (mm, -bv_get_word (bv), bw);
   not_bv = btor_bv_not (mm, bv);
   one    = btor_bv_uint64_to_bv (mm, 1, bw);
   res    = btor_bv_add (mm, not_bv, one);
@@ -1419,6 +1525,7 @@ btor_bv_not (BtorMemMgr *mm, const BtorBitVector *bv)
   mpz_fdiv_r_2exp (res->val, res->val, bw);
 #else
   uint32_t i;
+  if (BTOR_BV_IS_WORD (bv)) return new_word_bv (mm, ~bv_get_word (bv), bw);
   res = btor_bv_new (mm, bw);
   for (i = 0; i < bv->len; i++) res->bits[i] = ~bv->bits[i];
   set_rem_bits_to_zero (res);
@@ -1441,6 +1548,7 @@ btor_bv_inc (BtorMemMgr *mm, const BtorBitVector *bv)
   mpz_fdiv_r_2exp (res->val, res->val, bw);
 #else
   BtorBitVector *one;
+  if (BTOR_BV_IS_WORD (bv)) return new_word_bv (mm, bv_get_word (bv) + 1, bw);
   one = btor_bv_uint64_to_bv (mm, 1, bw);
   res = btor_bv_add (mm, bv, one);
   btor_bv_free (mm, one);
@@ -1462,6 +1570,7 @@ btor_bv_dec (BtorMemMgr *mm, const BtorBitVector *bv)
   mpz_fdiv_r_2exp (res->val, res->val, bw);
 #else
   BtorBitVector *one, *negone;
+  if (BTOR_BV_IS_WORD (bv)) return new_word_bv (mm, bv_get_word (bv) - 1, bw);
   one    = btor_bv_uint64_to_bv (mm, 1, bw);
   negone = btor_bv_neg (mm, one);
   res    = btor_bv_add (mm, bv, negone);
@@ -1485,6 +1594,9 @@ btor_bv_redand (BtorMemMgr *mm, const BtorBitVector *bv)
   uint32_t bit;
   uint32_t mask0;
 
+  if (BTOR_BV_IS_WORD (bv))
+    return new_bool_bv (mm, bv_get_word (bv) == bv_word_mask (bv->width));
+
   res = btor_bv_new (mm, 1);
   assert (rem_bits_zero_dbg (res));
 
@@ -1525,6 +1637,8 @@ btor_bv_redor (BtorMemMgr *mm, const BtorBitVector *bv)
   uint32_t bit;
   BtorBitVector *res;
 
+  if (BTOR_BV_IS_WORD (bv)) return new_bool_bv (mm, bv_get_word (bv) != 0);
+
   res = btor_bv_new (mm, 1);
   assert (rem_bits_zero_dbg (res));
   bit = 0;
@@ -1557,25 +1671,19 @@ btor_bv_add (BtorMemMgr *mm, const BtorBitVector *a, const BtorBitVector *b)
 #else
   assert (a->len == b->len);
   int64_t i;
-  uint64_t x, y, sum;
+  uint64_t sum;
   BTOR_BV_TYPE carry;
 
-  if (bw <= 64)
-  {
-    x   = btor_bv_to_uint64 (a);
-    y   = btor_bv_to_uint64 (b);
-    res = btor_bv_uint64_to_bv (mm, x + y, bw);
-  }
-  else
+  if (BTOR_BV_IS_WORD (a))
+    return new_word_bv (mm, bv_get_word (a) + bv_get_word (b), bw);
+
+  res   = btor_bv_new (mm, bw);
+  carry = 0;
+  for (i = a->len - 1; i >= 0; i--)
   {
-    res   = btor_bv_new (mm, bw);
-    carry = 0;
-    for (i = a->len - 1; i >= 0; i--)
-    {
-      sum          = (uint64_t) a->bits[i] + b->bits[i] + carry;
-      res->bits[i] = (BTOR_BV_TYPE) sum;
-      carry        = (BTOR_BV_TYPE) (sum >> 32);
-    }
+    sum          = (uint64_t) a->bits[i] + b->bits[i] + carry;
+    res->bits[i] = (BTOR_BV_TYPE) sum;
+    carry        = (BTOR_BV_TYPE) (sum >> 32);
   }
 
   set_rem_bits_to_zero (res);
@@ -1602,6 +1710,9 @@ btor_bv_sub (BtorMemMgr *mm, const BtorBitVector *a, const BtorBitVector *b)
   assert (a->len == b->len);
   BtorBitVector *negb;
 
+  if (BTOR_BV_IS_WORD (a))
+    return new_word_bv (mm, bv_get_word (a) - bv_get_word (b), a->width);
+
   negb = btor_bv_neg (mm, b);
   res  = btor_bv_add (mm, a, negb);
   btor_bv_free (mm, negb);
@@ -1627,6 +1738,9 @@ btor_bv_and (BtorMemMgr *mm, const BtorBitVector *a, const BtorBitVector *b)
   assert (a->len == b->len);
   uint32_t i;
 
+  if (BTOR_BV_IS_WORD (a))
+    return new_word_bv (mm, bv_get_word (a) & bv_get_word (b), bw);
+
   res = btor_bv_new (mm, bw);
   for (i = 0; i < a->len; i++) res->bits[i] = a->bits[i] & b->bits[i];
 
@@ -1650,12 +1764,7 @@ btor_bv_implies (BtorMemMgr *mm, const BtorBitVector *a, const BtorBitVector *b)
                                                   : btor_bv_zero (mm, 1);
 #else
   assert (a->len == b->len);
-  uint32_t i;
-
-  res = btor_bv_new (mm, a->width);
-  for (i = 0; i < a->len; i++) res->bits[i] = ~a->bits[i] | b->bits[i];
-
-  set_rem_bits_to_zero (res);
+  res = new_word_bv (mm, ~bv_get_word (a) | bv_get_word (b), a->width);
   assert (rem_bits_zero_dbg (res));
 #endif
   return res;
@@ -1679,6 +1788,9 @@ btor_bv_or (BtorMemMgr *mm, const BtorBitVector *a, const BtorBitVector *b)
   assert (a->len == b->len);
   uint32_t i;
 
+  if (BTOR_BV_IS_WORD (a))
+    return new_word_bv (mm, bv_get_word (a) | bv_get_word (b), bw);
+
   res = btor_bv_new (mm, bw);
   for (i = 0; i < a->len; i++) res->bits[i] = a->bits[i] | b->bits[i];
 
@@ -1706,6 +1818,9 @@ btor_bv_nand (BtorMemMgr *mm, const BtorBitVector *a, const BtorBitVector *b)
   assert (a->len == b->len);
   uint32_t i;
 
+  if (BTOR_BV_IS_WORD (a))
+    return new_word_bv (mm, ~(bv_get_word (a) & bv_get_word (b)), bw);
+
   res = btor_bv_new (mm, bw);
   for (i = 0; i < a->len; i++) res->bits[i] = ~(a->bits[i] & b->bits[i]);
 
@@ -1734,6 +1849,9 @@ btor_bv_nor (BtorMemMgr *mm, const BtorBitVector *a, const BtorBitVector *b)
   assert (a->len == b->len);
   uint32_t i;
 
+  if (BTOR_BV_IS_WORD (a))
+    return new_word_bv (mm, ~(bv_get_word (a) | bv_get_word (b)), bw);
+
   res = btor_bv_new (mm, bw);
   for (i = 0; i < a->len; i++) res->bits[i] = ~(a->bits[i] | b->bits[i]);
 
@@ -1762,6 +1880,9 @@ btor_bv_xnor (BtorMemMgr *mm, const BtorBitVector *a, const BtorBitVector *b)
   assert (a->len == b->len);
   uint32_t i;
 
+  if (BTOR_BV_IS_WORD (a))
+    return new_word_bv (mm, bv_get_word (a) ^ ~bv_get_word (b), bw);
+
   res = btor_bv_new (mm, bw);
   for (i = 0; i < a->len; i++) res->bits[i] = a->bits[i] ^ ~b->bits[i];
 
@@ -1789,6 +1910,9 @@ btor_bv_xor (BtorMemMgr *mm, const BtorBitVector *a, const BtorBitVector *b)
   assert (a->len == b->len);
   uint32_t i;
 
+  if (BTOR_BV_IS_WORD (a))
+    return new_word_bv (mm, bv_get_word (a) ^ bv_get_word (b), bw);
+
   res = btor_bv_new (mm, bw);
   for (i = 0; i < a->len; i++) res->bits[i] = a->bits[i] ^ b->bits[i];
 
@@ -1813,6 +1937,9 @@ btor_bv_eq (BtorMemMgr *mm, const BtorBitVector *a, const BtorBitVector *b)
   assert (a->len == b->len);
   uint32_t i, bit;
 
+  if (BTOR_BV_IS_WORD (a))
+    return new_bool_bv (mm, bv_get_word (a) == bv_get_word (b));
+
   res = btor_bv_new (mm, 1);
   bit = 1;
   for (i = 0; i < a->len; i++)
@@ -1846,6 +1973,9 @@ btor_bv_ne (BtorMemMgr *mm, const BtorBitVector *a, const BtorBitVector *b)
   assert (a->len == b->len);
   uint32_t i, bit;
 
+  if (BTOR_BV_IS_WORD (a))
+    return new_bool_bv (mm, bv_get_word (a) != bv_get_word (b));
+
   res = btor_bv_new (mm, 1);
   bit = 1;
   for (i = 0; i < a->len; i++)
@@ -1879,6 +2009,9 @@ btor_bv_ult (BtorMemMgr *mm, const BtorBitVector *a, const BtorBitVector *b)
   assert (a->len == b->len);
   uint32_t i, bit;
 
+  if (BTOR_BV_IS_WORD (a))
+    return new_bool_bv (mm, bv_get_word (a) < bv_get_word (b));
+
   res = btor_bv_new (mm, 1);
   bit = 1;
 
@@ -1912,6 +2045,9 @@ btor_bv_ulte (BtorMemMgr *mm, const BtorBitVector *a, const BtorBitVector *b)
   assert (a->len == b->len);
   uint32_t i, bit;
 
+  if (BTOR_BV_IS_WORD (a))
+    return new_bool_bv (mm, bv_get_word (a) <= bv_get_word (b));
+
   res = btor_bv_new (mm, 1);
   bit = 1;
 
@@ -1945,6 +2081,9 @@ btor_bv_ugt (BtorMemMgr *mm, const BtorBitVector *a, const BtorBitVector *b)
   assert (a->len == b->len);
   uint32_t i, bit;
 
+  if (BTOR_BV_IS_WORD (a))
+    return new_bool_bv (mm, bv_get_word (a) > bv_get_word (b));
+
   res = btor_bv_new (mm, 1);
   bit = 1;
 
@@ -1978,6 +2117,9 @@ btor_bv_ugte (BtorMemMgr *mm, const BtorBitVector *a, const BtorBitVector *b)
   assert (a->len == b->len);
   uint32_t i, bit;
 
+  if (BTOR_BV_IS_WORD (a))
+    return new_bool_bv (mm, bv_get_word (a) >= bv_get_word (b));
+
   res = btor_bv_new (mm, 1);
   bit = 1;
 
@@ -2120,6 +2262,11 @@ btor_bv_sll_uint64 (BtorMemMgr *mm, const BtorBitVector *a, uint64_t shift)
   BtorBitVector *res;
   uint32_t bw = a->width;
 
+#ifndef BTOR_USE_GMP
+  if (BTOR_BV_IS_WORD (a))
+    return new_word_bv (mm, shift >= bw ? 0 : bv_get_word (a) << shift, bw);
+#endif
+
   res = btor_bv_new (mm, bw);
   if (shift >= bw) return res;
 
@@ -2229,6 +2376,12 @@ btor_bv_srl_uint64 (BtorMemMgr *mm, const BtorBitVector *a, uint64_t shift)
 
   BtorBitVector *res;
 
+#ifndef BTOR_USE_GMP
+  if (BTOR_BV_IS_WORD (a))
+    return new_word_bv (
+        mm, shift >= a->width ? 0 : bv_get_word (a) >> shift, a->width);
+#endif
+
   res = btor_bv_new (mm, a->width);
   if (shift >= a->width) return res;
 #ifdef BTOR_USE_GMP
@@ -2284,31 +2437,24 @@ btor_bv_mul (BtorMemMgr *mm, const BtorBitVector *a, const BtorBitVector *b)
 #else
   assert (a->len == b->len);
   uint32_t i;
-  uint64_t x, y;
   BtorBitVector *and, *shift, *add;
 
-  if (bw <= 64)
-  {
-    x   = btor_bv_to_uint64 (a);
-    y   = btor_bv_to_uint64 (b);
-    res = btor_bv_uint64_to_bv (mm, x * y, bw);
-  }
-  else
+  if (BTOR_BV_IS_WORD (a))
+    return new_word_bv (mm, bv_get_word (a) * bv_get_word (b), bw);
+
+  res = btor_bv_new (mm, bw);
+  for (i = 0; i < bw; i++)
   {
-    res = btor_bv_new (mm, bw);
-    for (i = 0; i < bw; i++)
-    {
-      if (btor_bv_get_bit (b, i))
-        and = btor_bv_copy (mm, a);
-      else
-        and = btor_bv_new (mm, bw);
-      shift = btor_bv_sll_uint64 (mm, and, i);
-      add   = btor_bv_add (mm, res, shift);
-      btor_bv_free (mm, and);
-      btor_bv_free (mm, shift);
-      btor_bv_free (mm, res);
-      res = add;
-    }
+    if (btor_bv_get_bit (b, i))
+      and = btor_bv_copy (mm, a);
+    else
+      and = btor_bv_new (mm, bw);
+    shift = btor_bv_sll_uint64 (mm, and, i);
+    add   = btor_bv_add (mm, res, shift);
+    btor_bv_free (mm, and);
+    btor_bv_free (mm, shift);
+    btor_bv_free (mm, res);
+    res = add;
   }
 #endif
   return res;
@@ -2335,10 +2481,10 @@ udiv_urem_bv (BtorMemMgr *mm,
 
   BtorBitVector *neg_b, *quot, *rem, *ult, *eq, *tmp;
 
-  if (bw <= 64)
+  if (BTOR_BV_IS_WORD (a))
   {
-    x = btor_bv_to_uint64 (a);
-    y = btor_bv_to_uint64 (b);
+    x = bv_get_word (a);
+    y = bv_get_word (b);
     if (y == 0)
     {
       y = x;
@@ -2350,8 +2496,8 @@ udiv_urem_bv (BtorMemMgr *mm,
       y = x % y;
       x = z;
     }
-    quot = btor_bv_uint64_to_bv (mm, x, bw);
-    rem  = btor_bv_uint64_to_bv (mm, y, bw);
+    quot = q ? new_word_bv (mm, x, bw) : 0;
+    rem  = r ? new_word_bv (mm, y, bw) : 0;
   }
   else
   {
@@ -2390,12 +2536,12 @@ udiv_urem_bv (BtorMemMgr *mm,
 
   if (q)
     *q = quot;
-  else
+  else if (quot)
     btor_bv_free (mm, quot);
 
   if (r)
     *r = rem;
-  else
+  else if (rem)
     btor_bv_free (mm, rem);
 }
 #endif
@@ -2558,6 +2704,10 @@ btor_bv_concat (BtorMemMgr *mm, const BtorBitVector *a, const BtorBitVector *b)
   int64_t i, j, k;
   BTOR_BV_TYPE v;
 
+  if (bw <= 64)
+    return new_word_bv (
+        mm, (bv_get_word (a) << b->width) | bv_get_word (b), bw);
+
   res = btor_bv_new (mm, bw);
 
   j = res->len - 1;
@@ -2612,6 +2762,9 @@ btor_bv_slice (BtorMemMgr *mm,
 #else
   uint32_t i, j;
 
+  if (BTOR_BV_IS_WORD (bv))
+    return new_word_bv (mm, bv_get_word (bv) >> lower, bw);
+
   res = btor_bv_new (mm, bw);
   for (i = lower, j = 0; i <= upper; i++)
     btor_bv_set_bit (res, j++, btor_bv_get_bit (bv, i));
@@ -2650,6 +2803,12 @@ btor_bv_sext (BtorMemMgr *mm, const BtorBitVector *bv, uint32_t len)
   }
 #else
   BtorBitVector *tmp;
+  if (bw + len <= 64)
+    return new_word_bv (mm,
+                        btor_bv_get_bit (bv, bw - 1)
+                            ? bv_get_word (bv) | ~bv_word_mask (bw)
+                            : bv_get_word (bv),
+                        bw + len);
   tmp = btor_bv_get_bit (bv, bw - 1) ? btor_bv_ones (mm, len)
                                      : btor_bv_zero (mm, len);
   res = btor_bv_concat (mm, tmp, bv);
@@ -2673,11 +2832,13 @@ btor_bv_uext (BtorMemMgr *mm, const BtorBitVector *bv, uint32_t len)
     return btor_bv_copy (mm, bv);
   }
 
-  bw  = bv->width + len;
-  res = btor_bv_new (mm, bw);
+  bw = bv->width + len;
 #ifdef BTOR_USE_GMP
+  res = btor_bv_new (mm, bw);
   mpz_set (res->val, bv->val);
 #else
+  if (bw <= 64) return new_word_bv (mm, bv_get_word (bv), bw);
+  res = btor_bv_new (mm, bw);
   memcpy (
       res->bits + res->len - bv->len, bv->bits, sizeof (*(bv->bits)) * bv->len);
 #endif
@@ -2705,6 +2866,9 @@ btor_bv_ite (BtorMemMgr *mm,
   BTOR_BV_TYPE cc, nn;
   uint32_t i;
 
+  if (BTOR_BV_IS_WORD (t))
+    return new_word_bv (mm, bv_get_word (c->bits[0] ? t : e), t->width);
+
   cc = btor_bv_get_bit (c, 0) ? (~(BTOR_BV_TYPE) 0) : 0;
   nn = ~cc;
 
@@ -116,6 +116,9 @@ char *btor_bv_to_dec_char (BtorMemMgr *mm, const BtorBitVector *bv);
 
 /* Convert given bit-vector to an unsigned 64 bit integer. */
 uint64_t btor_bv_to_uint64 (const BtorBitVector *bv);
+/* Convert given bit-vector to ceil(width/64) 64-bit words, stored in 'words'
+ * with the least significant word first. */
+void btor_bv_to_words (const BtorBitVector *bv, uint64_t *words);
 
 /*------------------------------------------------------------------------*/
 
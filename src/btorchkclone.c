@@ -17,6 +17,7 @@
 #include "btorslv.h"
 #include "btorslvaigprop.h"
 #include "btorslvfun.h"
+#include "btorslvportfolio.h"
 #include "btorslvprop.h"
 #include "btorslvsls.h"
 #include "utils/btorhashint.h"
@@ -228,6 +229,7 @@ chkclone_stats (Btor *btor, Btor *clone)
   assert (btor);
   assert (clone);
 
+  uint32_t i;
 #ifndef NDEBUG
   BtorPtrHashTableIterator it, cit;
   BtorHashTableData *data, *cdata;
@@ -254,6 +256,12 @@ chkclone_stats (Btor *btor, Btor *clone)
   BTOR_CHKCLONE_STATS (clone_calls);
   BTOR_CHKCLONE_STATS (node_bytes_alloc);
   BTOR_CHKCLONE_STATS (beta_reduce_calls);
+  for (i = 0; i < BTOR_PP_NUM_PASSES; i++)
+  {
+    BTOR_CHKCLONE_STATS (pp[i].runs);
+    BTOR_CHKCLONE_STATS (pp[i].skipped);
+    BTOR_CHKCLONE_STATS (pp[i].nodes);
+  }
 
   BTOR_CHKCLONE_CONSTRAINTSTATS (constraints, varsubst);
   BTOR_CHKCLONE_CONSTRAINTSTATS (constraints, embedded);
@@ -367,7 +375,6 @@ chkclone_opts (Btor *btor, Btor *clone)
 static void
 chkclone_aig (BtorAIG *aig, BtorAIG *clone)
 {
-  int32_t i;
   BtorAIG *real_aig, *real_clone;
 
   real_aig   = BTOR_REAL_ADDR_AIG (aig);
@@ -378,32 +385,66 @@ chkclone_aig (BtorAIG *aig, BtorAIG *clone)
   if (real_aig != BTOR_AIG_FALSE)
   {
     BTOR_CHKCLONE_AIG (id);
-    BTOR_CHKCLONE_AIG (refs);
-    BTOR_CHKCLONE_AIG (next);
-    BTOR_CHKCLONE_AIG (cnf_id);
     BTOR_CHKCLONE_AIG (mark);
     BTOR_CHKCLONE_AIG (is_var);
     BTOR_CHKCLONE_AIG (local);
-    if (!real_aig->is_var)
-      for (i = 0; i < 2; i++) BTOR_CHKCLONE_AIG (children[i]);
   }
 }
 
+#define BTOR_CHKCLONE_AIG_DATA(field)                          \
+  do                                                           \
+  {                                                            \
+    assert (&bamgr->field != &camgr->field);                   \
+    assert (BTOR_COUNT_STACK (bamgr->field)                    \
+            == BTOR_COUNT_STACK (camgr->field));               \
+    for (i = 0; i < BTOR_COUNT_STACK (bamgr->field); i++)      \
+      assert (bamgr->field.start[i] == camgr->field.start[i]); \
+  } while (0)
+
 static inline void
-chkclone_aig_unique_table (Btor *btor, Btor *clone)
+chkclone_aig_data_table (Btor *btor, Btor *clone)
+{
+  size_t i;
+  BtorAIGMgr *bamgr, *camgr;
+
+  bamgr = btor_get_aig_mgr (btor);
+  camgr = btor_get_aig_mgr (clone);
+
+  BTOR_CHKCLONE_AIG_DATA (children);
+  BTOR_CHKCLONE_AIG_DATA (cnf_ids);
+  BTOR_CHKCLONE_AIG_DATA (cnf_pols);
+  BTOR_CHKCLONE_AIG_DATA (refs);
+}
+
+static inline void
+chkclone_unique_table (BtorUniqueTable *btable, BtorUniqueTable *ctable)
 {
   uint32_t i;
-  BtorAIGUniqueTable *btable, *ctable;
 
-  btable = &btor_get_aig_mgr (btor)->table;
-  ctable = &btor_get_aig_mgr (clone)->table;
   assert (btable != ctable);
-
   assert (btable->size == ctable->size);
   assert (btable->num_elements == ctable->num_elements);
+  assert (btable->old_size == ctable->old_size);
+  assert (btable->old_pos == ctable->old_pos);
+  assert (btable->slots != ctable->slots);
 
   for (i = 0; i < btable->size; i++)
-    assert (btable->chains[i] == ctable->chains[i]);
+  {
+    assert (btable->slots[i].id == ctable->slots[i].id);
+    assert (btable->slots[i].hash == ctable->slots[i].hash);
+  }
+  for (i = 0; i < btable->old_size; i++)
+  {
+    assert (btable->old_slots[i].id == ctable->old_slots[i].id);
+    assert (btable->old_slots[i].hash == ctable->old_slots[i].hash);
+  }
+}
+
+static inline void
+chkclone_aig_unique_table (Btor *btor, Btor *clone)
+{
+  chkclone_unique_table (&btor_get_aig_mgr (btor)->table,
+                         &btor_get_aig_mgr (clone)->table);
 }
 
 static inline void
@@ -550,7 +591,6 @@ btor_chkclone_exp (Btor *btor,
   else if (real_exp->rho)
     chkclone_node_ptr_hash_table (real_exp->rho, real_cexp->rho, 0);
 
-  BTOR_CHKCLONE_EXPPTRID (next);
   BTOR_CHKCLONE_EXPPTRID (simplified);
   BTOR_CHKCLONE_EXPPTRID (first_parent);
   BTOR_CHKCLONE_EXPPTRID (last_parent);
@@ -733,29 +773,11 @@ chkclone_node_id_table (Btor *btor, Btor *clone)
 
 /*------------------------------------------------------------------------*/
 
-/* Note: no need to check next pointers here as we catch all of them when
- *	 traversing through nodes id table. */
 static inline void
 chkclone_node_unique_table (Btor *btor, Btor *clone)
 {
-  uint32_t i;
-  BtorNodeUniqueTable *btable, *ctable;
-
-  btable = &btor->nodes_unique_table;
-  ctable = &clone->nodes_unique_table;
-  assert (btable != ctable);
-  assert (btable->size == ctable->size);
-  assert (btable->num_elements == ctable->num_elements);
-
-  for (i = 0; i < btable->size; i++)
-  {
-    if (!btable->chains[i])
-    {
-      assert (!ctable->chains[i]);
-      continue;
-    }
-    BTOR_CHKCLONE_EXPID (btable->chains[i], ctable->chains[i]);
-  }
+  chkclone_unique_table (&btor->nodes_unique_table,
+                         &clone->nodes_unique_table);
 }
 
 /*------------------------------------------------------------------------*/
@@ -1224,6 +1246,16 @@ chkclone_slv (Btor *btor, Btor *clone)
     BTOR_CHKCLONE_SLV_STATS (slv, cslv, moves);
     BTOR_CHKCLONE_SLV_STATS (slv, cslv, restarts);
   }
+  else if (btor->slv->kind == BTOR_PORTFOLIO_SOLVER_KIND)
+  {
+    BtorPortfolioSolver *slv  = BTOR_PORTFOLIO_SOLVER (btor);
+    BtorPortfolioSolver *cslv = BTOR_PORTFOLIO_SOLVER (clone);
+
+    assert (!cslv->winner);
+
+    BTOR_CHKCLONE_SLV_STATS (slv, cslv, races);
+    BTOR_CHKCLONE_SLV_STATS (slv, cslv, workers);
+  }
 }
 
 /*------------------------------------------------------------------------*/
@@ -1256,6 +1288,7 @@ btor_chkclone (Btor *btor, Btor *clone)
   {
     chkclone_aig_unique_table (btor, clone);
     chkclone_aig_id_table (btor, clone);
+    chkclone_aig_data_table (btor, clone);
     chkclone_aig_cnf_id_table (btor, clone);
   }
 
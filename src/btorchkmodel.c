@@ -288,6 +288,7 @@ btor_check_model_init (Btor *btor)
   btor_opt_set (ctx->clone, BTOR_OPT_CHK_MODEL, 0);
   btor_opt_set (ctx->clone, BTOR_OPT_CHK_FAILED_ASSUMPTIONS, 0);
   btor_opt_set (ctx->clone, BTOR_OPT_PRINT_DIMACS, 0);
+  btor_opt_set (ctx->clone, BTOR_OPT_FUN_CUBE, 0);
   btor_set_term (ctx->clone, 0, 0);
 
   btor_opt_set (ctx->clone, BTOR_OPT_ENGINE, BTOR_ENGINE_FUN);
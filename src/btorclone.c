@@ -21,6 +21,7 @@
 #include "btorsat.h"
 #include "btorslvaigprop.h"
 #include "btorslvfun.h"
+#include "btorslvportfolio.h"
 #include "btorslvprop.h"
 #include "btorslvsls.h"
 #include "btorsort.h"
@@ -85,21 +86,6 @@ btor_clone_key_as_bv_tuple (BtorMemMgr *mm, const void *map, const void *t)
   return btor_bv_copy_tuple (mm, (BtorBitVectorTuple *) t);
 }
 
-void *
-btor_clone_key_as_rw_cache_tuple (BtorMemMgr *mm,
-                                  const void *map,
-                                  const void *t)
-{
-  assert (mm);
-  assert (t);
-  (void) map;
-
-  BtorRwCacheTuple *res;
-  BTOR_CNEW (mm, res);
-  memcpy (res, t, sizeof (BtorRwCacheTuple));
-  return res;
-}
-
 void
 btor_clone_data_as_node_ptr (BtorMemMgr *mm,
                              const void *map,
@@ -509,7 +495,7 @@ clone_exp (Btor *clone,
 
   mm = clone->mm;
 
-  res = btor_mem_malloc (mm, exp->bytes);
+  res = btor_mem_slab_malloc (mm, exp->bytes);
   memcpy (res, exp, exp->bytes);
 
   /* ------------------- BTOR_VAR_NODE_STRUCT (all nodes) -----------------> */
@@ -535,9 +521,6 @@ clone_exp (Btor *clone,
   else if (exp->av)
     res->av = exp_layer_only ? 0 : btor_aigvec_clone (exp->av, clone->avmgr);
 
-  assert (!exp->next || !btor_node_is_invalid (exp->next));
-  BTOR_PUSH_STACK_IF (exp->next, *nodes, &res->next);
-
   assert (!btor_node_is_simplified (exp) || !btor_node_is_invalid (exp->simplified));
   if (clone_simplified || btor_node_is_proxy (exp))
   {
@@ -767,31 +750,15 @@ clone_nodes_id_table (Btor *btor,
   BTOR_RELEASE_STACK (static_rhos);
 }
 
+/* Note: the unique table stores node ids, which are the same in the clone. */
 static void
-clone_nodes_unique_table (Btor *btor, Btor *clone, BtorNodeMap *exp_map)
+clone_nodes_unique_table (Btor *btor, Btor *clone)
 {
   assert (btor);
   assert (clone);
-  assert (exp_map);
 
-  uint32_t i;
-  BtorNodeUniqueTable *table, *res;
-  BtorMemMgr *mm;
-
-  mm    = clone->mm;
-  table = &btor->nodes_unique_table;
-  res   = &clone->nodes_unique_table;
-
-  BTOR_CNEWN (mm, res->chains, table->size);
-  res->size         = table->size;
-  res->num_elements = table->num_elements;
-
-  for (i = 0; i < table->size; i++)
-  {
-    if (!table->chains[i]) continue;
-    res->chains[i] = btor_nodemap_mapped (exp_map, table->chains[i]);
-    assert (res->chains[i]);
-  }
+  btor_uniquetable_clone (
+      clone->mm, &btor->nodes_unique_table, &clone->nodes_unique_table);
 }
 
 #define MEM_INT_HASH_TABLE(table)                                 \
@@ -876,11 +843,12 @@ clone_aux_btor (Btor *btor,
   BtorNodeMap *emap = 0;
   BtorMemMgr *mm;
   double start, delta;
-  uint32_t i, len;
+  uint32_t i, j, len;
   char *prefix, *clone_prefix;
   BtorNode *exp, *cloned_exp;
   BtorPtrHashTableIterator pit;
   BtorNodePtrStack rhos;
+  BtorUCTerm *uc_term, *cloned_uc_term;
 #ifndef NDEBUG
   uint32_t h;
   size_t allocated;
@@ -1019,7 +987,18 @@ clone_aux_btor (Btor *btor,
                             + sizeof (BtorSATMgr)
                             /* true and false AIGs */
                             + 2 * sizeof (BtorAIG *)
-                            + sizeof (int32_t)) /* unique table chains */
+                            /* AIG data indexed by id */
+                            + BTOR_SIZE_STACK (clone->avmgr->amgr->children)
+                                  * sizeof (int32_t)
+                            + BTOR_SIZE_STACK (clone->avmgr->amgr->cnf_ids)
+                                  * sizeof (int32_t)
+                            + BTOR_SIZE_STACK (clone->avmgr->amgr->cnf_pols)
+                                  * sizeof (char)
+                            + BTOR_SIZE_STACK (clone->avmgr->amgr->refs)
+                                  * sizeof (uint32_t)
+                            /* unique table */
+                            + btor_uniquetable_bytes (
+                                &clone->avmgr->amgr->table))
               == clone->mm->allocated);
     }
     else
@@ -1033,10 +1012,13 @@ clone_aux_btor (Btor *btor,
           + sizeof (BtorSATMgr)
           /* memory of AIG nodes */
           + (amgr->cur_num_aigs + amgr->cur_num_aig_vars) * sizeof (BtorAIG)
-          /* children for AND AIGs */
-          + amgr->cur_num_aigs * sizeof (int32_t) * 2
-          /* unique table chain */
-          + amgr->table.size * sizeof (int32_t)
+          /* AIG data indexed by id */
+          + BTOR_SIZE_STACK (amgr->children) * sizeof (int32_t)
+          + BTOR_SIZE_STACK (amgr->cnf_ids) * sizeof (int32_t)
+          + BTOR_SIZE_STACK (amgr->cnf_pols) * sizeof (char)
+          + BTOR_SIZE_STACK (amgr->refs) * sizeof (uint32_t)
+          /* unique table */
+          + btor_uniquetable_bytes (&amgr->table)
           + BTOR_SIZE_STACK (amgr->id2aig) * sizeof (BtorAIG *)
           + BTOR_SIZE_STACK (amgr->cnfid2aig) * sizeof (int32_t);
 #ifdef BTOR_USE_LINGELING
@@ -1124,11 +1106,11 @@ clone_aux_btor (Btor *btor,
   assert (clone->true_exp);
 
   BTORLOG_TIMESTAMP (delta);
-  clone_nodes_unique_table (btor, clone, emap);
+  clone_nodes_unique_table (btor, clone);
   BTORLOG (2,
            "  clone nodes unique table: %.3f s",
            (btor_util_time_stamp () - delta));
-  assert ((allocated += btor->nodes_unique_table.size * sizeof (BtorNode *))
+  assert ((allocated += btor_uniquetable_bytes (&btor->nodes_unique_table))
           == clone->mm->allocated);
 
   clone->symbols = btor_hashptr_table_clone (mm,
@@ -1228,6 +1210,29 @@ clone_aux_btor (Btor *btor,
            BTOR_SIZE_STACK (btor->assertions_trail) * sizeof (uint32_t))
           == clone->mm->allocated);
 
+  BTOR_INIT_STACK (mm, clone->uc_terms);
+  for (i = 0; i < BTOR_COUNT_STACK (btor->uc_terms); i++)
+  {
+    uc_term = BTOR_PEEK_STACK (btor->uc_terms, i);
+    BTOR_NEW (mm, cloned_uc_term);
+    *cloned_uc_term = *uc_term;
+    for (j = 0; j < uc_term->arity; j++)
+    {
+      cloned_uc_term->e[j] = btor_nodemap_mapped (emap, uc_term->e[j]);
+      assert (cloned_uc_term->e[j]);
+    }
+    cloned_uc_term->exp   = btor_nodemap_mapped (emap, uc_term->exp);
+    cloned_uc_term->subst = btor_nodemap_mapped (emap, uc_term->subst);
+    assert (cloned_uc_term->exp);
+    assert (cloned_uc_term->subst);
+    BTOR_PUSH_STACK (clone->uc_terms, cloned_uc_term);
+  }
+  BTOR_ADJUST_STACK (btor->uc_terms, clone->uc_terms);
+  assert ((allocated +=
+           BTOR_SIZE_STACK (btor->uc_terms) * sizeof (BtorUCTerm *)
+           + BTOR_COUNT_STACK (btor->uc_terms) * sizeof (BtorUCTerm))
+          == clone->mm->allocated);
+
   if (btor->bv_model)
   {
     clone->bv_model = btor_model_clone_bv (clone, btor->bv_model, false);
@@ -1367,14 +1372,10 @@ clone_aux_btor (Btor *btor,
   assert (allocated == clone->mm->allocated);
 #endif
   BTOR_NEW (mm, clone->rw_cache);
-  clone->rw_cache->btor  = clone;
-  clone->rw_cache->cache = btor_hashptr_table_clone (
-      mm, btor->rw_cache->cache, btor_clone_key_as_rw_cache_tuple, 0, 0, 0);
+  btor_rw_cache_clone (btor->rw_cache, clone->rw_cache, clone);
 #ifndef NDEBUG
-  CHKCLONE_MEM_PTR_HASH_TABLE (btor->rw_cache->cache, clone->rw_cache->cache);
   allocated += sizeof (*btor->rw_cache);
-  allocated += btor->rw_cache->cache->count * sizeof (BtorRwCacheTuple);
-  allocated += MEM_PTR_HASH_TABLE (btor->rw_cache->cache);
+  allocated += btor->rw_cache->size * sizeof (BtorRwCacheTuple);
 #endif
 
   /* move synthesized constraints to unsynthesized if we only clone the exp
@@ -1533,6 +1534,10 @@ clone_aux_btor (Btor *btor,
 
       allocated += sizeof (BtorAIGPropSolver);
     }
+    else if (clone->slv->kind == BTOR_PORTFOLIO_SOLVER_KIND)
+    {
+      allocated += sizeof (BtorPortfolioSolver);
+    }
 
     assert (allocated == clone->mm->allocated);
   }
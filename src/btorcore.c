@@ -14,6 +14,8 @@
 #include <limits.h>
 
 #include "btorabort.h"
+#include "btoraigrewrite.h"
+#include "btoraigsweep.h"
 #ifndef NDEBUG
 #include "btorchkfailed.h"
 #include "btorchkmodel.h"
@@ -28,6 +30,7 @@
 #include "btorrewrite.h"
 #include "btorslvaigprop.h"
 #include "btorslvfun.h"
+#include "btorslvportfolio.h"
 #include "btorslvprop.h"
 #include "btorslvquant.h"
 #include "btorslvsls.h"
@@ -395,13 +398,49 @@ number_of_ops (Btor *btor)
   return result;
 }
 
-#ifdef BTOR_TIME_STATISTICS
 static double
 percent (double a, double b)
 {
   return b ? 100.0 * a / b : 0.0;
 }
-#endif
+
+static void
+print_slab_stats (Btor *btor)
+{
+  uint32_t i;
+  size_t used, objs;
+  BtorMemSlab *slab;
+
+  used = objs = 0;
+  for (i = 0; i < BTOR_MEM_SLAB_NUM_CLASSES; i++)
+  {
+    used += btor->mm->slabs[i].num_used;
+    objs += btor->mm->slabs[i].num_objs;
+  }
+
+  BTOR_MSG (btor->msg, 1, "");
+  BTOR_MSG (btor->msg,
+            1,
+            "%.1f MB allocated for slab pools, %zu of %zu objects in use "
+            "(%.0f%%)",
+            btor->mm->slab_allocated / (double) (1 << 20),
+            used,
+            objs,
+            percent (used, objs));
+  for (i = 0; i < BTOR_MEM_SLAB_NUM_CLASSES; i++)
+  {
+    slab = &btor->mm->slabs[i];
+    if (!slab->num_chunks) continue;
+    BTOR_MSG (btor->msg,
+              2,
+              "  %3u bytes: %zu of %zu objects in use (%.0f%%) in %zu chunks",
+              (i + 1) * BTOR_MEM_SLAB_ALIGN,
+              slab->num_used,
+              slab->num_objs,
+              percent (slab->num_used, slab->num_objs),
+              slab->num_chunks);
+  }
+}
 
 void
 btor_print_stats (Btor *btor)
@@ -510,19 +549,37 @@ btor_print_stats (Btor *btor)
       btor->msg, 1, "%5lld beta reductions", btor->stats.beta_reduce_calls);
   BTOR_MSG (btor->msg, 1, "%5lld clone calls", btor->stats.clone_calls);
 
+  btor_pp_print_stats (btor);
+
   BTOR_MSG (btor->msg, 1, "");
   BTOR_MSG (btor->msg, 1, "rewrite rule cache");
   BTOR_MSG (btor->msg, 1, "  %lld cached (add) ", btor->rw_cache->num_add);
   BTOR_MSG (btor->msg, 1, "  %lld cached (get)", btor->rw_cache->num_get);
   BTOR_MSG (btor->msg, 1, "  %lld updated", btor->rw_cache->num_update);
   BTOR_MSG (btor->msg, 1, "  %lld removed (gc)", btor->rw_cache->num_remove);
+  BTOR_MSG (btor->msg, 1, "  %lld evicted", btor->rw_cache->num_evict);
   BTOR_MSG (btor->msg,
             1,
-            "  %.2f MB cache",
-            (btor->rw_cache->cache->count * sizeof (BtorRwCacheTuple)
-             + btor->rw_cache->cache->count * sizeof (BtorPtrHashBucket)
-             + btor->rw_cache->cache->size * sizeof (BtorPtrHashBucket *))
+            "  %u/%u entries (%.2f MB cache)",
+            btor->rw_cache->count,
+            btor->rw_cache->size,
+            btor->rw_cache->size * sizeof (BtorRwCacheTuple)
                 / (double) (1 << 20));
+  BTOR_MSG (btor->msg, 1, "  hits/misses per operator:");
+  for (i = 0; i < BTOR_NUM_OPS_NODE; i++)
+  {
+    if (!btor->rw_cache->num_hits[i] && !btor->rw_cache->num_misses[i])
+      continue;
+    BTOR_MSG (btor->msg,
+              1,
+              "    %-8s %10lld hits %10lld misses (%.1f%% hits)",
+              g_btor_op2str[i],
+              btor->rw_cache->num_hits[i],
+              btor->rw_cache->num_misses[i],
+              percent (
+                  btor->rw_cache->num_hits[i],
+                  btor->rw_cache->num_hits[i] + btor->rw_cache->num_misses[i]));
+  }
 
 #ifndef NDEBUG
   BtorPtrHashTableIterator it;
@@ -571,9 +628,50 @@ btor_print_stats (Btor *btor)
             1,
             "  %7lld CNF literals",
             btor->avmgr ? btor->avmgr->amgr->num_cnf_literals : 0);
+  if (btor_opt_get (btor, BTOR_OPT_AIG_REWRITE))
+    BTOR_MSG (btor->msg,
+              1,
+              "  %7lld AIG ANDs removed by cut rewriting (%lld rewrites)",
+              btor->avmgr ? btor->avmgr->amgr->num_cut_removed : 0,
+              btor->avmgr ? btor->avmgr->amgr->num_cut_rewrites : 0);
+  if (btor_opt_get (btor, BTOR_OPT_SAT_SWEEP))
+    BTOR_MSG (btor->msg,
+              1,
+              "  %7lld AIGs merged by SAT sweeping (%lld SAT calls)",
+              btor->avmgr ? btor->avmgr->amgr->num_sweep_merged : 0,
+              btor->avmgr ? btor->avmgr->amgr->num_sweep_checks : 0);
+  if (btor->avmgr)
+  {
+    BTOR_MSG (btor->msg,
+              1,
+              "  %7lld multipliers (%lld array, %lld wallace, %lld dadda, "
+              "%lld sparse)",
+              btor->avmgr->stats.muls[BTOR_MUL_ENC_ARRAY]
+                  + btor->avmgr->stats.muls[BTOR_MUL_ENC_WALLACE]
+                  + btor->avmgr->stats.muls[BTOR_MUL_ENC_DADDA]
+                  + btor->avmgr->stats.muls[BTOR_MUL_ENC_SPARSE],
+              btor->avmgr->stats.muls[BTOR_MUL_ENC_ARRAY],
+              btor->avmgr->stats.muls[BTOR_MUL_ENC_WALLACE],
+              btor->avmgr->stats.muls[BTOR_MUL_ENC_DADDA],
+              btor->avmgr->stats.muls[BTOR_MUL_ENC_SPARSE]);
+    BTOR_MSG (btor->msg,
+              1,
+              "  %7lld multiplier full adders",
+              btor->avmgr->stats.mul_full_adders);
+    BTOR_MSG (btor->msg,
+              1,
+              "  %7lld multiplier half adders",
+              btor->avmgr->stats.mul_half_adders);
+    BTOR_MSG (btor->msg,
+              1,
+              "  %7lld zero partial products dropped",
+              btor->avmgr->stats.mul_pps_dropped);
+  }
 
   if (btor->slv) btor->slv->api.print_stats (btor->slv);
 
+  print_slab_stats (btor);
+
 #ifdef BTOR_TIME_STATISTICS
   BTOR_MSG (btor->msg, 1, "");
   BTOR_MSG (btor->msg, 1, "%.2f seconds beta-reduction", btor->time.beta);
@@ -581,6 +679,11 @@ btor_print_stats (Btor *btor)
             1,
             "%.2f seconds synthesize expressions",
             btor->time.synth_exp);
+  if (btor_opt_get (btor, BTOR_OPT_AIG_REWRITE))
+    BTOR_MSG (
+        btor->msg, 1, "%.2f seconds AIG cut rewriting", btor->time.aig_rewrite);
+  if (btor_opt_get (btor, BTOR_OPT_SAT_SWEEP))
+    BTOR_MSG (btor->msg, 1, "%.2f seconds SAT sweeping", btor->time.sat_sweep);
   BTOR_MSG (btor->msg,
             1,
             "%.2f seconds determining failed assumptions",
@@ -683,7 +786,7 @@ btor_new (void)
   btor->msg = btor_msg_new (btor);
   btor_set_msg_prefix (btor, "btor");
 
-  BTOR_INIT_UNIQUE_TABLE (mm, btor->nodes_unique_table);
+  btor_uniquetable_init (mm, &btor->nodes_unique_table);
   BTOR_INIT_SORT_UNIQUE_TABLE (mm, btor->sorts_unique_table);
   BTOR_INIT_STACK (btor->mm, btor->nodes_id_table);
   BTOR_PUSH_STACK (btor->nodes_id_table, 0);
@@ -769,6 +872,7 @@ btor_new (void)
   BTOR_INIT_STACK (mm, btor->assertions);
   BTOR_INIT_STACK (mm, btor->assertions_trail);
   btor->assertions_cache = btor_hashint_table_new (mm);
+  BTOR_INIT_STACK (mm, btor->uc_terms);
 
 #ifndef NDEBUG
   btor->stats.rw_rules_applied = btor_hashptr_table_new (
@@ -894,11 +998,12 @@ btor_delete (Btor *btor)
 {
   assert (btor);
 
-  uint32_t i, cnt;
+  uint32_t i, j, cnt;
   BtorNodePtrStack stack;
   BtorMemMgr *mm;
   BtorNode *exp;
   BtorPtrHashTableIterator it;
+  BtorUCTerm *uc_term;
 
   mm = btor->mm;
   btor_rng_delete (&btor->rng);
@@ -946,6 +1051,17 @@ btor_delete (Btor *btor)
   BTOR_RELEASE_STACK (btor->assertions_trail);
   btor_hashint_table_delete (btor->assertions_cache);
 
+  for (i = 0; i < BTOR_COUNT_STACK (btor->uc_terms); i++)
+  {
+    uc_term = BTOR_PEEK_STACK (btor->uc_terms, i);
+    for (j = 0; j < uc_term->arity; j++)
+      btor_node_release (btor, uc_term->e[j]);
+    btor_node_release (btor, uc_term->exp);
+    btor_node_release (btor, uc_term->subst);
+    BTOR_DELETE (mm, uc_term);
+  }
+  BTOR_RELEASE_STACK (btor->uc_terms);
+
   btor_model_delete (btor);
   btor_node_release (btor, btor->true_exp);
 
@@ -1023,7 +1139,7 @@ btor_delete (Btor *btor)
   }
   assert (getenv ("BTORLEAK") || getenv ("BTORLEAKEXP") || !node_leak);
 #endif
-  BTOR_RELEASE_UNIQUE_TABLE (mm, btor->nodes_unique_table);
+  btor_uniquetable_release (&btor->nodes_unique_table);
   BTOR_RELEASE_STACK (btor->nodes_id_table);
 
   assert (getenv ("BTORLEAK") || getenv ("BTORLEAKSORT")
@@ -1079,15 +1195,21 @@ btor_process_unsynthesized_constraints (Btor *btor)
   assert (btor);
   assert (!btor->inconsistent);
 
+  bool opt_rewrite, opt_sweep;
+  double start;
   BtorPtrHashTable *uc, *sc;
   BtorPtrHashBucket *bucket;
   BtorNode *cur;
   BtorAIG *aig;
   BtorAIGMgr *amgr;
+  BtorAIGPtrStack aigs;
 
-  uc   = btor->unsynthesized_constraints;
-  sc   = btor->synthesized_constraints;
-  amgr = btor_get_aig_mgr (btor);
+  uc          = btor->unsynthesized_constraints;
+  sc          = btor->synthesized_constraints;
+  amgr        = btor_get_aig_mgr (btor);
+  opt_rewrite = btor_opt_get (btor, BTOR_OPT_AIG_REWRITE) == 1;
+  opt_sweep   = btor_opt_get (btor, BTOR_OPT_SAT_SWEEP) == 1;
+  BTOR_INIT_STACK (btor->mm, aigs);
 
   while (uc->count > 0)
   {
@@ -1137,8 +1259,18 @@ btor_process_unsynthesized_constraints (Btor *btor)
         btor->found_constraint_false = true;
         break;
       }
-      btor_aig_add_toplevel_to_sat (amgr, aig);
-      btor_aig_release (amgr, aig);
+      /* with AIG rewriting and SAT sweeping, the AIGs of all new
+       * constraints are simplified together before they are added to the
+       * SAT solver */
+      if (opt_rewrite || opt_sweep)
+      {
+        BTOR_PUSH_STACK (aigs, aig);
+      }
+      else
+      {
+        btor_aig_add_toplevel_to_sat (amgr, aig);
+        btor_aig_release (amgr, aig);
+      }
       (void) btor_hashptr_table_add (sc, cur);
       btor_hashptr_table_remove (uc, cur, 0, 0);
 
@@ -1152,6 +1284,32 @@ btor_process_unsynthesized_constraints (Btor *btor)
       btor_node_release (btor, cur);
     }
   }
+
+  if (!BTOR_EMPTY_STACK (aigs) && !btor->found_constraint_false)
+  {
+    if (opt_rewrite)
+    {
+      start = btor_util_time_stamp ();
+      btor_aig_rewrite (amgr, &aigs);
+      btor->time.aig_rewrite += btor_util_time_stamp () - start;
+    }
+    if (opt_sweep)
+    {
+      start = btor_util_time_stamp ();
+      btor_aig_sweep (amgr, &aigs);
+      btor->time.sat_sweep += btor_util_time_stamp () - start;
+    }
+  }
+  while (!BTOR_EMPTY_STACK (aigs))
+  {
+    aig = BTOR_POP_STACK (aigs);
+    if (aig == BTOR_AIG_FALSE)
+      btor->found_constraint_false = true;
+    else if (!btor->found_constraint_false)
+      btor_aig_add_toplevel_to_sat (amgr, aig);
+    btor_aig_release (amgr, aig);
+  }
+  BTOR_RELEASE_STACK (aigs);
 }
 
 void
@@ -1814,9 +1972,9 @@ exp_to_cnf_lit (Btor *btor, BtorNode *exp)
       sign *= -1;
     }
 
-    if (!aig->cnf_id) btor_aig_to_sat_tseitin (amgr, aig);
+    if (!btor_aig_is_encoded (amgr, aig)) btor_aig_to_sat_tseitin (amgr, aig);
 
-    res = aig->cnf_id;
+    res = btor_aig_get_cnf_id (amgr, aig);
     btor_aig_release (amgr, aig);
 
     if ((val = btor_sat_fixed (smgr, res)))
@@ -2493,7 +2651,7 @@ btor_synthesize_exp (Btor *btor,
   bool invert_av1 = false;
   bool invert_av2 = false;
   double start;
-  bool restart, opt_lazy_synth;
+  bool restart, opt_lazy_synth, opt_defer_cnf;
   BtorIntHashTable *cache;
 
   assert (btor);
@@ -2505,6 +2663,9 @@ btor_synthesize_exp (Btor *btor,
   count          = 0;
   cache          = btor_hashint_table_new (mm);
   opt_lazy_synth = btor_opt_get (btor, BTOR_OPT_FUN_LAZY_SYNTHESIZE) == 1;
+  opt_defer_cnf  = btor_opt_get (btor, BTOR_OPT_CNF_ENC) == BTOR_CNF_ENC_PG
+                  || btor_opt_get (btor, BTOR_OPT_AIG_REWRITE)
+                  || btor_opt_get (btor, BTOR_OPT_SAT_SWEEP);
 
   BTOR_INIT_STACK (mm, exp_stack);
   BTOR_PUSH_STACK (exp_stack, exp);
@@ -2705,7 +2866,8 @@ btor_synthesize_exp (Btor *btor,
           if (invert_av0) btor_aigvec_invert (avmgr, av0);
           if (invert_av1) btor_aigvec_invert (avmgr, av1);
         }
-        if (!opt_lazy_synth) btor_aigvec_to_sat_tseitin (avmgr, cur->av);
+        if (!opt_lazy_synth && !opt_defer_cnf)
+          btor_aigvec_to_sat_tseitin (avmgr, cur->av);
       }
       else
       {
@@ -2754,7 +2916,11 @@ btor_synthesize_exp (Btor *btor,
       }
       assert (cur->av);
       BTORLOG (2, "  synthesized: %s", btor_util_node2string (cur));
-      btor_aigvec_to_sat_tseitin (avmgr, cur->av);
+      /* with Plaisted-Greenbaum encoding, AIGs are encoded on demand in the
+       * polarities they occur in (see btor_aig_add_toplevel_to_sat), with
+       * AIG rewriting and SAT sweeping, AIGs are encoded after they are
+       * simplified */
+      if (!opt_defer_cnf) btor_aigvec_to_sat_tseitin (avmgr, cur->av);
     }
   }
   BTOR_RELEASE_STACK (exp_stack);
@@ -2838,8 +3004,8 @@ btor_add_again_assumptions (Btor *btor)
     if (aig == BTOR_AIG_TRUE) continue;
     if (btor_sat_is_initialized (smgr))
     {
-      assert (btor_aig_get_cnf_id (aig) != 0);
-      btor_sat_assume (smgr, btor_aig_get_cnf_id (aig));
+      assert (btor_aig_get_cnf_id (amgr, aig) != 0);
+      btor_sat_assume (smgr, btor_aig_get_cnf_id (amgr, aig));
     }
     btor_aig_release (amgr, aig);
   }
@@ -3008,6 +3174,11 @@ btor_check_sat (Btor *btor, int32_t lod_limit, int32_t sat_limit)
                    "Quantifiers not supported for -E aigprop");
         btor->slv = btor_new_aigprop_solver (btor);
       }
+      else if (engine == BTOR_ENGINE_PORTFOLIO
+               && btor->quantifiers->count == 0)
+      {
+        btor->slv = btor_new_portfolio_solver (btor);
+      }
       else if ((engine == BTOR_ENGINE_QUANT && btor->quantifiers->count > 0)
                || btor->quantifiers->count > 0)
       {
@@ -3069,7 +3240,10 @@ btor_check_sat (Btor *btor, int32_t lod_limit, int32_t sat_limit)
 
   if (chkmodel)
   {
-    if (res == BTOR_RESULT_SAT && !btor_opt_get (btor, BTOR_OPT_UCOPT))
+    if (res == BTOR_RESULT_SAT
+        && (!btor_opt_get (btor, BTOR_OPT_UCOPT)
+            || btor_opt_get (btor, BTOR_OPT_MODEL_GEN)
+            || btor_opt_get (btor, BTOR_OPT_INCREMENTAL)))
     {
       btor_check_model (chkmodel);
     }
@@ -21,9 +21,11 @@
 #include "btorslv.h"
 #include "btorsort.h"
 #include "btortypes.h"
+#include "preprocess/btorpreprocess.h"
 #include "utils/btorhashint.h"
 #include "utils/btormem.h"
 #include "utils/btorrng.h"
+#include "utils/btoruniquetable.h"
 
 #include <stdbool.h>
 
@@ -33,6 +35,8 @@
 #define BTOR_DO_NOT_PROCESS_SKELETON
 #endif
 
+#define BTOR_NODE2STRING_BUF_SIZE 1024
+
 // Currently, 'BoolectorNode' (external) vs. 'BtorNode' (internal)
 // syntactically hides internal nodes.  Hence, we assume that both structs
 // 'BoolectorNode' and 'BtorNode' have/ the same structure and provide the
@@ -52,15 +56,6 @@
 
 /*------------------------------------------------------------------------*/
 
-struct BtorNodeUniqueTable
-{
-  uint32_t size;
-  uint32_t num_elements;
-  BtorNode **chains;
-};
-
-typedef struct BtorNodeUniqueTable BtorNodeUniqueTable;
-
 struct BtorCallbacks
 {
   struct
@@ -87,6 +82,26 @@ struct BtorConstraintStats
 
 typedef struct BtorConstraintStats BtorConstraintStats;
 
+/* Unconstrained term that was substituted by a fresh variable during
+ * unconstrained optimization.  The term itself becomes a proxy, hence its
+ * kind and children are recorded in order to reconstruct the values of its
+ * unconstrained children from the value of the fresh variable. */
+struct BtorUCTerm
+{
+  BtorNodeKind kind;
+  uint32_t arity;
+  uint32_t upper; /* slice only */
+  uint32_t lower; /* slice only */
+  uint32_t uc;    /* bit i is set if child i is unconstrained */
+  BtorNode *e[3];
+  BtorNode *exp;   /* the term (a proxy after substitution) */
+  BtorNode *subst; /* the fresh variable */
+};
+
+typedef struct BtorUCTerm BtorUCTerm;
+
+BTOR_DECLARE_STACK (BtorUCTermPtr, BtorUCTerm *);
+
 struct Btor
 {
   BtorMemMgr *mm;
@@ -97,7 +112,7 @@ struct Btor
   BtorFunAssList *fun_assignments;
 
   BtorNodePtrStack nodes_id_table;
-  BtorNodeUniqueTable nodes_unique_table;
+  BtorUniqueTable nodes_unique_table;
   BtorSortUniqueTable sorts_unique_table;
 
   BtorAIGVecMgr *avmgr;
@@ -160,6 +175,17 @@ struct Btor
   /* Number of push/pop calls (used for unique symbol prefixes) */
   uint32_t num_push_pop;
 
+  /* unconstrained terms in substitution order (for model reconstruction) */
+  BtorUCTermPtrStack uc_terms;
+
+  /* preprocessing pipeline (see btor_pp_set_order) */
+  struct
+  {
+    BtorPPPass order[BTOR_PP_NUM_PASSES]; /* configurable passes in order */
+    uint32_t num_passes;                  /* 0: default order */
+    double budget[BTOR_PP_NUM_PASSES];    /* seconds per call, 0: no limit */
+  } pp;
+
 #ifndef NDEBUG
   Btor *clone; /* shadow clone (debugging only) */
 #endif
@@ -175,6 +201,13 @@ struct Btor
   BtorMsg *msg;
   BtorRNG rng;
 
+  /* ring buffer for strings returned by btor_util_node2string (logging) */
+  struct
+  {
+    char buf[BTOR_NODE2STRING_BUF_SIZE];
+    uint32_t pos;
+  } node2string;
+
   struct
   {
     uint32_t cur, max;
@@ -211,6 +244,7 @@ struct Btor
     BtorPtrHashTable *rw_rules_applied;
 #endif
     uint_least64_t rewrite_synth;
+    BtorPPStats pp[BTOR_PP_NUM_PASSES]; /* per preprocessing pass */
   } stats;
 
   struct
@@ -229,6 +263,8 @@ struct Btor
     double failed;
     double cloning;
     double synth_exp;
+    double aig_rewrite;
+    double sat_sweep;
     double model_gen;
     double ucopt;
     double merge;
@@ -236,6 +272,7 @@ struct Btor
     double ack;
     double rewrite;
     double occurrence;
+    double pp[BTOR_PP_NUM_PASSES]; /* per preprocessing pass */
   } time;
 };
 
@@ -54,20 +54,26 @@ btor_dbg_check_lambdas_static_rho_proxy_free (const Btor *btor)
 bool
 btor_dbg_check_unique_table_children_proxy_free (const Btor *btor)
 {
-  uint32_t i, j;
+  uint32_t j;
+  int32_t id;
   BtorNode *cur;
+  BtorUniqueTableIterator it;
 
-  for (i = 0; i < btor->nodes_unique_table.size; i++)
-    for (cur = btor->nodes_unique_table.chains[i]; cur; cur = cur->next)
-      for (j = 0; j < cur->arity; j++)
-        if (btor_node_is_proxy (cur->e[j]))
-        {
-          BTORLOG (1,
-                   "found proxy node in unique table: %s (parent: %s)",
-                   btor_util_node2string (cur->e[j]),
-                   btor_util_node2string (cur));
-          return false;
-        }
+  btor_iter_uniquetable_init (&it, &btor->nodes_unique_table);
+  while (btor_iter_uniquetable_has_next (&it))
+  {
+    id  = btor_iter_uniquetable_next (&it);
+    cur = BTOR_PEEK_STACK (btor->nodes_id_table, id);
+    for (j = 0; j < cur->arity; j++)
+      if (btor_node_is_proxy (cur->e[j]))
+      {
+        BTORLOG (1,
+                 "found proxy node in unique table: %s (parent: %s)",
+                 btor_util_node2string (cur->e[j]),
+                 btor_util_node2string (cur));
+        return false;
+      }
+  }
   return true;
 }
 
@@ -112,20 +118,23 @@ btor_dbg_check_hash_table_simp_free (BtorPtrHashTable *table)
 bool
 btor_dbg_check_unique_table_rebuild (const Btor *btor)
 {
-  uint32_t i;
+  int32_t id;
   BtorNode *cur;
+  BtorUniqueTableIterator it;
 
-  for (i = 0; i < btor->nodes_unique_table.size; i++)
-    for (cur = btor->nodes_unique_table.chains[i]; cur; cur = cur->next)
+  btor_iter_uniquetable_init (&it, &btor->nodes_unique_table);
+  while (btor_iter_uniquetable_has_next (&it))
+  {
+    id  = btor_iter_uniquetable_next (&it);
+    cur = BTOR_PEEK_STACK (btor->nodes_id_table, id);
+    if (cur->rebuild)
     {
-      if (cur->rebuild)
-      {
-        BTORLOG (1,
-                 "found node with rebuild flag enabled: %s",
-                 btor_util_node2string (cur));
-        return false;
-      }
+      BTORLOG (1,
+               "found node with rebuild flag enabled: %s",
+               btor_util_node2string (cur));
+      return false;
     }
+  }
   return true;
 }
 
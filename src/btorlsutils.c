@@ -65,6 +65,122 @@ update_roots_table (Btor *btor,
   }
 }
 
+/*------------------------------------------------------------------------*/
+
+/**
+ * Binary min-heap of nodes ordered by id. The id of a node is always greater
+ * than the ids of its children, hence popping nodes in ascending id order
+ * guarantees that all children of a node are up-to-date when it is processed.
+ */
+
+static void
+push_cone_heap (BtorNodePtrStack *heap, BtorIntHashTable *queued, BtorNode *exp)
+{
+  assert (heap);
+  assert (queued);
+  assert (btor_node_is_regular (exp));
+
+  size_t i, p;
+
+  if (btor_hashint_table_contains (queued, exp->id)) return;
+  btor_hashint_table_add (queued, exp->id);
+  BTOR_PUSH_STACK (*heap, exp);
+  for (i = BTOR_COUNT_STACK (*heap) - 1; i > 0; i = p)
+  {
+    p = (i - 1) / 2;
+    if (heap->start[p]->id <= heap->start[i]->id) break;
+    BTOR_SWAP (BtorNode *, heap->start[p], heap->start[i]);
+  }
+}
+
+static BtorNode *
+pop_cone_heap (BtorNodePtrStack *heap)
+{
+  assert (heap);
+  assert (!BTOR_EMPTY_STACK (*heap));
+
+  size_t i, c, n;
+  BtorNode *res, *last;
+
+  res  = heap->start[0];
+  last = BTOR_POP_STACK (*heap);
+  n    = BTOR_COUNT_STACK (*heap);
+  if (n)
+  {
+    heap->start[0] = last;
+    for (i = 0; (c = 2 * i + 1) < n; i = c)
+    {
+      if (c + 1 < n && heap->start[c + 1]->id < heap->start[c]->id) c += 1;
+      if (heap->start[i]->id <= heap->start[c]->id) break;
+      BTOR_SWAP (BtorNode *, heap->start[i], heap->start[c]);
+    }
+  }
+  return res;
+}
+
+static void
+push_cone_heap_parents (BtorNodePtrStack *heap,
+                        BtorIntHashTable *queued,
+                        BtorNode *exp)
+{
+  BtorNodeIterator nit;
+
+  btor_iter_parent_init (&nit, exp);
+  while (btor_iter_parent_has_next (&nit))
+    push_cone_heap (heap, queued, btor_iter_parent_next (&nit));
+}
+
+static bool
+children_contained (BtorNode *exp, BtorIntHashTable *t)
+{
+  uint32_t i;
+  for (i = 0; i < exp->arity; i++)
+    if (btor_hashint_table_contains (t, btor_node_real_addr (exp->e[i])->id))
+      return true;
+  return false;
+}
+
+/* Recompute the score of given node (both polarities), returns true if the
+ * score changed. */
+static bool
+update_score (Btor *btor,
+              BtorIntHashTable *bv_model,
+              BtorIntHashTable *score,
+              BtorNode *exp)
+{
+  assert (btor_node_is_regular (exp));
+  assert (btor_node_bv_get_width (btor, exp) == 1);
+
+  bool res;
+  double sc;
+  BtorHashTableData *d;
+
+  res = false;
+
+  assert (btor_hashint_map_contains (score, btor_node_get_id (exp)));
+  d  = btor_hashint_map_get (score, btor_node_get_id (exp));
+  sc = btor_slsutils_compute_score_node (
+      btor, bv_model, btor->fun_model, score, exp);
+  if (sc != d->as_dbl)
+  {
+    d->as_dbl = sc;
+    res       = true;
+  }
+
+  assert (btor_hashint_map_contains (score, -btor_node_get_id (exp)));
+  d  = btor_hashint_map_get (score, -btor_node_get_id (exp));
+  sc = btor_slsutils_compute_score_node (
+      btor, bv_model, btor->fun_model, score, btor_node_invert (exp));
+  if (sc != d->as_dbl)
+  {
+    d->as_dbl = sc;
+    res       = true;
+  }
+  return res;
+}
+
+/*------------------------------------------------------------------------*/
+
 /**
  * Update cone of influence.
  *
@@ -87,6 +203,7 @@ btor_lsutils_update_cone (Btor *btor,
                           BtorIntHashTable *exps,
                           bool update_roots,
                           uint64_t *stats_updates,
+                          uint64_t *stats_evals,
                           double *time_update_cone,
                           double *time_update_cone_reset,
                           double *time_update_cone_model_gen,
@@ -104,16 +221,18 @@ btor_lsutils_update_cone (Btor *btor,
   assert (time_update_cone);
   assert (time_update_cone_reset);
   assert (time_update_cone_model_gen);
+  assert (stats_updates);
+  assert (stats_evals);
 
   double start, delta;
-  uint32_t i, j;
+  uint32_t j;
   int32_t id;
+  bool evaluated;
   BtorNode *exp, *cur;
-  BtorNodeIterator nit;
   BtorIntHashTableIterator iit;
   BtorHashTableData *d;
-  BtorNodePtrStack stack, cone;
-  BtorIntHashTable *cache;
+  BtorNodePtrStack heap;
+  BtorIntHashTable *changed, *rescored, *queued;
   BtorBitVector *bv, *e[3], *ass;
   BtorMemMgr *mm;
 
@@ -140,38 +259,10 @@ btor_lsutils_update_cone (Btor *btor,
   }
 #endif
 
-  /* reset cone ----------------------------------------------------------- */
-
-  BTOR_INIT_STACK (mm, cone);
-  BTOR_INIT_STACK (mm, stack);
-  btor_iter_hashint_init (&iit, exps);
-  while (btor_iter_hashint_has_next (&iit))
-  {
-    exp = btor_node_get_by_id (btor, btor_iter_hashint_next (&iit));
-    assert (btor_node_is_regular (exp));
-    assert (btor_node_is_bv_var (exp));
-    BTOR_PUSH_STACK (stack, exp);
-  }
-  cache = btor_hashint_table_new (mm);
-  while (!BTOR_EMPTY_STACK (stack))
-  {
-    cur = BTOR_POP_STACK (stack);
-    assert (btor_node_is_regular (cur));
-    if (btor_hashint_table_contains (cache, cur->id)) continue;
-    btor_hashint_table_add (cache, cur->id);
-    if (!btor_hashint_table_contains (exps, cur->id))
-      BTOR_PUSH_STACK (cone, cur);
-    *stats_updates += 1;
-
-    /* push parents */
-    btor_iter_parent_init (&nit, cur);
-    while (btor_iter_parent_has_next (&nit))
-      BTOR_PUSH_STACK (stack, btor_iter_parent_next (&nit));
-  }
-  BTOR_RELEASE_STACK (stack);
-  btor_hashint_table_delete (cache);
-
-  *time_update_cone_reset += btor_util_time_stamp () - delta;
+  changed  = btor_hashint_table_new (mm);
+  rescored = btor_hashint_table_new (mm);
+  queued   = btor_hashint_table_new (mm);
+  BTOR_INIT_STACK (mm, heap);
 
   /* update assignment and score of exps ----------------------------------- */
 
@@ -180,17 +271,21 @@ btor_lsutils_update_cone (Btor *btor,
   {
     ass = (BtorBitVector *) exps->data[iit.cur_pos].as_ptr;
     exp = btor_node_get_by_id (btor, btor_iter_hashint_next (&iit));
+    assert (btor_node_is_regular (exp));
+    assert (btor_node_is_bv_var (exp));
 
-    /* update model */
     d = btor_hashint_map_get (bv_model, exp->id);
     assert (d);
+
+    /* old assignment == new assignment, nothing to propagate */
+    if (!btor_bv_compare (d->as_ptr, ass)) continue;
+
+    /* update model */
     if (update_roots
         && (exp->constraint || btor_hashptr_table_get (btor->assumptions, exp)
             || btor_hashptr_table_get (btor->assumptions,
-                                       btor_node_invert (exp)))
-        && btor_bv_compare (d->as_ptr, ass))
+                                       btor_node_invert (exp))))
     {
-      /* old assignment != new assignment */
       update_roots_table (btor, roots, exp, ass);
     }
     btor_bv_free (mm, d->as_ptr);
@@ -200,135 +295,139 @@ btor_lsutils_update_cone (Btor *btor,
       btor_bv_free (mm, d->as_ptr);
       d->as_ptr = btor_bv_not (mm, ass);
     }
+    btor_hashint_table_add (changed, exp->id);
+    push_cone_heap_parents (&heap, queued, exp);
 
     /* update score */
-    if (score && btor_node_bv_get_width (btor, exp) == 1)
+    if (score && btor_node_bv_get_width (btor, exp) == 1
+        && update_score (btor, bv_model, score, exp))
     {
-      assert (btor_hashint_map_contains (score, btor_node_get_id (exp)));
-      btor_hashint_map_get (score, btor_node_get_id (exp))->as_dbl =
-          btor_slsutils_compute_score_node (
-              btor, bv_model, btor->fun_model, score, exp);
-
-      assert (btor_hashint_map_contains (score, -btor_node_get_id (exp)));
-      btor_hashint_map_get (score, -btor_node_get_id (exp))->as_dbl =
-          btor_slsutils_compute_score_node (
-              btor, bv_model, btor->fun_model, score, btor_node_invert (exp));
+      btor_hashint_table_add (rescored, exp->id);
     }
   }
 
-  qsort (cone.start,
-         BTOR_COUNT_STACK (cone),
-         sizeof (BtorNode *),
-         btor_node_compare_by_id_qsort_asc);
-
-  /* update model of cone ------------------------------------------------- */
+  *time_update_cone_reset += btor_util_time_stamp () - delta;
 
-  delta = btor_util_time_stamp ();
+  /* update model and score of cone --------------------------------------- */
 
-  for (i = 0; i < BTOR_COUNT_STACK (cone); i++)
+  /* Only nodes with children that changed their assignment are re-evaluated,
+   * and only nodes with children that changed their assignment or score are
+   * rescored. Parents are only visited if either changed. */
+  while (!BTOR_EMPTY_STACK (heap))
   {
-    cur = BTOR_PEEK_STACK (cone, i);
+    cur = pop_cone_heap (&heap);
     assert (btor_node_is_regular (cur));
-    for (j = 0; j < cur->arity; j++)
+    assert (!btor_hashint_table_contains (exps, cur->id));
+    *stats_updates += 1;
+
+    evaluated = false;
+    if (children_contained (cur, changed))
     {
-      if (btor_node_is_bv_const (cur->e[j]))
+      delta     = btor_util_time_stamp ();
+      evaluated = true;
+      *stats_evals += 1;
+
+      for (j = 0; j < cur->arity; j++)
       {
-        e[j] =
-            btor_node_is_inverted (cur->e[j])
-                ? btor_bv_copy (mm, btor_node_bv_const_get_invbits (cur->e[j]))
-                : btor_bv_copy (mm, btor_node_bv_const_get_bits (cur->e[j]));
+        if (btor_node_is_bv_const (cur->e[j]))
+        {
+          e[j] = btor_node_is_inverted (cur->e[j])
+                     ? btor_bv_copy (mm,
+                                     btor_node_bv_const_get_invbits (cur->e[j]))
+                     : btor_bv_copy (mm,
+                                     btor_node_bv_const_get_bits (cur->e[j]));
+        }
+        else
+        {
+          d = btor_hashint_map_get (bv_model,
+                                    btor_node_real_addr (cur->e[j])->id);
+          /* Note: generate model enabled branch for ite (and does not
+           * generate model for nodes in the branch, hence !b may happen */
+          if (!d)
+            e[j] = btor_model_recursively_compute_assignment (
+                btor, bv_model, btor->fun_model, cur->e[j]);
+          else
+            e[j] = btor_node_is_inverted (cur->e[j])
+                       ? btor_bv_not (mm, d->as_ptr)
+                       : btor_bv_copy (mm, d->as_ptr);
+        }
       }
-      else
+      switch (cur->kind)
       {
-        d = btor_hashint_map_get (bv_model,
-                                  btor_node_real_addr (cur->e[j])->id);
-        /* Note: generate model enabled branch for ite (and does not
-         * generate model for nodes in the branch, hence !b may happen */
-        if (!d)
-          e[j] = btor_model_recursively_compute_assignment (
-              btor, bv_model, btor->fun_model, cur->e[j]);
-        else
-          e[j] = btor_node_is_inverted (cur->e[j])
-                     ? btor_bv_not (mm, d->as_ptr)
-                     : btor_bv_copy (mm, d->as_ptr);
+        case BTOR_BV_ADD_NODE: bv = btor_bv_add (mm, e[0], e[1]); break;
+        case BTOR_BV_AND_NODE: bv = btor_bv_and (mm, e[0], e[1]); break;
+        case BTOR_BV_EQ_NODE: bv = btor_bv_eq (mm, e[0], e[1]); break;
+        case BTOR_BV_ULT_NODE: bv = btor_bv_ult (mm, e[0], e[1]); break;
+        case BTOR_BV_SLL_NODE: bv = btor_bv_sll (mm, e[0], e[1]); break;
+        case BTOR_BV_SRL_NODE: bv = btor_bv_srl (mm, e[0], e[1]); break;
+        case BTOR_BV_MUL_NODE: bv = btor_bv_mul (mm, e[0], e[1]); break;
+        case BTOR_BV_UDIV_NODE: bv = btor_bv_udiv (mm, e[0], e[1]); break;
+        case BTOR_BV_UREM_NODE: bv = btor_bv_urem (mm, e[0], e[1]); break;
+        case BTOR_BV_CONCAT_NODE: bv = btor_bv_concat (mm, e[0], e[1]); break;
+        case BTOR_BV_SLICE_NODE:
+          bv = btor_bv_slice (mm,
+                              e[0],
+                              btor_node_bv_slice_get_upper (cur),
+                              btor_node_bv_slice_get_lower (cur));
+          break;
+        default:
+          assert (btor_node_is_cond (cur));
+          bv = btor_bv_is_true (e[0]) ? btor_bv_copy (mm, e[1])
+                                      : btor_bv_copy (mm, e[2]);
       }
-    }
-    switch (cur->kind)
-    {
-      case BTOR_BV_ADD_NODE: bv = btor_bv_add (mm, e[0], e[1]); break;
-      case BTOR_BV_AND_NODE: bv = btor_bv_and (mm, e[0], e[1]); break;
-      case BTOR_BV_EQ_NODE: bv = btor_bv_eq (mm, e[0], e[1]); break;
-      case BTOR_BV_ULT_NODE: bv = btor_bv_ult (mm, e[0], e[1]); break;
-      case BTOR_BV_SLL_NODE: bv = btor_bv_sll (mm, e[0], e[1]); break;
-      case BTOR_BV_SRL_NODE: bv = btor_bv_srl (mm, e[0], e[1]); break;
-      case BTOR_BV_MUL_NODE: bv = btor_bv_mul (mm, e[0], e[1]); break;
-      case BTOR_BV_UDIV_NODE: bv = btor_bv_udiv (mm, e[0], e[1]); break;
-      case BTOR_BV_UREM_NODE: bv = btor_bv_urem (mm, e[0], e[1]); break;
-      case BTOR_BV_CONCAT_NODE: bv = btor_bv_concat (mm, e[0], e[1]); break;
-      case BTOR_BV_SLICE_NODE:
-        bv = btor_bv_slice (mm,
-                            e[0],
-                            btor_node_bv_slice_get_upper (cur),
-                            btor_node_bv_slice_get_lower (cur));
-        break;
-      default:
-        assert (btor_node_is_cond (cur));
-        bv = btor_bv_is_true (e[0]) ? btor_bv_copy (mm, e[1])
-                                    : btor_bv_copy (mm, e[2]);
-    }
-
-    /* update assignment */
 
-    d = btor_hashint_map_get (bv_model, cur->id);
+      d = btor_hashint_map_get (bv_model, cur->id);
 
-    /* update roots table */
-    if (update_roots
-        && (cur->constraint || btor_hashptr_table_get (btor->assumptions, cur)
-            || btor_hashptr_table_get (btor->assumptions,
-                                       btor_node_invert (cur))))
-    {
-      assert (d); /* must be contained, is root */
       /* old assignment != new assignment */
-      if (btor_bv_compare (d->as_ptr, bv))
-        update_roots_table (btor, roots, cur, bv);
-    }
-
-    /* update assignments */
-    /* Note: generate model enabled branch for ite (and does not generate
-     *       model for nodes in the branch, hence !b may happen */
-    if (!d)
-    {
-      btor_node_copy (btor, cur);
-      btor_hashint_map_add (bv_model, cur->id)->as_ptr = bv;
-    }
-    else
-    {
-      btor_bv_free (mm, d->as_ptr);
-      d->as_ptr = bv;
-    }
+      if (!d || btor_bv_compare (d->as_ptr, bv))
+      {
+        /* update roots table */
+        if (update_roots
+            && (cur->constraint
+                || btor_hashptr_table_get (btor->assumptions, cur)
+                || btor_hashptr_table_get (btor->assumptions,
+                                           btor_node_invert (cur))))
+        {
+          assert (d); /* must be contained, is root */
+          update_roots_table (btor, roots, cur, bv);
+        }
+
+        /* update assignments */
+        /* Note: generate model enabled branch for ite (and does not generate
+         *       model for nodes in the branch, hence !b may happen */
+        if (!d)
+        {
+          btor_node_copy (btor, cur);
+          btor_hashint_map_add (bv_model, cur->id)->as_ptr = bv;
+        }
+        else
+        {
+          btor_bv_free (mm, d->as_ptr);
+          d->as_ptr = bv;
+        }
+
+        if ((d = btor_hashint_map_get (bv_model, -cur->id)))
+        {
+          btor_bv_free (mm, d->as_ptr);
+          d->as_ptr = btor_bv_not (mm, bv);
+        }
+
+        btor_hashint_table_add (changed, cur->id);
+        push_cone_heap_parents (&heap, queued, cur);
+      }
+      else
+      {
+        btor_bv_free (mm, bv);
+      }
 
-    if ((d = btor_hashint_map_get (bv_model, -cur->id)))
-    {
-      btor_bv_free (mm, d->as_ptr);
-      d->as_ptr = btor_bv_not (mm, bv);
+      /* cleanup */
+      for (j = 0; j < cur->arity; j++) btor_bv_free (mm, e[j]);
+      *time_update_cone_model_gen += btor_util_time_stamp () - delta;
     }
-    /* cleanup */
-    for (j = 0; j < cur->arity; j++) btor_bv_free (mm, e[j]);
-  }
-  *time_update_cone_model_gen += btor_util_time_stamp () - delta;
-
-  /* update score of cone ------------------------------------------------- */
 
-  if (score)
-  {
-    delta = btor_util_time_stamp ();
-    for (i = 0; i < BTOR_COUNT_STACK (cone); i++)
+    /* update score */
+    if (score && btor_node_bv_get_width (btor, cur) == 1)
     {
-      cur = BTOR_PEEK_STACK (cone, i);
-      assert (btor_node_is_regular (cur));
-
-      if (btor_node_bv_get_width (btor, cur) != 1) continue;
-
       id = btor_node_get_id (cur);
       if (!btor_hashint_map_contains (score, id))
       {
@@ -336,18 +435,22 @@ btor_lsutils_update_cone (Btor *btor,
         assert (!btor_hashint_map_contains (score, -id));
         continue;
       }
-      btor_hashint_map_get (score, id)->as_dbl =
-          btor_slsutils_compute_score_node (
-              btor, bv_model, btor->fun_model, score, cur);
-      assert (btor_hashint_map_contains (score, -id));
-      btor_hashint_map_get (score, -id)->as_dbl =
-          btor_slsutils_compute_score_node (
-              btor, bv_model, btor->fun_model, score, btor_node_invert (cur));
+      if (!evaluated && !children_contained (cur, rescored)) continue;
+
+      delta = btor_util_time_stamp ();
+      if (update_score (btor, bv_model, score, cur))
+      {
+        btor_hashint_table_add (rescored, cur->id);
+        push_cone_heap_parents (&heap, queued, cur);
+      }
+      *time_update_cone_compute_score += btor_util_time_stamp () - delta;
     }
-    *time_update_cone_compute_score += btor_util_time_stamp () - delta;
   }
 
-  BTOR_RELEASE_STACK (cone);
+  BTOR_RELEASE_STACK (heap);
+  btor_hashint_table_delete (changed);
+  btor_hashint_table_delete (rescored);
+  btor_hashint_table_delete (queued);
 
 #ifndef NDEBUG
   btor_iter_hashptr_init (&pit, btor->unsynthesized_constraints);
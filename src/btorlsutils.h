@@ -15,6 +15,11 @@
 /**
  * Update cone of incluence as a consequence of a local search move.
  *
+ * The cone is updated incrementally, i.e., a node is only re-evaluated if
+ * the assignment of one of its children changed, and only rescored if the
+ * assignment or score of one of its children changed. 'stats_updates' counts
+ * the visited nodes, 'stats_evals' the re-evaluated nodes.
+ *
  * Note: 'roots' will only be updated if 'update_roots' is true.
  *         + PROP engine: always
  *         + SLS  engine: only if an actual move is performed
@@ -27,6 +32,7 @@ void btor_lsutils_update_cone (Btor* btor,
                                BtorIntHashTable* exps,
                                bool update_roots,
                                uint64_t* stats_updates,
+                               uint64_t* stats_evals,
                                double* time_update_cone,
                                double* time_update_cone_reset,
                                double* time_update_cone_model_gen,
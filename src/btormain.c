@@ -16,6 +16,7 @@
 #include "btorexit.h"
 #include "btoropt.h"
 #include "btorparse.h"
+#include "preprocess/btorpreprocess.h"
 #include "utils/btorhashptr.h"
 #include "utils/btormem.h"
 #include "utils/btoroptparse.h"
@@ -78,6 +79,7 @@ enum BtorMainOption
   BTORMAIN_OPT_DUMP_AAG,
   BTORMAIN_OPT_DUMP_AIG,
   BTORMAIN_OPT_DUMP_AIGER_MERGE,
+  BTORMAIN_OPT_PP_ORDER,
   /* this MUST be the last entry! */
   BTORMAIN_OPT_NUM_OPTS,
 };
@@ -383,6 +385,19 @@ btormain_init_opts (BtorMainApp *app)
                      true,
                      BTOR_ARG_EXPECT_NONE,
                      "merge all roots of AIG [0]");
+  btormain_init_opt (app,
+                     BTORMAIN_OPT_PP_ORDER,
+                     true,
+                     false,
+                     "pp-order",
+                     0,
+                     0,
+                     0,
+                     0,
+                     false,
+                     BTOR_ARG_EXPECT_STR,
+                     "set order and time budgets (<pass>[:<seconds>],...) "
+                     "of preprocessing passes");
 }
 
 static bool
@@ -611,6 +626,8 @@ print_opt (BtorMainApp *app,
     sprintf (paramstr, "<seconds>");
   else if (!strcmp (lng, "output"))
     sprintf (paramstr, "<file>");
+  else if (!strcmp (lng, "pp-order"))
+    sprintf (paramstr, "<passes>");
   else if (!strcmp (lng, boolector_get_opt_lng (app->btor, BTOR_OPT_ENGINE))
            || !strcmp (lng,
                        boolector_get_opt_lng (app->btor, BTOR_OPT_SAT_ENGINE)))
@@ -789,7 +806,7 @@ print_help (BtorMainApp *app)
     if (!app->options[mo].general) continue;
     if (mo == BTORMAIN_OPT_TIME || mo == BTORMAIN_OPT_HEX
         || mo == BTORMAIN_OPT_BTOR || mo == BTORMAIN_OPT_BTOR2
-        || mo == BTORMAIN_OPT_DUMP_BTOR)
+        || mo == BTORMAIN_OPT_DUMP_BTOR || mo == BTORMAIN_OPT_PP_ORDER)
       fprintf (out, "\n");
     PRINT_MAIN_OPT (app, &app->options[mo]);
   }
@@ -1216,6 +1233,20 @@ boolector_main (int32_t argc, char **argv)
 
         case BTORMAIN_OPT_DUMP_AIGER_MERGE: dump_merge = true; break;
 
+        case BTORMAIN_OPT_PP_ORDER:
+          if (!btor_pp_set_order (btor, po->valstr))
+          {
+            btormain_error (g_app,
+                            "invalid argument '%s' for '%s', expected "
+                            "comma separated list of '%s'",
+                            po->valstr,
+                            po->orig.start,
+                            "slices|skeleton|ucopt|extract|merge|elimapplies|"
+                            "ackermann|normadd[:<seconds>]");
+            goto DONE;
+          }
+          break;
+
         default:
           /* get rid of compiler warnings, should be unreachable */
           assert (bmopt == BTORMAIN_OPT_NUM_OPTS);
@@ -168,7 +168,34 @@ init_options (BtorMC *mc)
             0,
             0,
             1,
-            "add simple path constraints");
+            "add simple path constraints (k-induction)");
+  init_opt (mc,
+            BTOR_MC_OPT_IC3,
+            true,
+            "ic3",
+            0,
+            0,
+            0,
+            1,
+            "enable IC3 (property directed reachability)");
+  init_opt (mc,
+            BTOR_MC_OPT_JOBS,
+            false,
+            "jobs",
+            "j",
+            0,
+            0,
+            UINT32_MAX,
+            "check properties individually with given number of threads");
+  init_opt (mc,
+            BTOR_MC_OPT_PROP_TIME,
+            false,
+            "prop-time",
+            0,
+            0,
+            0,
+            UINT32_MAX,
+            "wall-clock time limit in seconds per property (with --jobs)");
 }
 
 /*------------------------------------------------------------------------*/
@@ -219,15 +246,13 @@ copy_sort (Btor *btor, Btor *fwd, BoolectorNode *node)
 
 /*------------------------------------------------------------------------*/
 
-BtorMC *
-btor_mc_new (void)
+static BtorMC *
+new_mc (Btor *btor)
 {
   BtorMemMgr *mm;
   BtorMC *res;
-  Btor *btor;
 
-  btor = boolector_new ();
-  mm   = btor_mem_mgr_new ();
+  mm = btor_mem_mgr_new ();
   BTOR_CNEW (mm, res);
   res->mm     = mm;
   res->btor   = btor;
@@ -239,14 +264,98 @@ btor_mc_new (void)
                                         (BtorCmpPtr) btor_node_compare_by_id);
   assert (res->state == BTOR_NO_MC_STATE);
   BTOR_INIT_STACK (mm, res->frames);
+  BTOR_INIT_STACK (mm, res->ind_frames);
   BTOR_INIT_STACK (mm, res->bad);
+  BTOR_INIT_STACK (mm, res->bad_ids);
   BTOR_INIT_STACK (mm, res->constraints);
   BTOR_INIT_STACK (mm, res->reached);
-  BTOR_INIT_STACK (mm, res->init_assumptions);
+  BTOR_INIT_STACK (mm, res->proved);
+  BTOR_INIT_STACK (mm, res->invariants);
   init_options (res);
   return res;
 }
 
+BtorMC *
+btor_mc_new (void)
+{
+  return new_mc (boolector_new ());
+}
+
+BtorMC *
+btor_mc_clone (BtorMC *mc, uint32_t num_bad, const uint32_t *bad)
+{
+  assert (mc);
+  assert (mc->state == BTOR_NO_MC_STATE);
+  assert (!mc->forward);
+  assert (!mc->induction);
+  assert (!num_bad || bad);
+
+  uint32_t i, j;
+  BtorMC *res;
+  Btor *clone;
+  BtorPtrHashTableIterator it;
+  BtorPtrHashBucket *bucket;
+  BtorMCInput *input, *cinput;
+  BtorMCstate *state, *cstate;
+  BoolectorNode *node;
+
+  clone = boolector_clone (mc->btor);
+  /* the clone holds the external references of the nodes of 'mc->btor' */
+  boolector_set_opt (clone, BTOR_OPT_AUTO_CLEANUP, 1);
+  res = new_mc (clone);
+  for (i = 0; i < BTOR_MC_OPT_NUM_OPTS; i++)
+    res->options[i].val = mc->options[i].val;
+
+  btor_iter_hashptr_init (&it, mc->inputs);
+  while (btor_iter_hashptr_has_next (&it))
+  {
+    input = btor_iter_hashptr_next_data (&it)->as_ptr;
+    BTOR_NEW (res->mm, cinput);
+    cinput->id   = input->id;
+    cinput->node = boolector_match_node (clone, input->node);
+    bucket       = btor_hashptr_table_add (res->inputs, cinput->node);
+    bucket->data.as_ptr = cinput;
+  }
+  btor_iter_hashptr_init (&it, mc->states);
+  while (btor_iter_hashptr_has_next (&it))
+  {
+    state = btor_iter_hashptr_next_data (&it)->as_ptr;
+    BTOR_NEW (res->mm, cstate);
+    cstate->id   = state->id;
+    cstate->node = boolector_match_node (clone, state->node);
+    cstate->init = state->init ? boolector_match_node (clone, state->init) : 0;
+    cstate->next = state->next ? boolector_match_node (clone, state->next) : 0;
+    bucket       = btor_hashptr_table_add (res->states, cstate->node);
+    bucket->data.as_ptr = cstate;
+  }
+  res->initialized = mc->initialized;
+  res->nextstates  = mc->nextstates;
+
+  for (i = 0; i < (bad ? num_bad : BTOR_COUNT_STACK (mc->bad)); i++)
+  {
+    j = bad ? bad[i] : i;
+    assert (j < BTOR_COUNT_STACK (mc->bad));
+    node = boolector_match_node (clone, BTOR_PEEK_STACK (mc->bad, j));
+    BTOR_PUSH_STACK (res->bad, node);
+    BTOR_PUSH_STACK (res->bad_ids, BTOR_PEEK_STACK (mc->bad_ids, j));
+    BTOR_PUSH_STACK (res->reached, -1);
+    BTOR_PUSH_STACK (res->proved, -1);
+    BTOR_PUSH_STACK (res->invariants, 0);
+  }
+  for (i = 0; i < BTOR_COUNT_STACK (mc->constraints); i++)
+  {
+    node = boolector_match_node (clone, BTOR_PEEK_STACK (mc->constraints, i));
+    BTOR_PUSH_STACK (res->constraints, node);
+  }
+
+  BTOR_MSG (boolector_get_btor_msg (mc->btor),
+            2,
+            "cloned model checker with %u of %u bad state properties",
+            BTOR_COUNT_STACK (res->bad),
+            BTOR_COUNT_STACK (mc->bad));
+  return res;
+}
+
 /*------------------------------------------------------------------------*/
 
 static void
@@ -274,27 +383,27 @@ delete_mc_state (BtorMC *mc, BtorMCstate *state)
 }
 
 static void
-release_mc_frame_stack (BtorMC *mc, BoolectorNodePtrStack *stack)
+release_mc_frame_stack (Btor *smt, BoolectorNodePtrStack *stack)
 {
   BoolectorNode *node;
 
   while (!BTOR_EMPTY_STACK (*stack))
   {
     node = BTOR_POP_STACK (*stack);
-    if (node) boolector_release (mc->forward, node);
+    if (node) boolector_release (smt, node);
   }
 
   BTOR_RELEASE_STACK (*stack);
 }
 
 static void
-release_mc_frame (BtorMC *mc, BtorMCFrame *frame)
+release_mc_frame (Btor *smt, BtorMCFrame *frame)
 {
-  release_mc_frame_stack (mc, &frame->inputs);
-  release_mc_frame_stack (mc, &frame->init);
-  release_mc_frame_stack (mc, &frame->states);
-  release_mc_frame_stack (mc, &frame->next);
-  release_mc_frame_stack (mc, &frame->bad);
+  release_mc_frame_stack (smt, &frame->inputs);
+  release_mc_frame_stack (smt, &frame->init);
+  release_mc_frame_stack (smt, &frame->states);
+  release_mc_frame_stack (smt, &frame->next);
+  release_mc_frame_stack (smt, &frame->bad);
 }
 
 void
@@ -319,8 +428,12 @@ btor_mc_delete (BtorMC *mc)
       mc->states->count,
       BTOR_COUNT_STACK (mc->bad),
       BTOR_COUNT_STACK (mc->constraints));
-  for (f = mc->frames.start; f < mc->frames.top; f++) release_mc_frame (mc, f);
+  for (f = mc->frames.start; f < mc->frames.top; f++)
+    release_mc_frame (mc->forward, f);
   BTOR_RELEASE_STACK (mc->frames);
+  for (f = mc->ind_frames.start; f < mc->ind_frames.top; f++)
+    release_mc_frame (mc->induction, f);
+  BTOR_RELEASE_STACK (mc->ind_frames);
   btor_iter_hashptr_init (&it, mc->inputs);
   while (btor_iter_hashptr_has_next (&it))
     delete_mc_input (mc, btor_iter_hashptr_next_data (&it)->as_ptr);
@@ -332,14 +445,22 @@ btor_mc_delete (BtorMC *mc)
   while (!BTOR_EMPTY_STACK (mc->bad))
     boolector_release (btor, BTOR_POP_STACK (mc->bad));
   BTOR_RELEASE_STACK (mc->bad);
+  BTOR_RELEASE_STACK (mc->bad_ids);
   while (!BTOR_EMPTY_STACK (mc->constraints))
     boolector_release (btor, BTOR_POP_STACK (mc->constraints));
   BTOR_RELEASE_STACK (mc->constraints);
   BTOR_RELEASE_STACK (mc->reached);
-  while (mc->forward && !BTOR_EMPTY_STACK (mc->init_assumptions))
-    boolector_release (mc->forward, BTOR_POP_STACK (mc->init_assumptions));
-  BTOR_RELEASE_STACK (mc->init_assumptions);
+  BTOR_RELEASE_STACK (mc->proved);
+  while (!BTOR_EMPTY_STACK (mc->invariants))
+  {
+    BtorIntStack *inv = BTOR_POP_STACK (mc->invariants);
+    if (!inv) continue;
+    BTOR_RELEASE_STACK (*inv);
+    BTOR_DELETE (mm, inv);
+  }
+  BTOR_RELEASE_STACK (mc->invariants);
   if (mc->forward) boolector_delete (mc->forward);
+  if (mc->induction) boolector_delete (mc->induction);
   BTOR_DELETEN (mm, mc->options, BTOR_MC_OPT_NUM_OPTS);
   BTOR_DELETE (mm, mc);
   btor_mem_mgr_delete (mm);
@@ -618,8 +739,11 @@ btor_mc_bad (BtorMC *mc, BoolectorNode *bad)
   res = BTOR_COUNT_STACK (mc->bad);
   (void) boolector_copy (btor, bad);
   BTOR_PUSH_STACK (mc->bad, bad);
+  BTOR_PUSH_STACK (mc->bad_ids, res);
   assert (res == BTOR_COUNT_STACK (mc->reached));
   BTOR_PUSH_STACK (mc->reached, -1);
+  BTOR_PUSH_STACK (mc->proved, -1);
+  BTOR_PUSH_STACK (mc->invariants, 0);
   BTOR_MSG (boolector_get_btor_msg (btor), 2, "adding BAD property %d", res);
   return res;
 }
@@ -741,12 +865,14 @@ timed_symbol (BtorMC *mc, char ch, BoolectorNode *node, int32_t time)
 }
 
 static BoolectorNode *
-new_var_or_array (BtorMC *mc, BoolectorNode *src, const char *symbol)
+new_var_or_array (BtorMC *mc,
+                  Btor *fwd,
+                  BoolectorNode *src,
+                  const char *symbol)
 {
   BoolectorNode *dst;
   BoolectorSort sort;
   Btor *btor = mc->btor;
-  Btor *fwd  = mc->forward;
 
   sort = copy_sort (btor, fwd, src);
   if (boolector_is_var (btor, src))
@@ -763,7 +889,10 @@ new_var_or_array (BtorMC *mc, BoolectorNode *src, const char *symbol)
 }
 
 static void
-initialize_inputs_of_frame (BtorMC *mc, BoolectorNodeMap *map, BtorMCFrame *f)
+initialize_inputs_of_frame (BtorMC *mc,
+                            Btor *fwd,
+                            BoolectorNodeMap *map,
+                            BtorMCFrame *f)
 {
   Btor *btor;
   BoolectorNode *src, *dst;
@@ -801,7 +930,7 @@ initialize_inputs_of_frame (BtorMC *mc, BoolectorNodeMap *map, BtorMCFrame *f)
     assert ((size_t) input->id == i);
 #endif
     sym = timed_symbol (mc, '@', src, f->time);
-    dst = new_var_or_array (mc, src, sym);
+    dst = new_var_or_array (mc, fwd, src, sym);
     btor_mem_freestr (mc->mm, sym);
     assert (BTOR_COUNT_STACK (f->inputs) == i++);
     BTOR_PUSH_STACK (f->inputs, dst);
@@ -810,9 +939,13 @@ initialize_inputs_of_frame (BtorMC *mc, BoolectorNodeMap *map, BtorMCFrame *f)
 }
 
 static void
-initialize_states_of_frame (BtorMC *mc, BoolectorNodeMap *map, BtorMCFrame *f)
+initialize_states_of_frame (BtorMC *mc,
+                            Btor *fwd,
+                            BoolectorNodeMap *map,
+                            BtorMCFrame *f,
+                            bool initialized)
 {
-  Btor *btor, *fwd;
+  Btor *btor;
   BoolectorNode *src, *dst;
   BtorPtrHashTableIterator it;
   BtorMCstate *state;
@@ -825,7 +958,6 @@ initialize_states_of_frame (BtorMC *mc, BoolectorNodeMap *map, BtorMCFrame *f)
   assert (f->time >= 0);
 
   btor = mc->btor;
-  fwd  = mc->forward;
 
   BTOR_MSG (boolector_get_btor_msg (btor),
             2,
@@ -848,10 +980,10 @@ initialize_states_of_frame (BtorMC *mc, BoolectorNodeMap *map, BtorMCFrame *f)
     assert (btor_node_is_regular ((BtorNode *) src));
     assert (state->node == src);
 
-    if (!f->time && state->init)
+    if (!f->time && state->init && initialized)
     {
-      dst = boolector_nodemap_substitute_node (mc->forward, map, state->init);
-      dst = boolector_copy (mc->forward, dst);
+      dst = boolector_nodemap_substitute_node (fwd, map, state->init);
+      dst = boolector_copy (fwd, dst);
       // special case: const initialization (constant array)
       if (boolector_is_array (btor, src) && boolector_is_const (btor, state->init))
       {
@@ -861,15 +993,6 @@ initialize_states_of_frame (BtorMC *mc, BoolectorNodeMap *map, BtorMCFrame *f)
         boolector_release (fwd, dst);
         dst = tmp;
       }
-
-      if (btor_mc_get_opt (mc, BTOR_MC_OPT_KINDUCTION))
-      {
-        BoolectorNode *init_expr = dst;
-        dst                      = new_var_or_array (mc, src, 0);
-        BTOR_PUSH_STACK (mc->init_assumptions,
-                         boolector_eq (mc->forward, dst, init_expr));
-        boolector_release (mc->forward, init_expr);
-      }
     }
     else if (f->time > 0 && state->next)
     {
@@ -880,7 +1003,7 @@ initialize_states_of_frame (BtorMC *mc, BoolectorNodeMap *map, BtorMCFrame *f)
     else
     {
       sym = timed_symbol (mc, '#', src, f->time);
-      dst = new_var_or_array (mc, src, sym);
+      dst = new_var_or_array (mc, fwd, src, sym);
       btor_mem_freestr (mc->mm, sym);
     }
     assert (BTOR_COUNT_STACK (f->states) == i);
@@ -892,6 +1015,7 @@ initialize_states_of_frame (BtorMC *mc, BoolectorNodeMap *map, BtorMCFrame *f)
 
 static void
 initialize_next_state_functions_of_frame (BtorMC *mc,
+                                          Btor *fwd,
                                           BoolectorNodeMap *map,
                                           BtorMCFrame *f)
 {
@@ -928,8 +1052,8 @@ initialize_next_state_functions_of_frame (BtorMC *mc,
     src = state->next;
     if (src)
     {
-      dst = boolector_nodemap_substitute_node (mc->forward, map, src);
-      dst = boolector_copy (mc->forward, dst);
+      dst = boolector_nodemap_substitute_node (fwd, map, src);
+      dst = boolector_copy (fwd, dst);
       BTOR_PUSH_STACK (f->next, dst);
       nextstates++;
     }
@@ -943,6 +1067,7 @@ initialize_next_state_functions_of_frame (BtorMC *mc,
 
 static void
 initialize_constraints_of_frame (BtorMC *mc,
+                                 Btor *fwd,
                                  BoolectorNodeMap *map,
                                  BtorMCFrame *f)
 {
@@ -963,13 +1088,14 @@ initialize_constraints_of_frame (BtorMC *mc,
   {
     src = BTOR_PEEK_STACK (mc->constraints, i);
     assert (src);
-    dst = boolector_nodemap_substitute_node (mc->forward, map, src);
-    boolector_assert (mc->forward, dst);
+    dst = boolector_nodemap_substitute_node (fwd, map, src);
+    boolector_assert (fwd, dst);
   }
 }
 
 static void
 initialize_bad_state_properties_of_frame (BtorMC *mc,
+                                          Btor *fwd,
                                           BoolectorNodeMap *map,
                                           BtorMCFrame *f)
 {
@@ -990,12 +1116,13 @@ initialize_bad_state_properties_of_frame (BtorMC *mc,
 
   for (i = 0; i < BTOR_COUNT_STACK (mc->bad); i++)
   {
-    if (BTOR_PEEK_STACK (mc->reached, i) < 0)
+    if (BTOR_PEEK_STACK (mc->reached, i) < 0
+        && BTOR_PEEK_STACK (mc->proved, i) < 0)
     {
       src = BTOR_PEEK_STACK (mc->bad, i);
       assert (src);
-      dst = boolector_nodemap_substitute_node (mc->forward, map, src);
-      dst = boolector_copy (mc->forward, dst);
+      dst = boolector_nodemap_substitute_node (fwd, map, src);
+      dst = boolector_copy (fwd, dst);
     }
     else
       dst = 0;
@@ -1004,52 +1131,102 @@ initialize_bad_state_properties_of_frame (BtorMC *mc,
   }
 }
 
+static Btor *
+new_unrolling (BtorMC *mc, const char *name, bool model_gen)
+{
+  assert (mc);
+
+  uint32_t v;
+  Btor *res;
+
+  BTOR_MSG (boolector_get_btor_msg (mc->btor), 1, "new %s manager", name);
+  res = boolector_new ();
+  boolector_set_opt (res, BTOR_OPT_INCREMENTAL, 1);
+  if (model_gen) boolector_set_opt (res, BTOR_OPT_MODEL_GEN, 1);
+  if ((v = btor_mc_get_opt (mc, BTOR_MC_OPT_VERBOSITY)))
+    boolector_set_opt (res, BTOR_OPT_VERBOSITY, v);
+  if (mc->call_backs.term.fun)
+    boolector_set_term (
+        res, mc->call_backs.term.fun, mc->call_backs.term.state);
+  return res;
+}
+
+/* Termination is sticky until the next model checking run. */
+static bool
+terminate_mc (BtorMC *mc)
+{
+  assert (mc);
+  if (!mc->terminated && mc->call_backs.term.fun
+      && mc->call_backs.term.fun (mc->call_backs.term.state))
+    mc->terminated = true;
+  return mc->terminated;
+}
+
 static void
-initialize_new_forward_frame (BtorMC *mc)
+initialize_new_frame (BtorMC *mc,
+                      Btor *fwd,
+                      BtorMCFrameStack *frames,
+                      bool initialized)
 {
   assert (mc);
+  assert (fwd);
+  assert (frames);
 
-  Btor *btor;
   BtorMCFrame frame, *f;
   BoolectorNodeMap *map;
   int32_t time;
 
-  btor = mc->btor;
-
-  time = BTOR_COUNT_STACK (mc->frames);
+  time = BTOR_COUNT_STACK (*frames);
   BTOR_CLR (&frame);
-  BTOR_PUSH_STACK (mc->frames, frame);
-  f       = mc->frames.start + time;
+  BTOR_PUSH_STACK (*frames, frame);
+  f       = frames->start + time;
   f->time = time;
 
-  if (!mc->forward)
-  {
-    uint32_t v;
-    BTOR_MSG (boolector_get_btor_msg (btor), 1, "new forward manager");
-    mc->forward = boolector_new ();
-    boolector_set_opt (mc->forward, BTOR_OPT_INCREMENTAL, 1);
-    if (btor_mc_get_opt (mc, BTOR_MC_OPT_TRACE_GEN))
-      boolector_set_opt (mc->forward, BTOR_OPT_MODEL_GEN, 1);
-    if ((v = btor_mc_get_opt (mc, BTOR_MC_OPT_VERBOSITY)))
-      boolector_set_opt (mc->forward, BTOR_OPT_VERBOSITY, v);
-  }
-
   BTOR_INIT_STACK (mc->mm, f->init);
 
-  map = boolector_nodemap_new (mc->forward);
+  map = boolector_nodemap_new (fwd);
 
-  initialize_inputs_of_frame (mc, map, f);
-  initialize_states_of_frame (mc, map, f);
-  initialize_next_state_functions_of_frame (mc, map, f);
-  initialize_constraints_of_frame (mc, map, f);
-  initialize_bad_state_properties_of_frame (mc, map, f);
+  initialize_inputs_of_frame (mc, fwd, map, f);
+  initialize_states_of_frame (mc, fwd, map, f, initialized);
+  initialize_next_state_functions_of_frame (mc, fwd, map, f);
+  initialize_constraints_of_frame (mc, fwd, map, f);
+  initialize_bad_state_properties_of_frame (mc, fwd, map, f);
 
   boolector_nodemap_delete (map);
+}
 
-  BTOR_MSG (boolector_get_btor_msg (btor),
+static void
+initialize_new_forward_frame (BtorMC *mc)
+{
+  assert (mc);
+
+  if (!mc->forward)
+    mc->forward = new_unrolling (
+        mc, "forward", btor_mc_get_opt (mc, BTOR_MC_OPT_TRACE_GEN));
+  initialize_new_frame (mc, mc->forward, &mc->frames, true);
+
+  BTOR_MSG (boolector_get_btor_msg (mc->btor),
             1,
             "initialized forward frame at bound k = %d",
-            time);
+            BTOR_COUNT_STACK (mc->frames) - 1);
+}
+
+/* The frames of the inductive step are not initialized, i.e., the states
+ * of the first frame are unconstrained. */
+static void
+initialize_new_induction_frame (BtorMC *mc)
+{
+  assert (mc);
+
+  if (!mc->induction)
+    mc->induction = new_unrolling (
+        mc, "induction", btor_mc_get_opt (mc, BTOR_MC_OPT_SIMPLE_PATH));
+  initialize_new_frame (mc, mc->induction, &mc->ind_frames, false);
+
+  BTOR_MSG (boolector_get_btor_msg (mc->btor),
+            1,
+            "initialized induction frame at bound k = %d",
+            BTOR_COUNT_STACK (mc->ind_frames) - 1);
 }
 
 static void
@@ -1135,7 +1312,11 @@ print_witness (BtorMC *mc, int32_t time, size_t bad_id)
 
   full_trace = btor_mc_get_opt (mc, BTOR_MC_OPT_TRACE_GEN_FULL) == 1;
 
-  printf ("sat\nb%zu\n", bad_id);
+#ifdef BTOR_HAVE_PTHREADS
+  /* witnesses of clones checked concurrently must not interleave */
+  flockfile (stdout);
+#endif
+  printf ("sat\nb%d\n", BTOR_PEEK_STACK (mc->bad_ids, bad_id));
 
   for (i = 0; i <= (size_t) time; i++)
   {
@@ -1172,6 +1353,9 @@ print_witness (BtorMC *mc, int32_t time, size_t bad_id)
   }
   printf (".\n");
   fflush (stdout);
+#ifdef BTOR_HAVE_PTHREADS
+  funlockfile (stdout);
+#endif
 }
 
 /* Check whether n1 and n2 are distinct. For bit-vectors we check if the values
@@ -1235,7 +1419,7 @@ create_distinct_state (BtorMC *mc, BtorMCFrame *f1, BtorMCFrame *f2)
   Btor *btor;
   BoolectorNode *s1, *s2, *res = 0, *tmp, *eq;
 
-  btor       = mc->forward;
+  btor       = mc->induction;
   num_states = BTOR_COUNT_STACK (f1->states);
   for (i = 0; i < num_states; i++)
   {
@@ -1267,9 +1451,13 @@ create_distinct_state (BtorMC *mc, BtorMCFrame *f1, BtorMCFrame *f2)
     if (res) boolector_release (btor, res);
     res = 0;
   }
+  else if (!res)
+  {
+    /* without states, all frames are equal */
+    res = boolector_false (btor);
+  }
   else
   {
-    assert (res);
     tmp = boolector_not (btor, res);
     boolector_release (btor, res);
     res = tmp;
@@ -1277,6 +1465,9 @@ create_distinct_state (BtorMC *mc, BtorMCFrame *f1, BtorMCFrame *f2)
   return res;
 }
 
+/* Add simple path constraints for all pairs of induction frames with equal
+ * states in the current model of the inductive step.  Returns false if the
+ * states of all frames are already pairwise distinct. */
 static bool
 add_simple_path_constraints (BtorMC *mc)
 {
@@ -1287,25 +1478,23 @@ add_simple_path_constraints (BtorMC *mc)
   BoolectorNode *constraint;
   BoolectorNodePtrStack constraints;
 
-  btor = mc->forward;
+  btor = mc->induction;
 
   BTOR_INIT_STACK (mc->mm, constraints);
 
-  // TODO:
-  //   cache simple path constraints
-  num_frames = BTOR_COUNT_STACK (mc->frames);
+  num_frames = BTOR_COUNT_STACK (mc->ind_frames);
   for (i = 0; i < num_frames; i++)
   {
-    f1 = mc->frames.start + i;
+    f1 = mc->ind_frames.start + i;
     for (j = i + 1; j < num_frames; j++)
     {
-      f2         = mc->frames.start + j;
+      f2         = mc->ind_frames.start + j;
       constraint = create_distinct_state (mc, f1, f2);
 
       if (constraint)
       {
         BTOR_PUSH_STACK (constraints, constraint);
-        BTOR_MSG (boolector_get_btor_msg (btor),
+        BTOR_MSG (boolector_get_btor_msg (mc->btor),
                   1,
                   "adding simple path constraints for %zu and %zu",
                   i,
@@ -1320,7 +1509,7 @@ add_simple_path_constraints (BtorMC *mc)
     boolector_assert (btor, constraint);
     boolector_release (btor, constraint);
   }
-  res = !BTOR_EMPTY_STACK(constraints);
+  res = !BTOR_EMPTY_STACK (constraints);
   BTOR_RELEASE_STACK (constraints);
   return res;
 }
@@ -1330,17 +1519,14 @@ check_last_forward_frame (BtorMC *mc)
 {
   assert (mc);
 
-  size_t i, j;
-  int32_t k, res, reachable, unreachable;
-  bool opt_kinduction, opt_simple_path;
+  size_t i;
+  int32_t k, res, reachable;
   BtorMCFrame *f;
   BoolectorNode *bad;
   Btor *btor;
 
   btor = mc->btor;
 
-  opt_kinduction = btor_mc_get_opt (mc, BTOR_MC_OPT_KINDUCTION) == 1;
-  opt_simple_path = btor_mc_get_opt (mc, BTOR_MC_OPT_SIMPLE_PATH) == 1;
   k = BTOR_COUNT_STACK (mc->frames) - 1;
   assert (k >= 0);
   f = mc->frames.top - 1;
@@ -1350,8 +1536,7 @@ check_last_forward_frame (BtorMC *mc)
             1,
             "checking forward frame at bound k = %d",
             k);
-  reachable   = 0;
-  unreachable = 0;
+  reachable = 0;
 
   for (i = 0; i < BTOR_COUNT_STACK (f->bad); i++)
   {
@@ -1360,7 +1545,11 @@ check_last_forward_frame (BtorMC *mc)
     {
       int32_t reached;
       reached = BTOR_PEEK_STACK (mc->reached, i);
-      assert (reached >= 0);
+      if (reached < 0)
+      {
+        assert (BTOR_PEEK_STACK (mc->proved, i) >= 0);
+        continue;
+      }
       BTOR_MSG (boolector_get_btor_msg (btor),
                 1,
                 "skipping checking bad state property %zu "
@@ -1377,13 +1566,12 @@ check_last_forward_frame (BtorMC *mc)
               k);
 
     boolector_assume (mc->forward, bad);
-    for (j = 0; j < BTOR_COUNT_STACK (mc->init_assumptions); j++)
+    res = boolector_sat (mc->forward);
+    if (res == BOOLECTOR_UNKNOWN)
     {
-      assert (opt_kinduction);
-      boolector_assume (mc->forward, BTOR_PEEK_STACK (mc->init_assumptions, j));
+      mc->terminated = true;
+      break;
     }
-
-    res = boolector_sat (mc->forward);
     if (res == BOOLECTOR_SAT)
     {
       mc->state = BTOR_SAT_MC_STATE;
@@ -1416,63 +1604,123 @@ check_last_forward_frame (BtorMC *mc)
     else
     {
       assert (res == BOOLECTOR_UNSAT);
+      mc->state = BTOR_UNSAT_MC_STATE;
+      BTOR_MSG (boolector_get_btor_msg (btor),
+                1,
+                "bad state property %zu at bound k = %d UNSATISFIABLE",
+                i,
+                k);
+    }
+    if (btor_mc_get_opt (mc, BTOR_MC_OPT_BTOR_STATS))
+      boolector_print_stats (mc->forward);
+  }
 
-      if (opt_kinduction)
-      {
-      KINDUCTION_RECHECK:
-        boolector_assume (mc->forward, bad);
-        res = boolector_sat (mc->forward);
+  BTOR_MSG (boolector_get_btor_msg (btor),
+            1,
+            "found %d reachable bad state properties at bound k = %d",
+            reachable,
+            k);
 
-        if (res == BOOLECTOR_SAT)
-        {
-          if (opt_simple_path && add_simple_path_constraints (mc))
-          {
-            goto KINDUCTION_RECHECK;
-          }
-          BoolectorNode *not_bad = boolector_not (mc->forward, bad);
-          boolector_assert (mc->forward, not_bad);
-          boolector_release (mc->forward, not_bad);
-          mc->state = BTOR_NO_MC_STATE;
-        }
-        else
-        {
-          mc->state = BTOR_UNSAT_MC_STATE;
-          BTOR_MSG (boolector_get_btor_msg (btor),
-                    1,
-                    "bad state property %zu unreachable at bound k = %d "
-                    "UNSATISFIABLE",
-                    i,
-                    k);
-          mc->num_reached++;
-          assert (mc->num_reached <= BTOR_COUNT_STACK (mc->bad));
-          BTOR_POKE_STACK (mc->reached, i, k);
-          printf ("unsat\nb%zd\n", i);
-          unreachable++;
-        }
-      }
-      else
+  return reachable;
+}
+
+/* Check the inductive step at bound k for all bad state properties that
+ * are neither reached nor proven yet: a property is proven unreachable if it
+ * can not be reached in the last induction frame on a path on which it was
+ * not reached before.  Assumes that the base case was checked for all
+ * bounds up to k.  Returns the number of proven properties. */
+static int32_t
+check_last_induction_frame (BtorMC *mc)
+{
+  assert (mc);
+  assert (BTOR_COUNT_STACK (mc->ind_frames)
+          == BTOR_COUNT_STACK (mc->frames));
+
+  size_t i;
+  int32_t j, k, res, proved;
+  bool opt_simple_path;
+  BtorMCFrame *f, *p;
+  BoolectorNode *bad, *not_bad;
+  Btor *btor;
+
+  btor = mc->btor;
+
+  opt_simple_path = btor_mc_get_opt (mc, BTOR_MC_OPT_SIMPLE_PATH) == 1;
+  k               = BTOR_COUNT_STACK (mc->ind_frames) - 1;
+  assert (k >= 0);
+  f = mc->ind_frames.top - 1;
+  assert (f->time == k);
+
+  BTOR_MSG (boolector_get_btor_msg (btor),
+            1,
+            "checking induction frame at bound k = %d",
+            k);
+  proved = 0;
+
+  for (i = 0; i < BTOR_COUNT_STACK (f->bad); i++)
+  {
+    bad = BTOR_PEEK_STACK (f->bad, i);
+    if (!bad || BTOR_PEEK_STACK (mc->reached, i) >= 0) continue;
+
+    BTOR_MSG (boolector_get_btor_msg (btor),
+              1,
+              "checking inductive step of bad state property %zu "
+              "at bound k = %d",
+              i,
+              k);
+    do
+    {
+      for (j = 0; j < k; j++)
       {
-        mc->state = BTOR_UNSAT_MC_STATE;
-        BTOR_MSG (boolector_get_btor_msg (btor),
-                  1,
-                  "bad state property %zu at bound k = %d UNSATISFIABLE",
-                  i,
-                  k);
+        p = mc->ind_frames.start + j;
+        assert (BTOR_PEEK_STACK (p->bad, i));
+        not_bad = boolector_not (mc->induction, BTOR_PEEK_STACK (p->bad, i));
+        boolector_assume (mc->induction, not_bad);
+        boolector_release (mc->induction, not_bad);
       }
+      boolector_assume (mc->induction, bad);
+      res = boolector_sat (mc->induction);
+    } while (res == BOOLECTOR_SAT && opt_simple_path
+             && add_simple_path_constraints (mc));
+
+    if (res == BOOLECTOR_UNKNOWN)
+    {
+      mc->terminated = true;
+      break;
+    }
+    if (res == BOOLECTOR_UNSAT)
+    {
+      BTOR_MSG (boolector_get_btor_msg (btor),
+                1,
+                "bad state property %zu unreachable, inductive at bound "
+                "k = %d",
+                i,
+                k);
+      BTOR_POKE_STACK (mc->proved, i, k);
+      mc->num_proved++;
+      assert (mc->num_proved + mc->num_reached <= BTOR_COUNT_STACK (mc->bad));
+      proved++;
+    }
+    else
+    {
+      assert (res == BOOLECTOR_SAT);
+      BTOR_MSG (boolector_get_btor_msg (btor),
+                1,
+                "bad state property %zu not inductive at bound k = %d",
+                i,
+                k);
     }
     if (btor_mc_get_opt (mc, BTOR_MC_OPT_BTOR_STATS))
-      boolector_print_stats (mc->forward);
+      boolector_print_stats (mc->induction);
   }
 
   BTOR_MSG (boolector_get_btor_msg (btor),
             1,
-            "found %d reachable and %d unreachable bad state properties "
-            "at bound k = %d",
-            reachable,
-            unreachable,
+            "proved %d bad state properties unreachable at bound k = %d",
+            proved,
             k);
 
-  return reachable;
+  return proved;
 }
 
 int32_t
@@ -1501,10 +1749,12 @@ btor_mc_bmc (BtorMC *mc, int32_t mink, int32_t maxk)
       "trace generation %s",
       btor_mc_get_opt (mc, BTOR_MC_OPT_TRACE_GEN) ? "enabled" : "disabled");
 
-  mc->state = BTOR_NO_MC_STATE;
+  mc->state      = BTOR_NO_MC_STATE;
+  mc->terminated = false;
 
   while ((k = BTOR_COUNT_STACK (mc->frames)) <= maxk)
   {
+    if (terminate_mc (mc)) break;
     if (mc->call_backs.starting_bound.fun)
     {
       mc->call_backs.starting_bound.fun (mc->call_backs.starting_bound.state,
@@ -1528,6 +1778,13 @@ btor_mc_bmc (BtorMC *mc, int32_t mink, int32_t maxk)
     }
   }
 
+  if (mc->terminated)
+  {
+    BTOR_MSG (boolector_get_btor_msg (btor), 1, "terminated at bound %d", k);
+    mc->state = BTOR_NO_MC_STATE;
+    return -1;
+  }
+
   BTOR_MSG (boolector_get_btor_msg (btor), 2, "entering UNSAT state");
   mc->state = BTOR_UNSAT_MC_STATE;
 
@@ -1546,6 +1803,10 @@ btor_mc_kind (BtorMC *mc, int32_t mink, int32_t maxk)
 
   mc_release_assignments (mc);
 
+  /* forward frames of previous calls to 'btor_mc_bmc' */
+  while (BTOR_COUNT_STACK (mc->ind_frames) < BTOR_COUNT_STACK (mc->frames))
+    initialize_new_induction_frame (mc);
+
   BTOR_MSG (boolector_get_btor_msg (btor),
             1,
             "calling k-induction on %u properties from bound %d "
@@ -1560,79 +1821,938 @@ btor_mc_kind (BtorMC *mc, int32_t mink, int32_t maxk)
       "trace generation %s",
       btor_mc_get_opt (mc, BTOR_MC_OPT_TRACE_GEN) ? "enabled" : "disabled");
 
-  mc->state = BTOR_NO_MC_STATE;
+  mc->state      = BTOR_NO_MC_STATE;
+  mc->terminated = false;
 
   while ((k = BTOR_COUNT_STACK (mc->frames)) <= maxk)
   {
+    if (terminate_mc (mc)) break;
     if (mc->call_backs.starting_bound.fun)
     {
       mc->call_backs.starting_bound.fun (mc->call_backs.starting_bound.state,
                                          k);
     }
 
+    /* The base case is checked at every bound (proofs rely on it), 'mink'
+     * only delays the inductive step. */
     initialize_new_forward_frame (mc);
-    if (k < mink) continue;
-    (void) check_last_forward_frame (mc);
-    if (mc->state != BTOR_NO_MC_STATE)
+    initialize_new_induction_frame (mc);
+    if (check_last_forward_frame (mc))
     {
       if (btor_mc_get_opt (mc, BTOR_MC_OPT_STOP_FIRST)
-          || mc->num_reached == BTOR_COUNT_STACK (mc->bad) || k == maxk)
+          || mc->num_reached + mc->num_proved == BTOR_COUNT_STACK (mc->bad)
+          || k == maxk)
       {
-        if (mc->state == BTOR_SAT_MC_STATE)
-        {
-          BTOR_MSG (boolector_get_btor_msg (btor),
-                    2,
-                    "entering SAT state at bound k=%d",
-                    k);
-          assert (k >= 0);
-          return k;
-        }
-        else
-        {
-          return k;
-        }
+        BTOR_MSG (boolector_get_btor_msg (btor),
+                  2,
+                  "entering SAT state at bound k=%d",
+                  k);
+        assert (k >= 0);
+        return k;
+      }
+    }
+    /* proofs require the base case to be checked at bound k */
+    if (k < mink || mc->terminated) continue;
+    if (check_last_induction_frame (mc)
+        && mc->num_reached + mc->num_proved == BTOR_COUNT_STACK (mc->bad))
+    {
+      if (mc->num_reached)
+      {
+        BTOR_MSG (boolector_get_btor_msg (btor),
+                  2,
+                  "entering SAT state at bound k=%d",
+                  k);
+        mc->state = BTOR_SAT_MC_STATE;
+        return k;
       }
+      break;
     }
   }
 
+  if (mc->terminated)
+  {
+    BTOR_MSG (boolector_get_btor_msg (btor), 1, "terminated at bound %d", k);
+    mc->state = BTOR_NO_MC_STATE;
+    return -1;
+  }
+
   BTOR_MSG (boolector_get_btor_msg (btor), 2, "entering UNSAT state");
   mc->state = BTOR_UNSAT_MC_STATE;
 
   return -1;
 }
 
+/*------------------------------------------------------------------------*/
+/* IC3 / PDR                                                              */
 /*------------------------------------------------------------------------*/
 
-static BoolectorNodeMap *
-get_mc_model2const_map (BtorMC *mc, BtorMCFrame *frame)
+/* Cubes are conjunctions of literals over the bits of bit-vector states,
+ * where literal '2 * v + val' denotes that state bit 'v' has value 'val'.
+ * Frames are encoded with one activation variable per level (F_0 is the
+ * set of initial states), a lemma at level 'l' belongs to frames 1 to 'l',
+ * i.e., frame F_i is activated by assuming the activation variables of all
+ * levels >= i. */
+
+struct BtorMCIC3Lemma
 {
-  if (!frame->model2const)
-    frame->model2const = boolector_nodemap_new (mc->btor);
-  return frame->model2const;
-}
+  int32_t level;
+  BtorIntStack cube;
+};
+typedef struct BtorMCIC3Lemma BtorMCIC3Lemma;
 
-static void
-zero_normalize_assignment (char *assignment)
+BTOR_DECLARE_STACK (BtorMCIC3LemmaPtr, BtorMCIC3Lemma *);
+
+struct BtorMCIC3Obligation
 {
-  char *p;
-  for (p = assignment; *p; p++)
+  int32_t level; /* frame the cube has to be blocked in */
+  int32_t depth; /* number of transitions from the cube to a bad state */
+  BtorIntStack cube;
+};
+typedef struct BtorMCIC3Obligation BtorMCIC3Obligation;
+
+BTOR_DECLARE_STACK (BtorMCIC3ObligationPtr, BtorMCIC3Obligation *);
+
+struct BtorMCIC3
+{
+  BtorMC *mc;
+  Btor *smt;                      /* transition relation */
+  BoolectorSort bool_sort;
+  BoolectorNodePtrStack states;   /* current state (per state id) */
+  BoolectorNodePtrStack next;     /* next state function (per state id) */
+  BtorIntStack var2state;         /* state bit -> state id */
+  BtorIntStack var2bit;           /* state bit -> bit index */
+  BoolectorNode *init_act;        /* activates F_0 */
+  BoolectorNodePtrStack acts;     /* activation variables of levels >= 1 */
+  BoolectorNode *bad;             /* disjunction of checked properties */
+  BtorMCIC3LemmaPtrStack lemmas;
+  BtorMCIC3ObligationPtrStack obligations;
+  struct
   {
-    if (*p == 'x') *p = '0';
+    uint32_t queries, lemmas, obligations, propagated;
+  } stats;
+};
+typedef struct BtorMCIC3 BtorMCIC3;
+
+static BoolectorNode *
+ic3_lit_node (BtorMCIC3 *ic3, int32_t lit, bool next)
+{
+  assert (ic3);
+  assert (lit >= 0);
+
+  int32_t v, s, j;
+  BoolectorNode *n, *res, *tmp;
+
+  v   = lit / 2;
+  s   = BTOR_PEEK_STACK (ic3->var2state, v);
+  j   = BTOR_PEEK_STACK (ic3->var2bit, v);
+  n   = next ? BTOR_PEEK_STACK (ic3->next, s) : BTOR_PEEK_STACK (ic3->states, s);
+  res = boolector_slice (ic3->smt, n, j, j);
+  if (!(lit & 1))
+  {
+    tmp = boolector_not (ic3->smt, res);
+    boolector_release (ic3->smt, res);
+    res = tmp;
   }
+  return res;
 }
 
+/* Negation of 'cube' over the current state. */
 static BoolectorNode *
-mc_model2const_mapper (Btor *btor, void *m2cmapper, BoolectorNode *node)
+ic3_clause_node (BtorMCIC3 *ic3, BtorIntStack *cube)
 {
-  assert (btor_node_is_regular ((BtorNode *) node));
-  assert (m2cmapper);
-  assert (node);
+  assert (ic3);
+  assert (cube);
 
-  BtorMCModel2ConstMapper *mapper;
-  BoolectorNode *node_at_time, *res;
-  const char *constbits;
-  BtorPtrHashBucket *bucket;
-  BtorMCFrame *frame;
+  uint32_t i;
+  BoolectorNode *res, *lit, *tmp;
+
+  res = boolector_false (ic3->smt);
+  for (i = 0; i < BTOR_COUNT_STACK (*cube); i++)
+  {
+    lit = ic3_lit_node (ic3, BTOR_PEEK_STACK (*cube, i) ^ 1, false);
+    tmp = boolector_or (ic3->smt, res, lit);
+    boolector_release (ic3->smt, res);
+    boolector_release (ic3->smt, lit);
+    res = tmp;
+  }
+  return res;
+}
+
+static void
+ic3_assume_frame (BtorMCIC3 *ic3, int32_t level)
+{
+  assert (ic3);
+  assert (level >= 0);
+
+  uint32_t i;
+
+  if (level == 0)
+    boolector_assume (ic3->smt, ic3->init_act);
+  else
+    for (i = level - 1; i < BTOR_COUNT_STACK (ic3->acts); i++)
+      boolector_assume (ic3->smt, BTOR_PEEK_STACK (ic3->acts, i));
+}
+
+static int32_t
+ic3_sat (BtorMCIC3 *ic3)
+{
+  int32_t res;
+  ic3->stats.queries++;
+  res = boolector_sat (ic3->smt);
+  assert (res == BOOLECTOR_SAT || res == BOOLECTOR_UNSAT);
+  return res;
+}
+
+/* Get the state of the current model as cube. */
+static void
+ic3_model_cube (BtorMCIC3 *ic3, BtorIntStack *cube)
+{
+  assert (ic3);
+  assert (cube);
+
+  uint32_t i, j, w, v;
+  const char *a;
+  BoolectorNode *s;
+
+  BTOR_RESET_STACK (*cube);
+  for (i = 0, v = 0; i < BTOR_COUNT_STACK (ic3->states); i++)
+  {
+    s = BTOR_PEEK_STACK (ic3->states, i);
+    w = boolector_get_width (ic3->smt, s);
+    a = boolector_bv_assignment (ic3->smt, s);
+    for (j = 0; j < w; j++, v++)
+    {
+      assert (BTOR_PEEK_STACK (ic3->var2state, v) == (int32_t) i);
+      assert (BTOR_PEEK_STACK (ic3->var2bit, v) == (int32_t) j);
+      /* assignment strings are MSB first, 'x' is don't care */
+      if (a[w - 1 - j] == 'x') continue;
+      BTOR_PUSH_STACK (*cube, 2 * v + (a[w - 1 - j] == '1'));
+    }
+    boolector_free_bv_assignment (ic3->smt, a);
+  }
+}
+
+/* Check if 'cube' intersects with the initial states.  If not, the
+ * literals of 'cube' which are sufficient for this are stored in 'core'. */
+static bool
+ic3_intersects_init (BtorMCIC3 *ic3, BtorIntStack *cube, BtorIntStack *core)
+{
+  assert (ic3);
+  assert (cube);
+
+  uint32_t i;
+  bool res;
+  BoolectorNodePtrStack lits;
+
+  BTOR_INIT_STACK (ic3->mc->mm, lits);
+  ic3_assume_frame (ic3, 0);
+  for (i = 0; i < BTOR_COUNT_STACK (*cube); i++)
+  {
+    BTOR_PUSH_STACK (lits, ic3_lit_node (ic3, BTOR_PEEK_STACK (*cube, i), false));
+    boolector_assume (ic3->smt, BTOR_TOP_STACK (lits));
+  }
+  res = ic3_sat (ic3) == BOOLECTOR_SAT;
+  if (core) BTOR_RESET_STACK (*core);
+  for (i = 0; i < BTOR_COUNT_STACK (lits); i++)
+  {
+    if (!res && core && boolector_failed (ic3->smt, BTOR_PEEK_STACK (lits, i)))
+      BTOR_PUSH_STACK (*core, BTOR_PEEK_STACK (*cube, i));
+    boolector_release (ic3->smt, BTOR_PEEK_STACK (lits, i));
+  }
+  BTOR_RELEASE_STACK (lits);
+  return res;
+}
+
+/* Check if 'cube' is blocked in frame F_level. */
+static bool
+ic3_is_blocked (BtorMCIC3 *ic3, BtorIntStack *cube, int32_t level)
+{
+  assert (ic3);
+  assert (cube);
+
+  uint32_t i;
+  bool res;
+  BoolectorNodePtrStack lits;
+
+  BTOR_INIT_STACK (ic3->mc->mm, lits);
+  ic3_assume_frame (ic3, level);
+  for (i = 0; i < BTOR_COUNT_STACK (*cube); i++)
+  {
+    BTOR_PUSH_STACK (lits, ic3_lit_node (ic3, BTOR_PEEK_STACK (*cube, i), false));
+    boolector_assume (ic3->smt, BTOR_TOP_STACK (lits));
+  }
+  res = ic3_sat (ic3) == BOOLECTOR_UNSAT;
+  while (!BTOR_EMPTY_STACK (lits))
+    boolector_release (ic3->smt, BTOR_POP_STACK (lits));
+  BTOR_RELEASE_STACK (lits);
+  return res;
+}
+
+/* Check if the negation of 'cube' is inductive relative to F_level, i.e.,
+ * if F_level & !cube & T & cube' is unsatisfiable.  If so, the literals of
+ * 'cube' which are sufficient for this are stored in 'core', otherwise the
+ * predecessor state is stored in 'pred'. */
+static bool
+ic3_relative_inductive (BtorMCIC3 *ic3,
+                        BtorIntStack *cube,
+                        int32_t level,
+                        BtorIntStack *core,
+                        BtorIntStack *pred)
+{
+  assert (ic3);
+  assert (cube);
+
+  uint32_t i;
+  bool res;
+  BoolectorNode *clause;
+  BoolectorNodePtrStack lits;
+
+  BTOR_INIT_STACK (ic3->mc->mm, lits);
+  ic3_assume_frame (ic3, level);
+  clause = ic3_clause_node (ic3, cube);
+  boolector_assume (ic3->smt, clause);
+  for (i = 0; i < BTOR_COUNT_STACK (*cube); i++)
+  {
+    BTOR_PUSH_STACK (lits, ic3_lit_node (ic3, BTOR_PEEK_STACK (*cube, i), true));
+    boolector_assume (ic3->smt, BTOR_TOP_STACK (lits));
+  }
+  res = ic3_sat (ic3) == BOOLECTOR_UNSAT;
+  if (res && core)
+  {
+    BTOR_RESET_STACK (*core);
+    for (i = 0; i < BTOR_COUNT_STACK (lits); i++)
+      if (boolector_failed (ic3->smt, BTOR_PEEK_STACK (lits, i)))
+        BTOR_PUSH_STACK (*core, BTOR_PEEK_STACK (*cube, i));
+  }
+  else if (!res && pred)
+  {
+    ic3_model_cube (ic3, pred);
+  }
+  boolector_release (ic3->smt, clause);
+  while (!BTOR_EMPTY_STACK (lits))
+    boolector_release (ic3->smt, BTOR_POP_STACK (lits));
+  BTOR_RELEASE_STACK (lits);
+  return res;
+}
+
+/* Merge the literals of 'b' into 'a', both are sorted. */
+static void
+ic3_merge_cubes (BtorMemMgr *mm, BtorIntStack *a, BtorIntStack *b)
+{
+  uint32_t i, j;
+  BtorIntStack res;
+
+  BTOR_INIT_STACK (mm, res);
+  i = j = 0;
+  while (i < BTOR_COUNT_STACK (*a) || j < BTOR_COUNT_STACK (*b))
+  {
+    if (j == BTOR_COUNT_STACK (*b)
+        || (i < BTOR_COUNT_STACK (*a)
+            && BTOR_PEEK_STACK (*a, i) <= BTOR_PEEK_STACK (*b, j)))
+    {
+      if (j < BTOR_COUNT_STACK (*b)
+          && BTOR_PEEK_STACK (*a, i) == BTOR_PEEK_STACK (*b, j))
+        j++;
+      BTOR_PUSH_STACK (res, BTOR_PEEK_STACK (*a, i));
+      i++;
+    }
+    else
+    {
+      BTOR_PUSH_STACK (res, BTOR_PEEK_STACK (*b, j));
+      j++;
+    }
+  }
+  BTOR_RELEASE_STACK (*a);
+  *a = res;
+}
+
+/* Generalize 'cube' which is disjoint from the initial states and whose
+ * negation is inductive relative to F_level with core 'core' (on entry). On
+ * exit, 'core' contains the generalized cube. */
+static void
+ic3_generalize (BtorMCIC3 *ic3,
+                BtorIntStack *cube,
+                int32_t level,
+                BtorIntStack *core)
+{
+  assert (ic3);
+  assert (cube);
+  assert (core);
+
+  uint32_t i, j;
+  int32_t lit;
+  BtorMemMgr *mm;
+  BtorIntStack init_core, cand, cand_core;
+
+  mm = ic3->mc->mm;
+  BTOR_INIT_STACK (mm, init_core);
+  BTOR_INIT_STACK (mm, cand);
+  BTOR_INIT_STACK (mm, cand_core);
+
+  /* keep the literals that make 'cube' disjoint from the initial states */
+  (void) ic3_intersects_init (ic3, cube, &init_core);
+  ic3_merge_cubes (mm, core, &init_core);
+  assert (!ic3_intersects_init (ic3, core, 0));
+
+  /* try to drop the remaining literals one by one */
+  for (i = 0; i < BTOR_COUNT_STACK (*core) && BTOR_COUNT_STACK (*core) > 1;)
+  {
+    lit = BTOR_PEEK_STACK (*core, i);
+    BTOR_RESET_STACK (cand);
+    for (j = 0; j < BTOR_COUNT_STACK (*core); j++)
+      if (j != i) BTOR_PUSH_STACK (cand, BTOR_PEEK_STACK (*core, j));
+    if (!ic3_intersects_init (ic3, &cand, &init_core)
+        && ic3_relative_inductive (ic3, &cand, level, &cand_core, 0))
+    {
+      ic3_merge_cubes (mm, &cand_core, &init_core);
+      BTOR_RESET_STACK (*core);
+      for (j = 0; j < BTOR_COUNT_STACK (cand_core); j++)
+        BTOR_PUSH_STACK (*core, BTOR_PEEK_STACK (cand_core, j));
+      /* continue with the first literal after 'lit' */
+      for (i = 0; i < BTOR_COUNT_STACK (*core); i++)
+        if (BTOR_PEEK_STACK (*core, i) > lit) break;
+    }
+    else
+    {
+      i++;
+    }
+  }
+
+  BTOR_RELEASE_STACK (init_core);
+  BTOR_RELEASE_STACK (cand);
+  BTOR_RELEASE_STACK (cand_core);
+}
+
+static void
+ic3_add_lemma (BtorMCIC3 *ic3, BtorIntStack *cube, int32_t level)
+{
+  assert (ic3);
+  assert (cube);
+  assert (level >= 1);
+  assert ((uint32_t) level <= BTOR_COUNT_STACK (ic3->acts));
+
+  uint32_t i;
+  BtorMCIC3Lemma *lemma;
+  BoolectorNode *clause, *imp;
+
+  BTOR_CNEW (ic3->mc->mm, lemma);
+  lemma->level = level;
+  BTOR_INIT_STACK (ic3->mc->mm, lemma->cube);
+  for (i = 0; i < BTOR_COUNT_STACK (*cube); i++)
+    BTOR_PUSH_STACK (lemma->cube, BTOR_PEEK_STACK (*cube, i));
+  BTOR_PUSH_STACK (ic3->lemmas, lemma);
+  ic3->stats.lemmas++;
+
+  clause = ic3_clause_node (ic3, cube);
+  imp    = boolector_implies (
+      ic3->smt, BTOR_PEEK_STACK (ic3->acts, level - 1), clause);
+  boolector_assert (ic3->smt, imp);
+  boolector_release (ic3->smt, imp);
+  boolector_release (ic3->smt, clause);
+}
+
+static void
+ic3_push_obligation (BtorMCIC3 *ic3,
+                     BtorIntStack *cube,
+                     int32_t level,
+                     int32_t depth)
+{
+  uint32_t i;
+  BtorMCIC3Obligation *o;
+
+  BTOR_CNEW (ic3->mc->mm, o);
+  o->level = level;
+  o->depth = depth;
+  BTOR_INIT_STACK (ic3->mc->mm, o->cube);
+  for (i = 0; i < BTOR_COUNT_STACK (*cube); i++)
+    BTOR_PUSH_STACK (o->cube, BTOR_PEEK_STACK (*cube, i));
+  BTOR_PUSH_STACK (ic3->obligations, o);
+  ic3->stats.obligations++;
+}
+
+static void
+ic3_delete_obligation (BtorMCIC3 *ic3, BtorMCIC3Obligation *o)
+{
+  BTOR_RELEASE_STACK (o->cube);
+  BTOR_DELETE (ic3->mc->mm, o);
+}
+
+/* Block all proof obligations.  Returns the length of a counterexample if
+ * an initial state is reached and a negative number otherwise. */
+static int32_t
+ic3_block (BtorMCIC3 *ic3, int32_t maxlevel)
+{
+  assert (ic3);
+
+  uint32_t i, min;
+  int32_t res, level;
+  BtorMCIC3Obligation *o;
+  BtorIntStack core, pred;
+  BtorMemMgr *mm;
+
+  mm  = ic3->mc->mm;
+  res = -1;
+  BTOR_INIT_STACK (mm, core);
+  BTOR_INIT_STACK (mm, pred);
+
+  while (!BTOR_EMPTY_STACK (ic3->obligations))
+  {
+    if (terminate_mc (ic3->mc))
+    {
+      while (!BTOR_EMPTY_STACK (ic3->obligations))
+        ic3_delete_obligation (ic3, BTOR_POP_STACK (ic3->obligations));
+      break;
+    }
+    /* process obligation with the lowest level first */
+    for (i = 1, min = 0; i < BTOR_COUNT_STACK (ic3->obligations); i++)
+      if (BTOR_PEEK_STACK (ic3->obligations, i)->level
+          < BTOR_PEEK_STACK (ic3->obligations, min)->level)
+        min = i;
+    o = BTOR_PEEK_STACK (ic3->obligations, min);
+    assert (o->level >= 1);
+
+    if (ic3_is_blocked (ic3, &o->cube, o->level))
+    {
+      BTOR_POKE_STACK (ic3->obligations, min, BTOR_TOP_STACK (ic3->obligations));
+      (void) BTOR_POP_STACK (ic3->obligations);
+      ic3_delete_obligation (ic3, o);
+      continue;
+    }
+
+    if (!ic3_relative_inductive (ic3, &o->cube, o->level - 1, &core, &pred))
+    {
+      if (o->level == 1 || ic3_intersects_init (ic3, &pred, 0))
+      {
+        res = o->depth + 1;
+        break;
+      }
+      ic3_push_obligation (ic3, &pred, o->level - 1, o->depth + 1);
+      continue;
+    }
+
+    ic3_generalize (ic3, &o->cube, o->level - 1, &core);
+    /* push the lemma to the highest possible level */
+    for (level = o->level; level < maxlevel; level++)
+      if (!ic3_relative_inductive (ic3, &core, level, 0, 0)) break;
+    ic3_add_lemma (ic3, &core, level);
+
+    BTOR_POKE_STACK (ic3->obligations, min, BTOR_TOP_STACK (ic3->obligations));
+    (void) BTOR_POP_STACK (ic3->obligations);
+    if (o->level < maxlevel)
+    {
+      o->level += 1;
+      BTOR_PUSH_STACK (ic3->obligations, o);
+    }
+    else
+    {
+      ic3_delete_obligation (ic3, o);
+    }
+  }
+
+  while (!BTOR_EMPTY_STACK (ic3->obligations))
+    ic3_delete_obligation (ic3, BTOR_POP_STACK (ic3->obligations));
+  BTOR_RELEASE_STACK (core);
+  BTOR_RELEASE_STACK (pred);
+  return res;
+}
+
+/* Propagate lemmas to higher levels.  Returns the level 'i' with F_i = F_i+1
+ * (the inductive invariant) or a negative number if there is none. */
+static int32_t
+ic3_propagate (BtorMCIC3 *ic3, int32_t maxlevel)
+{
+  assert (ic3);
+
+  uint32_t i;
+  int32_t level, num;
+  BtorMCIC3Lemma *lemma;
+  BoolectorNode *clause, *imp;
+
+  for (level = 1; level < maxlevel; level++)
+  {
+    num = 0;
+    for (i = 0; i < BTOR_COUNT_STACK (ic3->lemmas); i++)
+    {
+      lemma = BTOR_PEEK_STACK (ic3->lemmas, i);
+      if (lemma->level != level) continue;
+      if (ic3_relative_inductive (ic3, &lemma->cube, level, 0, 0))
+      {
+        lemma->level += 1;
+        clause = ic3_clause_node (ic3, &lemma->cube);
+        imp    = boolector_implies (
+            ic3->smt, BTOR_PEEK_STACK (ic3->acts, level), clause);
+        boolector_assert (ic3->smt, imp);
+        boolector_release (ic3->smt, imp);
+        boolector_release (ic3->smt, clause);
+        ic3->stats.propagated++;
+      }
+      else
+        num++;
+    }
+    if (!num) return level;
+  }
+  return -1;
+}
+
+/* Encode the transition relation of 'mc' with the disjunction of the bad
+ * state properties that are not reached yet as bad states. */
+static void
+ic3_init (BtorMC *mc, BtorMCIC3 *ic3)
+{
+  assert (mc);
+  assert (ic3);
+
+  uint32_t i, j, w;
+  Btor *btor, *smt;
+  BoolectorNode *src, *dst, *tmp, *eq, *init;
+  BoolectorNodeMap *map;
+  BtorPtrHashTableIterator it;
+  BtorMCstate *state;
+  BtorMCInput *input;
+  BoolectorSort sort;
+  uint32_t v;
+
+  btor = mc->btor;
+
+  BTOR_CLR (ic3);
+  ic3->mc  = mc;
+  ic3->smt = smt = boolector_new ();
+  boolector_set_opt (smt, BTOR_OPT_INCREMENTAL, 1);
+  boolector_set_opt (smt, BTOR_OPT_MODEL_GEN, 1);
+  if ((v = btor_mc_get_opt (mc, BTOR_MC_OPT_VERBOSITY)) > 1)
+    boolector_set_opt (smt, BTOR_OPT_VERBOSITY, v - 1);
+  BTOR_INIT_STACK (mc->mm, ic3->states);
+  BTOR_INIT_STACK (mc->mm, ic3->next);
+  BTOR_INIT_STACK (mc->mm, ic3->var2state);
+  BTOR_INIT_STACK (mc->mm, ic3->var2bit);
+  BTOR_INIT_STACK (mc->mm, ic3->acts);
+  BTOR_INIT_STACK (mc->mm, ic3->lemmas);
+  BTOR_INIT_STACK (mc->mm, ic3->obligations);
+
+  map = boolector_nodemap_new (smt);
+
+  btor_iter_hashptr_init (&it, mc->inputs);
+  while (btor_iter_hashptr_has_next (&it))
+  {
+    input = btor_iter_hashptr_next_data (&it)->as_ptr;
+    sort  = copy_sort (btor, smt, input->node);
+    dst   = boolector_var (smt, sort, boolector_get_symbol (btor, input->node));
+    boolector_release_sort (smt, sort);
+    boolector_nodemap_map (map, input->node, dst);
+    boolector_release (smt, dst);
+  }
+
+  btor_iter_hashptr_init (&it, mc->states);
+  while (btor_iter_hashptr_has_next (&it))
+  {
+    state = btor_iter_hashptr_next_data (&it)->as_ptr;
+    assert ((size_t) state->id == BTOR_COUNT_STACK (ic3->states));
+    sort = copy_sort (btor, smt, state->node);
+    dst  = boolector_var (smt, sort, boolector_get_symbol (btor, state->node));
+    boolector_release_sort (smt, sort);
+    boolector_nodemap_map (map, state->node, dst);
+    BTOR_PUSH_STACK (ic3->states, dst);
+    w = boolector_get_width (smt, dst);
+    for (j = 0; j < w; j++)
+    {
+      BTOR_PUSH_STACK (ic3->var2state, state->id);
+      BTOR_PUSH_STACK (ic3->var2bit, j);
+    }
+  }
+
+  /* next state functions, states without next state function are
+   * unconstrained in the next state */
+  init = boolector_true (smt);
+  i    = 0;
+  btor_iter_hashptr_init (&it, mc->states);
+  while (btor_iter_hashptr_has_next (&it))
+  {
+    state = btor_iter_hashptr_next_data (&it)->as_ptr;
+    if (state->next)
+    {
+      dst = boolector_nodemap_substitute_node (smt, map, state->next);
+      dst = boolector_copy (smt, dst);
+    }
+    else
+    {
+      sort = copy_sort (btor, smt, state->node);
+      dst  = boolector_var (smt, sort, 0);
+      boolector_release_sort (smt, sort);
+    }
+    BTOR_PUSH_STACK (ic3->next, dst);
+    if (state->init)
+    {
+      src = boolector_nodemap_substitute_node (smt, map, state->init);
+      eq  = boolector_eq (smt, BTOR_PEEK_STACK (ic3->states, i), src);
+      tmp = boolector_and (smt, init, eq);
+      boolector_release (smt, init);
+      boolector_release (smt, eq);
+      init = tmp;
+    }
+    i++;
+  }
+  ic3->bool_sort = boolector_bool_sort (smt);
+  ic3->init_act  = boolector_var (smt, ic3->bool_sort, 0);
+  tmp           = boolector_implies (smt, ic3->init_act, init);
+  boolector_assert (smt, tmp);
+  boolector_release (smt, tmp);
+  boolector_release (smt, init);
+
+  for (i = 0; i < BTOR_COUNT_STACK (mc->constraints); i++)
+  {
+    src = BTOR_PEEK_STACK (mc->constraints, i);
+    boolector_assert (smt, boolector_nodemap_substitute_node (smt, map, src));
+  }
+
+  ic3->bad = boolector_false (smt);
+  for (i = 0; i < BTOR_COUNT_STACK (mc->bad); i++)
+  {
+    if (BTOR_PEEK_STACK (mc->reached, i) >= 0
+        || BTOR_PEEK_STACK (mc->proved, i) >= 0)
+      continue;
+    src = BTOR_PEEK_STACK (mc->bad, i);
+    dst = boolector_nodemap_substitute_node (smt, map, src);
+    tmp = boolector_or (smt, ic3->bad, dst);
+    boolector_release (smt, ic3->bad);
+    ic3->bad = tmp;
+  }
+
+  boolector_nodemap_delete (map);
+}
+
+static void
+ic3_delete (BtorMCIC3 *ic3)
+{
+  assert (ic3);
+
+  Btor *smt;
+  BtorMCIC3Lemma *lemma;
+
+  smt = ic3->smt;
+  while (!BTOR_EMPTY_STACK (ic3->lemmas))
+  {
+    lemma = BTOR_POP_STACK (ic3->lemmas);
+    BTOR_RELEASE_STACK (lemma->cube);
+    BTOR_DELETE (ic3->mc->mm, lemma);
+  }
+  BTOR_RELEASE_STACK (ic3->lemmas);
+  assert (BTOR_EMPTY_STACK (ic3->obligations));
+  BTOR_RELEASE_STACK (ic3->obligations);
+  while (!BTOR_EMPTY_STACK (ic3->states))
+    boolector_release (smt, BTOR_POP_STACK (ic3->states));
+  BTOR_RELEASE_STACK (ic3->states);
+  while (!BTOR_EMPTY_STACK (ic3->next))
+    boolector_release (smt, BTOR_POP_STACK (ic3->next));
+  BTOR_RELEASE_STACK (ic3->next);
+  while (!BTOR_EMPTY_STACK (ic3->acts))
+    boolector_release (smt, BTOR_POP_STACK (ic3->acts));
+  BTOR_RELEASE_STACK (ic3->acts);
+  BTOR_RELEASE_STACK (ic3->var2state);
+  BTOR_RELEASE_STACK (ic3->var2bit);
+  boolector_release (smt, ic3->init_act);
+  boolector_release (smt, ic3->bad);
+  boolector_release_sort (smt, ic3->bool_sort);
+  boolector_delete (smt);
+}
+
+/* Get the inductive invariant given by the lemmas at levels > 'level'. */
+static BtorIntStack *
+ic3_invariant (BtorMCIC3 *ic3, int32_t level)
+{
+  assert (ic3);
+
+  uint32_t i, j;
+  int32_t lit, v;
+  BtorMCIC3Lemma *lemma;
+  BtorIntStack *res;
+
+  BTOR_NEW (ic3->mc->mm, res);
+  BTOR_INIT_STACK (ic3->mc->mm, *res);
+  for (i = 0; i < BTOR_COUNT_STACK (ic3->lemmas); i++)
+  {
+    lemma = BTOR_PEEK_STACK (ic3->lemmas, i);
+    if (lemma->level <= level) continue;
+    for (j = 0; j < BTOR_COUNT_STACK (lemma->cube); j++)
+    {
+      lit = BTOR_PEEK_STACK (lemma->cube, j);
+      v   = lit / 2;
+      BTOR_PUSH_STACK (*res, BTOR_PEEK_STACK (ic3->var2state, v));
+      BTOR_PUSH_STACK (*res, BTOR_PEEK_STACK (ic3->var2bit, v));
+      BTOR_PUSH_STACK (*res, !(lit & 1));
+    }
+    BTOR_PUSH_STACK (*res, -1);
+  }
+  return res;
+}
+
+int32_t
+btor_mc_ic3 (BtorMC *mc, int32_t maxk)
+{
+  assert (mc);
+
+  uint32_t i, reached;
+  int32_t k, res, level, proved;
+  double start;
+  Btor *btor;
+  BtorMCIC3 ic3;
+  BtorIntStack cube;
+
+  btor  = mc->btor;
+  start = btor_util_time_stamp ();
+  res   = -1;
+
+  mc_release_assignments (mc);
+
+  BTOR_MSG (boolector_get_btor_msg (btor),
+            1,
+            "calling IC3 on %u properties up-to maximum level %d",
+            BTOR_COUNT_STACK (mc->bad),
+            maxk);
+
+  mc->state      = BTOR_NO_MC_STATE;
+  mc->terminated = false;
+  BTOR_INIT_STACK (mc->mm, cube);
+
+  while (mc->num_reached + mc->num_proved < BTOR_COUNT_STACK (mc->bad)
+         && !terminate_mc (mc))
+  {
+    ic3_init (mc, &ic3);
+    k     = -1;
+    level = -1;
+
+    /* F_0 & bad */
+    ic3_assume_frame (&ic3, 0);
+    boolector_assume (ic3.smt, ic3.bad);
+    if (ic3_sat (&ic3) == BOOLECTOR_SAT) k = 0;
+
+    while (k < 0 && level < 0 && (int32_t) BTOR_COUNT_STACK (ic3.acts) < maxk
+           && !terminate_mc (mc))
+    {
+      BTOR_PUSH_STACK (ic3.acts, boolector_var (ic3.smt, ic3.bool_sort, 0));
+      BTOR_MSG (boolector_get_btor_msg (btor),
+                1,
+                "IC3 level %u: %u lemmas, %u obligations, %u queries",
+                BTOR_COUNT_STACK (ic3.acts),
+                ic3.stats.lemmas,
+                ic3.stats.obligations,
+                ic3.stats.queries);
+      /* block bad states in the last frame */
+      while (!terminate_mc (mc))
+      {
+        ic3_assume_frame (&ic3, BTOR_COUNT_STACK (ic3.acts));
+        boolector_assume (ic3.smt, ic3.bad);
+        if (ic3_sat (&ic3) == BOOLECTOR_UNSAT) break;
+        ic3_model_cube (&ic3, &cube);
+        ic3_push_obligation (&ic3, &cube, BTOR_COUNT_STACK (ic3.acts), 0);
+        if ((k = ic3_block (&ic3, BTOR_COUNT_STACK (ic3.acts))) >= 0) break;
+      }
+      if (k < 0 && !mc->terminated)
+        level = ic3_propagate (&ic3, BTOR_COUNT_STACK (ic3.acts));
+    }
+
+    if (level >= 0)
+    {
+      /* all remaining properties are proven */
+      proved = 0;
+      for (i = 0; i < BTOR_COUNT_STACK (mc->bad); i++)
+      {
+        if (BTOR_PEEK_STACK (mc->reached, i) >= 0
+            || BTOR_PEEK_STACK (mc->proved, i) >= 0)
+          continue;
+        BTOR_POKE_STACK (mc->proved, i, level);
+        assert (!BTOR_PEEK_STACK (mc->invariants, i));
+        BTOR_POKE_STACK (mc->invariants, i, ic3_invariant (&ic3, level));
+        mc->num_proved++;
+        proved++;
+      }
+      BTOR_MSG (boolector_get_btor_msg (btor),
+                1,
+                "IC3 proved %d bad state properties unreachable, inductive "
+                "invariant at level %d with %u lemmas",
+                proved,
+                level,
+                ic3.stats.lemmas);
+    }
+    BTOR_MSG (boolector_get_btor_msg (btor),
+              1,
+              "IC3: %u lemmas, %u propagated, %u obligations, %u queries",
+              ic3.stats.lemmas,
+              ic3.stats.propagated,
+              ic3.stats.obligations,
+              ic3.stats.queries);
+    ic3_delete (&ic3);
+    if (level >= 0) break;
+    if (k < 0) break;
+
+    /* reproduce the counterexample with BMC to report the reached
+     * properties and their witnesses */
+    BTOR_MSG (boolector_get_btor_msg (btor),
+              1,
+              "IC3 found counterexample of length %d",
+              k);
+    reached = mc->num_reached;
+    res     = btor_mc_bmc (mc, 0, k);
+    if (mc->terminated) break;
+    if (mc->num_reached == reached)
+    {
+      BTOR_MSG (boolector_get_btor_msg (btor),
+                1,
+                "counterexample of length %d not confirmed by BMC",
+                k);
+      res = -1;
+      break;
+    }
+    if (res < 0) res = k;
+    if (btor_mc_get_opt (mc, BTOR_MC_OPT_STOP_FIRST)) break;
+  }
+  BTOR_RELEASE_STACK (cube);
+
+  if (mc->terminated)
+  {
+    BTOR_MSG (boolector_get_btor_msg (btor), 1, "IC3 terminated");
+    mc->state = BTOR_NO_MC_STATE;
+    return -1;
+  }
+  mc->state = res >= 0 ? BTOR_SAT_MC_STATE : BTOR_UNSAT_MC_STATE;
+  BTOR_MSG (boolector_get_btor_msg (btor),
+            1,
+            "IC3 finished in %.2f seconds",
+            btor_util_time_stamp () - start);
+  return res;
+}
+
+/*------------------------------------------------------------------------*/
+
+static BoolectorNodeMap *
+get_mc_model2const_map (BtorMC *mc, BtorMCFrame *frame)
+{
+  if (!frame->model2const)
+    frame->model2const = boolector_nodemap_new (mc->btor);
+  return frame->model2const;
+}
+
+static void
+zero_normalize_assignment (char *assignment)
+{
+  char *p;
+  for (p = assignment; *p; p++)
+  {
+    if (*p == 'x') *p = '0';
+  }
+}
+
+static BoolectorNode *
+mc_model2const_mapper (Btor *btor, void *m2cmapper, BoolectorNode *node)
+{
+  assert (btor_node_is_regular ((BtorNode *) node));
+  assert (m2cmapper);
+  assert (node);
+
+  BtorMCModel2ConstMapper *mapper;
+  BoolectorNode *node_at_time, *res;
+  const char *constbits;
+  BtorPtrHashBucket *bucket;
+  BtorMCFrame *frame;
   BtorMCInput *input;
   BtorMCstate *state;
   BtorMC *mc;
@@ -1792,6 +2912,122 @@ btor_mc_set_reached_at_bound_call_back (BtorMC *mc,
   mc->call_backs.reached_at_bound.fun   = fun;
 }
 
+int32_t
+btor_mc_proved_bad_at_bound (BtorMC *mc, int32_t badidx)
+{
+  assert (mc);
+  assert (mc->state != BTOR_NO_MC_STATE);
+  assert (badidx >= 0);
+  assert ((size_t) badidx < BTOR_COUNT_STACK (mc->bad));
+  return BTOR_PEEK_STACK (mc->proved, badidx);
+}
+
+bool
+btor_mc_has_invariant (BtorMC *mc, int32_t badidx)
+{
+  assert (mc);
+  assert (badidx >= 0);
+  assert ((size_t) badidx < BTOR_COUNT_STACK (mc->bad));
+  return BTOR_PEEK_STACK (mc->invariants, badidx) != 0;
+}
+
+void
+btor_mc_dump_invariant (BtorMC *mc, int32_t badidx, FILE *file)
+{
+  assert (mc);
+  assert (badidx >= 0);
+  assert ((size_t) badidx < BTOR_COUNT_STACK (mc->bad));
+  assert (file);
+
+  uint32_t i, j, w;
+  int32_t nid, lit, clause, inv;
+  const char *sym;
+  BtorIntStack *clauses, widths, sorts, states, statewidths;
+  BtorPtrHashTableIterator it;
+  BtorMCstate *state;
+
+  clauses = BTOR_PEEK_STACK (mc->invariants, badidx);
+  assert (clauses);
+
+  BTOR_INIT_STACK (mc->mm, widths);
+  BTOR_INIT_STACK (mc->mm, sorts);
+  BTOR_INIT_STACK (mc->mm, states);
+  BTOR_INIT_STACK (mc->mm, statewidths);
+
+  nid = 1;
+  fprintf (file, "%d sort bitvec 1\n", nid);
+  BTOR_PUSH_STACK (widths, 1);
+  BTOR_PUSH_STACK (sorts, nid++);
+  btor_iter_hashptr_init (&it, mc->states);
+  while (btor_iter_hashptr_has_next (&it))
+  {
+    state = btor_iter_hashptr_next_data (&it)->as_ptr;
+    assert ((size_t) state->id == BTOR_COUNT_STACK (states));
+    w = boolector_get_width (mc->btor, state->node);
+    for (j = 0; j < BTOR_COUNT_STACK (widths); j++)
+      if ((uint32_t) BTOR_PEEK_STACK (widths, j) == w) break;
+    if (j == BTOR_COUNT_STACK (widths))
+    {
+      fprintf (file, "%d sort bitvec %u\n", nid, w);
+      BTOR_PUSH_STACK (widths, w);
+      BTOR_PUSH_STACK (sorts, nid++);
+    }
+    fprintf (file, "%d state %d", nid, BTOR_PEEK_STACK (sorts, j));
+    if ((sym = boolector_get_symbol (mc->btor, state->node)))
+      fprintf (file, " %s", sym);
+    fprintf (file, "\n");
+    BTOR_PUSH_STACK (states, nid++);
+    BTOR_PUSH_STACK (statewidths, w);
+  }
+
+  inv = clause = 0;
+  for (i = 0; i < BTOR_COUNT_STACK (*clauses); i++)
+  {
+    if (BTOR_PEEK_STACK (*clauses, i) < 0)
+    {
+      assert (clause);
+      if (inv)
+      {
+        fprintf (file, "%d and 1 %d %d\n", nid, inv, clause);
+        clause = nid++;
+      }
+      inv    = clause;
+      clause = 0;
+      continue;
+    }
+    lit = BTOR_PEEK_STACK (states, BTOR_PEEK_STACK (*clauses, i));
+    if (BTOR_PEEK_STACK (statewidths, BTOR_PEEK_STACK (*clauses, i)) > 1)
+    {
+      fprintf (file,
+               "%d slice 1 %d %d %d\n",
+               nid,
+               lit,
+               BTOR_PEEK_STACK (*clauses, i + 1),
+               BTOR_PEEK_STACK (*clauses, i + 1));
+      lit = nid++;
+    }
+    if (!BTOR_PEEK_STACK (*clauses, i + 2)) lit = -lit;
+    i += 2;
+    if (clause)
+    {
+      fprintf (file, "%d or 1 %d %d\n", nid, clause, lit);
+      lit = nid++;
+    }
+    clause = lit;
+  }
+  if (!inv)
+  {
+    fprintf (file, "%d one 1\n", nid);
+    inv = nid++;
+  }
+  fprintf (file, "%d output %d\n", nid, inv);
+
+  BTOR_RELEASE_STACK (widths);
+  BTOR_RELEASE_STACK (sorts);
+  BTOR_RELEASE_STACK (states);
+  BTOR_RELEASE_STACK (statewidths);
+}
+
 /*------------------------------------------------------------------------*/
 
 void
@@ -1806,4 +3042,15 @@ btor_mc_set_starting_bound_call_back (BtorMC *mc,
   mc->call_backs.starting_bound.fun   = fun;
 }
 
+void
+btor_mc_set_term (BtorMC *mc, void *state, BtorMCTerminate fun)
+{
+  assert (mc);
+  assert (fun);
+  mc->call_backs.term.state = state;
+  mc->call_backs.term.fun   = fun;
+  if (mc->forward) boolector_set_term (mc->forward, fun, state);
+  if (mc->induction) boolector_set_term (mc->induction, fun, state);
+}
+
 /*------------------------------------------------------------------------*/
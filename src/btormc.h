@@ -73,6 +73,11 @@ typedef struct BtorMCFrame BtorMCFrame;
 
 BTOR_DECLARE_STACK (BtorMCFrame, BtorMCFrame);
 
+/* Inductive invariants computed by IC3 are conjunctions of clauses over
+ * state bits, stored as a sequence of literals (state id, bit, value) per
+ * clause, where each clause is terminated by -1. */
+BTOR_DECLARE_STACK (BtorIntStackPtr, BtorIntStack *);
+
 /*------------------------------------------------------------------------*/
 
 struct BtorMC
@@ -80,16 +85,21 @@ struct BtorMC
   BtorMemMgr *mm;
   BtorMCOpt *options;
   BtorMCState state;
+  bool terminated;
   int32_t initialized, nextstates;
-  Btor *btor, *forward;
+  Btor *btor, *forward, *induction;
   BtorMCFrameStack frames;
+  BtorMCFrameStack ind_frames;
   BtorPtrHashTable *inputs;
   BtorPtrHashTable *states;
   BoolectorNodePtrStack bad;
+  BtorIntStack bad_ids; /* index of bad state property in witnesses */
   BoolectorNodePtrStack constraints;
-  BoolectorNodePtrStack init_assumptions;
   BtorIntStack reached;
   uint32_t num_reached;
+  BtorIntStack proved;
+  uint32_t num_proved;
+  BtorIntStackPtrStack invariants;
   struct
   {
     struct
@@ -102,6 +112,11 @@ struct BtorMC
       void *state;
       BtorMCStartingBound fun;
     } starting_bound;
+    struct
+    {
+      void *state;
+      BtorMCTerminate fun;
+    } term;
   } call_backs;
 };
 
@@ -113,6 +128,14 @@ BtorMC *btor_mc_new (void);
 /* Delete model checker instance. */
 void btor_mc_delete (BtorMC *mc);
 
+/* Clone model checker instance (including its Boolector instance) before
+ * model checking.  If 'bad' is not 0, only the 'num_bad' bad state
+ * properties with the given indices are cloned, the bad state property
+ * with index 'i' in the clone is reported as 'bad[i]' in witnesses.  Call
+ * backs are not cloned.
+ */
+BtorMC *btor_mc_clone (BtorMC *mc, uint32_t num_bad, const uint32_t *bad);
+
 /* Set model checker option. */
 void btor_mc_set_opt (BtorMC *mc, BtorMCOption opt, uint32_t val);
 /* Get current value of model checker option. */
@@ -170,8 +193,26 @@ void btor_mc_dump (BtorMC *, FILE *);
 
 int32_t btor_mc_bmc (BtorMC *, int32_t mink, int32_t maxk);
 
+/* Check bad state properties with k-induction up to bound 'maxk'.  The base
+ * case is checked on the forward frames (as with BMC) at every bound, the
+ * inductive step on a second, uninitialized unrolling starting at bound
+ * 'mink'.  Returns the bound at which a bad state property was reached (as
+ * 'btor_mc_bmc') and a negative number otherwise.  Properties proven to be
+ * unreachable can be queried with 'btor_mc_proved_bad_at_bound'.
+ */
 int32_t btor_mc_kind (BtorMC *, int32_t mink, int32_t maxk);
 
+/* Check bad state properties with IC3 (property directed reachability) with
+ * at most 'maxk' frames.  The transition relation is encoded once, memory
+ * usage does not grow with the depth of the search.  Returns the bound at
+ * which a bad state property was reached (counterexamples are reproduced
+ * with BMC) and a negative number otherwise.  Properties proven unreachable
+ * can be queried with 'btor_mc_proved_bad_at_bound', their inductive
+ * invariant is dumped with 'btor_mc_dump_invariant'.  Array states and
+ * inputs are not supported.
+ */
+int32_t btor_mc_ic3 (BtorMC *, int32_t maxk);
+
 /*------------------------------------------------------------------------*/
 
 /* Assumes that 'btor_mc_set_opt (mc, BTOR_MC_OPT_TRACE_GEN, 1)'
@@ -206,12 +247,31 @@ void btor_mc_set_reached_at_bound_call_back (BtorMC *mc,
                                              void *state,
                                              BtorMCReachedAtBound fun);
 
+/* Return the 'k' at which a previous k-induction run proved that the bad
+ * state property with index 'badidx' is unreachable (the inductive step
+ * succeeded at bound 'k') or a negative number if it was not proven.
+ */
+int32_t btor_mc_proved_bad_at_bound (BtorMC *mc, int32_t badidx);
+
+/* Return true if an inductive invariant is available for the bad state
+ * property with index 'badidx' (i.e., it was proven unreachable by IC3). */
+bool btor_mc_has_invariant (BtorMC *mc, int32_t badidx);
+
+/* Dump the inductive invariant of the bad state property with index
+ * 'badidx' in BTOR2 format (the states and the invariant as output). */
+void btor_mc_dump_invariant (BtorMC *mc, int32_t badidx, FILE *file);
+
 /*------------------------------------------------------------------------*/
 
 void btor_mc_set_starting_bound_call_back (BtorMC *mc,
                                            void *state,
                                            BtorMCStartingBound fun);
 
+/* Set termination call back.  If the model checker is terminated, it
+ * returns a negative number and the model checker state is reset, bad
+ * state properties reached or proven before are kept. */
+void btor_mc_set_term (BtorMC *mc, void *state, BtorMCTerminate fun);
+
 /*------------------------------------------------------------------------*/
 
 #endif
@@ -21,6 +21,9 @@
 #include <assert.h>
 #include <inttypes.h>
 #include <limits.h>
+#ifdef BTOR_HAVE_PTHREADS
+#include <pthread.h>
+#endif
 
 #define LEN_OPTSTR 38
 #define LEN_PARAMSTR 16
@@ -160,6 +163,14 @@ print_help (FILE *out, BtorMC *mc)
   fprintf (out, "\n");
 
   print_opt (out, mc->mm, "dump", "d", true, 0, "dump formula", false);
+  print_opt (out,
+             mc->mm,
+             "dump-inv",
+             0,
+             true,
+             0,
+             "dump inductive invariants of proven properties (IC3)",
+             false);
   print_opt (
       out,
       mc->mm,
@@ -197,14 +208,241 @@ msg (char *m, ...)
 
   va_list list;
   va_start (list, m);
+#ifdef BTOR_HAVE_PTHREADS
+  flockfile (stdout);
+#endif
   fprintf (stdout, "[btormc] ");
   vfprintf (stdout, m, list);
   fprintf (stdout, "\n");
+#ifdef BTOR_HAVE_PTHREADS
+  funlockfile (stdout);
+#endif
   va_end (list);
 }
 
 #define BTOR_MC_BOOLECTOR_FUN(name) (n =)
 
+/* Properties proven unreachable are reported as in the BTOR2 witness
+ * format, but without trace. */
+static void
+print_proved (BtorMC *mc, bool dump_inv)
+{
+  uint32_t i, num_bad;
+  int32_t k;
+
+  num_bad = BTOR_COUNT_STACK (mc->bad);
+  for (i = 0; i < num_bad; i++)
+  {
+    if ((k = btor_mc_proved_bad_at_bound (mc, i)) < 0) continue;
+    if (boolector_mc_get_opt (mc, BTOR_MC_OPT_VERBOSITY))
+      msg ("bad state property %d proved unreachable at bound %d",
+           BTOR_PEEK_STACK (mc->bad_ids, i),
+           k);
+#ifdef BTOR_HAVE_PTHREADS
+    flockfile (stdout);
+#endif
+    printf ("unsat\nb%d\n", BTOR_PEEK_STACK (mc->bad_ids, i));
+    if (dump_inv && boolector_mc_has_invariant (mc, i))
+      boolector_mc_dump_invariant (mc, i, stdout);
+    printf (".\n");
+    fflush (stdout);
+#ifdef BTOR_HAVE_PTHREADS
+    funlockfile (stdout);
+#endif
+  }
+}
+
+/* Check all bad state properties of 'mc' with the selected engine. */
+static void
+check (BtorMC *mc, bool dump_inv)
+{
+  uint32_t kmin, kmax;
+
+  kmin = boolector_mc_get_opt (mc, BTOR_MC_OPT_MIN_K);
+  kmax = boolector_mc_get_opt (mc, BTOR_MC_OPT_MAX_K);
+  if (boolector_mc_get_opt (mc, BTOR_MC_OPT_IC3))
+  {
+    (void) boolector_mc_ic3 (mc, kmax);
+    if (mc->state != BTOR_NO_MC_STATE) print_proved (mc, dump_inv);
+  }
+  else if (boolector_mc_get_opt (mc, BTOR_MC_OPT_KINDUCTION))
+  {
+    (void) boolector_mc_kind (mc, kmin, kmax);
+    if (mc->state != BTOR_NO_MC_STATE) print_proved (mc, false);
+  }
+  else
+  {
+    (void) boolector_mc_bmc (mc, kmin, kmax);
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
+/* With '--jobs', each bad state property is checked on its own clone of
+ * the model checker (restricted to this property).  Worker threads fetch
+ * the next unchecked property from a shared counter, results are printed
+ * as soon as a property is resolved. */
+
+struct BtorMCProps
+{
+  BtorMC *mc;
+  bool dump_inv;
+  uint32_t next; /* next unchecked bad state property */
+  uint32_t num_sat, num_unsat, num_unknown;
+#ifdef BTOR_HAVE_PTHREADS
+  pthread_mutex_t mutex; /* protects the above and cloning of 'mc' */
+#endif
+};
+typedef struct BtorMCProps BtorMCProps;
+
+struct BtorMCPropWorker
+{
+  BtorMCProps *props;
+  double deadline; /* wall-clock time limit of the current property */
+};
+typedef struct BtorMCPropWorker BtorMCPropWorker;
+
+static void
+lock_props (BtorMCProps *props)
+{
+#ifdef BTOR_HAVE_PTHREADS
+  pthread_mutex_lock (&props->mutex);
+#else
+  (void) props;
+#endif
+}
+
+static void
+unlock_props (BtorMCProps *props)
+{
+#ifdef BTOR_HAVE_PTHREADS
+  pthread_mutex_unlock (&props->mutex);
+#else
+  (void) props;
+#endif
+}
+
+static int32_t
+terminate_prop (void *state)
+{
+  BtorMCPropWorker *worker = state;
+  return worker->deadline > 0 && btor_util_current_time () >= worker->deadline;
+}
+
+static void *
+check_props (void *state)
+{
+  assert (state);
+
+  uint32_t i, time_limit;
+  double start;
+  const char *res;
+  BtorMCPropWorker *worker;
+  BtorMCProps *props;
+  BtorMC *clone;
+
+  worker     = state;
+  props      = worker->props;
+  time_limit = boolector_mc_get_opt (props->mc, BTOR_MC_OPT_PROP_TIME);
+
+  for (;;)
+  {
+    lock_props (props);
+    if (props->next == BTOR_COUNT_STACK (props->mc->bad))
+    {
+      unlock_props (props);
+      break;
+    }
+    i     = props->next++;
+    clone = boolector_mc_clone (props->mc, 1, &i);
+    unlock_props (props);
+
+    start            = btor_util_current_time ();
+    worker->deadline = time_limit ? start + time_limit : 0;
+    boolector_mc_set_term (clone, worker, terminate_prop);
+    check (clone, props->dump_inv);
+
+    lock_props (props);
+    if (BTOR_PEEK_STACK (clone->reached, 0) >= 0)
+    {
+      res = "reached";
+      props->num_sat++;
+    }
+    else if (BTOR_PEEK_STACK (clone->proved, 0) >= 0)
+    {
+      res = "proved unreachable";
+      props->num_unsat++;
+    }
+    else
+    {
+      res = clone->state == BTOR_NO_MC_STATE ? "timed out" : "unknown";
+      props->num_unknown++;
+    }
+    unlock_props (props);
+
+    if (boolector_mc_get_opt (props->mc, BTOR_MC_OPT_VERBOSITY))
+      msg ("bad state property %u %s after %.2f seconds",
+           i,
+           res,
+           btor_util_current_time () - start);
+    boolector_mc_delete (clone);
+  }
+  return 0;
+}
+
+static void
+check_props_parallel (BtorMC *mc, bool dump_inv)
+{
+  assert (mc);
+
+  uint32_t i, num_workers;
+  double start;
+  BtorMCProps props;
+  BtorMCPropWorker *workers;
+#ifdef BTOR_HAVE_PTHREADS
+  pthread_t *threads;
+#endif
+
+  start       = btor_util_current_time ();
+  num_workers = boolector_mc_get_opt (mc, BTOR_MC_OPT_JOBS);
+  if (num_workers > BTOR_COUNT_STACK (mc->bad))
+    num_workers = BTOR_COUNT_STACK (mc->bad);
+
+  BTOR_CLR (&props);
+  props.mc       = mc;
+  props.dump_inv = dump_inv;
+  BTOR_CNEWN (mc->mm, workers, num_workers);
+  for (i = 0; i < num_workers; i++) workers[i].props = &props;
+
+  if (boolector_mc_get_opt (mc, BTOR_MC_OPT_VERBOSITY))
+    msg ("checking %u properties individually with %u threads",
+         BTOR_COUNT_STACK (mc->bad),
+         num_workers);
+
+#ifdef BTOR_HAVE_PTHREADS
+  pthread_mutex_init (&props.mutex, 0);
+  BTOR_NEWN (mc->mm, threads, num_workers);
+  for (i = 0; i < num_workers; i++)
+    pthread_create (&threads[i], 0, check_props, &workers[i]);
+  for (i = 0; i < num_workers; i++) pthread_join (threads[i], 0);
+  BTOR_DELETEN (mc->mm, threads, num_workers);
+  pthread_mutex_destroy (&props.mutex);
+#else
+  /* without thread support the properties are checked one after the other */
+  if (num_workers) (void) check_props (&workers[0]);
+#endif
+  BTOR_DELETEN (mc->mm, workers, num_workers);
+
+  if (boolector_mc_get_opt (mc, BTOR_MC_OPT_VERBOSITY))
+    msg ("checked %u properties in %.2f seconds: "
+         "%u reached, %u proved, %u unknown",
+         BTOR_COUNT_STACK (mc->bad),
+         btor_util_current_time () - start,
+         props.num_sat,
+         props.num_unsat,
+         props.num_unknown);
+}
+
 static int32_t
 parse (BtorMC *mc, FILE *infile, const char *infile_name, bool checkall)
 {
@@ -759,8 +997,7 @@ main (int32_t argc, char **argv)
   size_t i, len;
   int32_t close_infile;
   int32_t res;
-  bool dump, checkall;
-  uint32_t kmin, kmax;
+  bool dump, dump_inv, checkall;
   char *infile_name, *cmd;
   FILE *infile, *out;
   BtorParsedOpt *po;
@@ -780,6 +1017,7 @@ main (int32_t argc, char **argv)
   res = BTOR_MC_SUCC_EXIT;
 
   dump     = false;
+  dump_inv = false;
   checkall = false;
 
   mm = btor_mem_mgr_new ();
@@ -864,6 +1102,10 @@ main (int32_t argc, char **argv)
     {
       dump = true;
     }
+    else if (strcmp (po->name.start, "dump-inv") == 0)
+    {
+      dump_inv = true;
+    }
     else if (strcmp (po->name.start, "ca") == 0
              || strcmp (po->name.start, "checkall") == 0)
     {
@@ -942,16 +1184,10 @@ main (int32_t argc, char **argv)
     }
     else
     {
-      kmin = boolector_mc_get_opt (mc, BTOR_MC_OPT_MIN_K);
-      kmax = boolector_mc_get_opt (mc, BTOR_MC_OPT_MAX_K);
-      if (boolector_mc_get_opt (mc, BTOR_MC_OPT_KINDUCTION))
-      {
-        (void) boolector_mc_kind (mc, kmin, kmax);
-      }
+      if (boolector_mc_get_opt (mc, BTOR_MC_OPT_JOBS))
+        check_props_parallel (mc, dump_inv);
       else
-      {
-        (void) boolector_mc_bmc (mc, kmin, kmax);
-      }
+        check (mc, dump_inv);
     }
   }
 
@@ -41,9 +41,27 @@ enum BtorMCOption
   BTOR_MC_OPT_TRACE_GEN_FULL,
   /* Set the level of verbosity. */
   BTOR_MC_OPT_VERBOSITY,
-  /* Enable k-induction engine */
+  /* Enable (val: 1) or disable (val: 0) k-induction.
+   * If enabled, bad state properties that are not reachable are proven
+   * unreachable when the inductive step succeeds (see 'boolector_mc_kind'
+   * and 'boolector_mc_proved_bad_at_bound'). */
   BTOR_MC_OPT_KINDUCTION,
+  /* Enable (val: 1) or disable (val: 0) simple path constraints in the
+   * inductive step of k-induction (states of all frames are pairwise
+   * distinct).  Required for completeness of k-induction, added lazily. */
   BTOR_MC_OPT_SIMPLE_PATH,
+  /* Enable (val: 1) or disable (val: 0) IC3 (property directed
+   * reachability, see 'boolector_mc_ic3').  Bad state properties that are
+   * not reachable are proven with an inductive invariant. */
+  BTOR_MC_OPT_IC3,
+  /* Set the number of worker threads for checking bad state properties
+   * individually (btormc only, 0: check all properties in one instance).
+   * Each property is checked on its own clone of the model checker and its
+   * result is reported as soon as it is resolved. */
+  BTOR_MC_OPT_JOBS,
+  /* Set the wall-clock time limit in seconds for checking a single bad
+   * state property if BTOR_MC_OPT_JOBS > 0 (0: no limit). */
+  BTOR_MC_OPT_PROP_TIME,
   /* This MUST be the last entry! */
   BTOR_MC_OPT_NUM_OPTS,
 };
@@ -64,5 +82,13 @@ typedef void (*BtorMCReachedAtBound) (void *, int32_t badidx, int32_t k);
 
 typedef void (*BtorMCStartingBound) (void *, int32_t k);
 
+/**
+ * Termination call back function, the model checker stops (with unknown
+ * result for all unresolved bad state properties) if it returns a non-zero
+ * value.  It is also passed to the SAT solvers of the unrollings, i.e., it
+ * may be called from within a SAT call.
+ */
+typedef int32_t (*BtorMCTerminate) (void *);
+
 /*------------------------------------------------------------------------*/
 #endif
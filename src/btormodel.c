@@ -13,6 +13,7 @@
 #include "btorclone.h"
 #include "btordbg.h"
 #include "btorlog.h"
+#include "preprocess/btorunconstrained.h"
 #include "utils/btorhashint.h"
 #include "utils/btorhashptr.h"
 #include "utils/btormem.h"
@@ -458,6 +459,92 @@ btor_model_get_fun_aux (Btor *btor,
   return (BtorPtrHashTable *) d->as_ptr;
 }
 
+#define NUM_WORDS(bv) ((btor_bv_get_width (bv) + 63) / 64)
+
+size_t
+btor_model_get_fun_words (Btor *btor,
+                          BtorNode *exp,
+                          uint64_t *table,
+                          size_t size,
+                          uint32_t *num_entries,
+                          bool *has_default)
+{
+  assert (btor);
+  assert (exp);
+  assert (btor_node_is_regular (exp));
+  assert (num_entries);
+  assert (has_default);
+
+  uint32_t i;
+  size_t res, pos;
+  BtorPtrHashTableIterator it;
+  const BtorPtrHashTable *model;
+  BtorBitVector *value;
+  BtorBitVectorTuple *t;
+
+  *num_entries = 0;
+  *has_default = false;
+
+  exp = btor_simplify_exp (btor, exp);
+  assert (btor_node_is_fun (exp));
+
+  model = btor_model_get_fun_aux (btor, btor->bv_model, btor->fun_model, exp);
+
+  if ((btor_node_is_lambda (exp) && btor_node_fun_get_arity (btor, exp) > 1)
+      || !btor->fun_model || !model)
+  {
+    return 0;
+  }
+
+  /* compute the size of the table */
+  res = 0;
+  btor_iter_hashptr_init (&it, (BtorPtrHashTable *) model);
+  while (btor_iter_hashptr_has_next (&it))
+  {
+    value = (BtorBitVector *) it.bucket->data.as_ptr;
+    t     = (BtorBitVectorTuple *) btor_iter_hashptr_next (&it);
+    res += NUM_WORDS (value);
+    if (t->arity)
+    {
+      for (i = 0; i < t->arity; i++) res += NUM_WORDS (t->bv[i]);
+      *num_entries += 1;
+    }
+    else
+      *has_default = true;
+  }
+
+  if (res > size) return res;
+
+  /* the default value of constant arrays (argument tuple of arity 0) comes
+   * first, followed by the argument/value entries */
+  pos = 0;
+  btor_iter_hashptr_init (&it, (BtorPtrHashTable *) model);
+  while (btor_iter_hashptr_has_next (&it))
+  {
+    value = (BtorBitVector *) it.bucket->data.as_ptr;
+    t     = (BtorBitVectorTuple *) btor_iter_hashptr_next (&it);
+    if (t->arity) continue;
+    btor_bv_to_words (value, table);
+    pos = NUM_WORDS (value);
+  }
+  btor_iter_hashptr_init (&it, (BtorPtrHashTable *) model);
+  while (btor_iter_hashptr_has_next (&it))
+  {
+    value = (BtorBitVector *) it.bucket->data.as_ptr;
+    t     = (BtorBitVectorTuple *) btor_iter_hashptr_next (&it);
+    if (!t->arity) continue;
+    for (i = 0; i < t->arity; i++)
+    {
+      btor_bv_to_words (t->bv[i], table + pos);
+      pos += NUM_WORDS (t->bv[i]);
+    }
+    btor_bv_to_words (value, table + pos);
+    pos += NUM_WORDS (value);
+  }
+  assert (pos == res);
+  return res;
+}
+
 const BtorPtrHashTable *
 btor_model_get_fun (Btor *btor, BtorNode *exp)
 {
@@ -1291,11 +1378,104 @@ btor_model_generate (Btor *btor,
     btor_node_release (btor, BTOR_POP_STACK (nodes));
   BTOR_RELEASE_STACK (nodes);
 
+  btor_reconstruct_unconstrained (btor, bv_model, fun_model);
+
   btor->time.model_gen += btor_util_time_stamp () - start;
 }
 
 /*------------------------------------------------------------------------*/
 
+/* Import the model of the clone that determined satisfiability into the
+ * original instance.  Since the clone was created from the original instance
+ * (after simplification), nodes with the same id refer to the same node.
+ * Nodes that were created in the clone only are skipped. */
+void
+btor_model_import (Btor *btor, Btor *clone, bool model_for_all_nodes)
+{
+  assert (btor);
+  assert (clone);
+
+  int32_t id;
+  BtorNode *exp, *cexp;
+  BtorBitVector *bv;
+  BtorHashTableData d;
+  BtorIntHashTableIterator it;
+  BtorPtrHashTableIterator pit;
+  const BtorPtrHashTable *fmodel;
+
+  if (!clone->bv_model)
+  {
+    assert (clone->slv);
+    clone->slv->api.generate_model (clone->slv, model_for_all_nodes, true);
+  }
+  assert (clone->bv_model);
+  assert (clone->fun_model);
+
+  btor_model_init_bv (btor, &btor->bv_model);
+  btor_model_init_fun (btor, &btor->fun_model);
+
+  btor_iter_hashint_init (&it, clone->bv_model);
+  while (btor_iter_hashint_has_next (&it))
+  {
+    bv = clone->bv_model->data[it.cur_pos].as_ptr;
+    id = btor_iter_hashint_next (&it);
+    if (!(exp = btor_node_get_by_id (btor, id))) continue;
+    btor_node_copy (btor, exp);
+    btor_hashint_map_add (btor->bv_model, id)->as_ptr =
+        btor_bv_copy (btor->mm, bv);
+  }
+
+  btor_iter_hashint_init (&it, clone->fun_model);
+  while (btor_iter_hashint_has_next (&it))
+  {
+    d.as_ptr = clone->fun_model->data[it.cur_pos].as_ptr;
+    id       = btor_iter_hashint_next (&it);
+    if (!(exp = btor_node_get_by_id (btor, id))) continue;
+    btor_node_copy (btor, exp);
+    btor_clone_data_as_bv_ptr_htable (
+        btor->mm, 0, &d, btor_hashint_map_add (btor->fun_model, id));
+  }
+
+  /* inputs may have been substituted in the clone, query their values
+   * explicitly in order to not lose them */
+  btor_iter_hashptr_init (&pit, btor->bv_vars);
+  while (btor_iter_hashptr_has_next (&pit))
+  {
+    exp = btor_node_get_simplified (btor, btor_iter_hashptr_next (&pit));
+    id  = btor_node_get_id (exp);
+    if (btor_hashint_map_contains (btor->bv_model, id)) continue;
+    if (!btor_node_is_bv_var (exp)) continue;
+    cexp = btor_node_get_by_id (clone, id);
+    assert (cexp);
+    btor_model_add_to_bv (btor,
+                          btor->bv_model,
+                          btor_node_real_addr (exp),
+                          btor_model_get_bv (clone, btor_node_real_addr (cexp)));
+  }
+  btor_iter_hashptr_init (&pit, btor->ufs);
+  while (btor_iter_hashptr_has_next (&pit))
+  {
+    exp = btor_node_get_simplified (btor, btor_iter_hashptr_next (&pit));
+    id  = btor_node_get_id (exp);
+    if (!btor_node_is_uf (exp)
+        || btor_hashint_map_contains (btor->fun_model, id))
+      continue;
+    cexp = btor_node_get_by_id (clone, id);
+    assert (cexp);
+    if (!(fmodel = btor_model_get_fun (clone, cexp))) continue;
+    d.as_ptr = (void *) fmodel;
+    btor_node_copy (btor, exp);
+    btor_clone_data_as_bv_ptr_htable (
+        btor->mm, 0, &d, btor_hashint_map_add (btor->fun_model, id));
+  }
+
+  /* compute values of all remaining nodes from the imported model */
+  btor_model_generate (
+      btor, btor->bv_model, btor->fun_model, model_for_all_nodes);
+}
+
+/*------------------------------------------------------------------------*/
+
 void
 btor_model_delete (Btor *btor)
 {
@@ -47,6 +47,10 @@ BtorIntHashTable* btor_model_clone_fun (Btor* btor,
                                         BtorIntHashTable* fun_model,
                                         bool inc_ref_cnt);
 
+/* Import the model of 'clone', which was cloned from 'btor' (after
+ * simplification) and determined satisfiability, into 'btor'. */
+void btor_model_import (Btor* btor, Btor* clone, bool model_for_all_nodes);
+
 /*------------------------------------------------------------------------*/
 
 const BtorBitVector* btor_model_get_bv (Btor* btor, BtorNode* exp);
@@ -61,6 +65,16 @@ const BtorPtrHashTable* btor_model_get_fun_aux (Btor* btor,
                                                 BtorIntHashTable* fun_model,
                                                 BtorNode* exp);
 
+/* Get the model of given array or function packed into a table of 64-bit
+ * words (see boolector_fun_assignment_words).  The table is only written if
+ * 'size' is large enough.  Returns the number of words of the table. */
+size_t btor_model_get_fun_words (Btor* btor,
+                                 BtorNode* exp,
+                                 uint64_t* table,
+                                 size_t size,
+                                 uint32_t* num_entries,
+                                 bool* has_default);
+
 /*------------------------------------------------------------------------*/
 
 void btor_model_add_to_bv (Btor* btor,
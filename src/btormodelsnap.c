@@ -0,0 +1,226 @@
+/*  Boolector: Satisfiability Modulo Theories (SMT) solver.
+ *
+ *  Copyright (C) 2020 Aina Niemetz.
+ *  Copyright (C) 2020 Mathias Preiner.
+ *
+ *  This file is part of Boolector.
+ *  See COPYING for more information on using this software.
+ */
+
+#include "btormodelsnap.h"
+
+#include "btorbv.h"
+#include "btormodel.h"
+#include "btornode.h"
+#include "btorsort.h"
+
+/*------------------------------------------------------------------------*/
+
+#define NUM_WORDS(width) (((size_t) (width) + 63) / 64)
+
+/* Note: externally referenced nodes may have been simplified to proxies,
+ * hence terms are classified by sort rather than by kind. */
+
+static bool
+is_snap_node (Btor *btor, BtorNode *exp)
+{
+  BtorSortId sort;
+
+  if (!exp || !exp->ext_refs || exp->parameterized) return false;
+  if (btor_node_is_param (exp)) return false;
+  sort = btor_node_get_sort_id (exp);
+  return btor_sort_is_bv (btor, sort) || btor_sort_is_fun (btor, sort);
+}
+
+static bool
+is_snap_fun (Btor *btor, BtorNode *exp)
+{
+  return btor_sort_is_fun (btor, btor_node_get_sort_id (exp));
+}
+
+BtorModelSnap *
+btor_model_snap_new (Btor *btor)
+{
+  assert (btor);
+  assert (btor->last_sat_result == BTOR_RESULT_SAT);
+  assert (btor->valid_assignments);
+
+  uint32_t i, nbv, nfun, num_entries;
+  size_t bvpos, funpos, size;
+  bool has_default;
+  BtorMemMgr *mm;
+  BtorModelSnap *res;
+  BtorNode *cur;
+  const BtorBitVector *bv;
+
+  mm = btor_mem_mgr_new ();
+  BTOR_CNEW (mm, res);
+  res->mm = mm;
+
+  /* count terms and words */
+  for (i = 1; i < BTOR_COUNT_STACK (btor->nodes_id_table); i++)
+  {
+    cur = BTOR_PEEK_STACK (btor->nodes_id_table, i);
+    if (!is_snap_node (btor, cur)) continue;
+    if (is_snap_fun (btor, cur))
+    {
+      res->num_fun += 1;
+      res->fun_words_size +=
+          btor_model_get_fun_words (btor, cur, 0, 0, &num_entries, &has_default);
+    }
+    else
+    {
+      res->num_bv += 1;
+      res->bv_words_size += NUM_WORDS (btor_node_bv_get_width (btor, cur));
+    }
+  }
+
+  if (res->num_bv)
+  {
+    BTOR_NEWN (mm, res->bv_ids, res->num_bv);
+    BTOR_NEWN (mm, res->bv_width, res->num_bv);
+    BTOR_NEWN (mm, res->bv_pos, res->num_bv);
+    BTOR_NEWN (mm, res->bv_words, res->bv_words_size);
+  }
+  if (res->num_fun)
+  {
+    BTOR_NEWN (mm, res->fun_ids, res->num_fun);
+    BTOR_NEWN (mm, res->fun_pos, res->num_fun);
+    BTOR_NEWN (mm, res->fun_size, res->num_fun);
+    BTOR_NEWN (mm, res->fun_entries, res->num_fun);
+    BTOR_NEWN (mm, res->fun_default, res->num_fun);
+    if (res->fun_words_size)
+      BTOR_NEWN (mm, res->fun_words, res->fun_words_size);
+  }
+
+  /* copy assignments, nodes are visited in the order of their ids */
+  nbv = nfun = 0;
+  bvpos = funpos = 0;
+  for (i = 1; i < BTOR_COUNT_STACK (btor->nodes_id_table); i++)
+  {
+    cur = BTOR_PEEK_STACK (btor->nodes_id_table, i);
+    if (!is_snap_node (btor, cur)) continue;
+    if (is_snap_fun (btor, cur))
+    {
+      size = btor_model_get_fun_words (btor,
+                                       cur,
+                                       res->fun_words + funpos,
+                                       res->fun_words_size - funpos,
+                                       &res->fun_entries[nfun],
+                                       &res->fun_default[nfun]);
+      res->fun_ids[nfun]  = cur->id;
+      res->fun_pos[nfun]  = funpos;
+      res->fun_size[nfun] = size;
+      funpos += size;
+      nfun += 1;
+    }
+    else
+    {
+      bv                  = btor_model_get_bv (btor, cur);
+      res->bv_ids[nbv]    = cur->id;
+      res->bv_width[nbv]  = btor_bv_get_width (bv);
+      res->bv_pos[nbv]    = bvpos;
+      btor_bv_to_words (bv, res->bv_words + bvpos);
+      bvpos += NUM_WORDS (res->bv_width[nbv]);
+      nbv += 1;
+    }
+  }
+  assert (nbv == res->num_bv);
+  assert (nfun == res->num_fun);
+  assert (bvpos == res->bv_words_size);
+  assert (funpos == res->fun_words_size);
+
+  return res;
+}
+
+void
+btor_model_snap_delete (BtorModelSnap *snap)
+{
+  assert (snap);
+
+  BtorMemMgr *mm;
+
+  mm = snap->mm;
+  if (snap->num_bv)
+  {
+    BTOR_DELETEN (mm, snap->bv_ids, snap->num_bv);
+    BTOR_DELETEN (mm, snap->bv_width, snap->num_bv);
+    BTOR_DELETEN (mm, snap->bv_pos, snap->num_bv);
+    BTOR_DELETEN (mm, snap->bv_words, snap->bv_words_size);
+  }
+  if (snap->num_fun)
+  {
+    BTOR_DELETEN (mm, snap->fun_ids, snap->num_fun);
+    BTOR_DELETEN (mm, snap->fun_pos, snap->num_fun);
+    BTOR_DELETEN (mm, snap->fun_size, snap->num_fun);
+    BTOR_DELETEN (mm, snap->fun_entries, snap->num_fun);
+    BTOR_DELETEN (mm, snap->fun_default, snap->num_fun);
+    if (snap->fun_words_size)
+      BTOR_DELETEN (mm, snap->fun_words, snap->fun_words_size);
+  }
+  BTOR_DELETE (mm, snap);
+  btor_mem_mgr_delete (mm);
+}
+
+/*------------------------------------------------------------------------*/
+
+static int32_t
+find_id (const int32_t *ids, uint32_t n, int32_t id)
+{
+  uint32_t lo, hi, mid;
+
+  lo = 0;
+  hi = n;
+  while (lo < hi)
+  {
+    mid = lo + (hi - lo) / 2;
+    if (ids[mid] == id) return (int32_t) mid;
+    if (ids[mid] < id)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return -1;
+}
+
+int32_t
+btor_model_snap_find_bv (const BtorModelSnap *snap, int32_t id)
+{
+  assert (snap);
+  assert (id > 0);
+  return find_id (snap->bv_ids, snap->num_bv, id);
+}
+
+void
+btor_model_snap_get_bv (const BtorModelSnap *snap,
+                        uint32_t i,
+                        bool inverted,
+                        uint64_t *words)
+{
+  assert (snap);
+  assert (i < snap->num_bv);
+  assert (words);
+
+  uint32_t rem;
+  size_t j, n;
+  const uint64_t *bv_words;
+
+  n        = NUM_WORDS (snap->bv_width[i]);
+  bv_words = snap->bv_words + snap->bv_pos[i];
+  if (!inverted)
+  {
+    for (j = 0; j < n; j++) words[j] = bv_words[j];
+    return;
+  }
+  for (j = 0; j < n; j++) words[j] = ~bv_words[j];
+  rem = snap->bv_width[i] % 64;
+  if (rem) words[n - 1] &= ((uint64_t) 1 << rem) - 1;
+}
+
+int32_t
+btor_model_snap_find_fun (const BtorModelSnap *snap, int32_t id)
+{
+  assert (snap);
+  assert (id > 0);
+  return find_id (snap->fun_ids, snap->num_fun, id);
+}
@@ -0,0 +1,69 @@
+/*  Boolector: Satisfiability Modulo Theories (SMT) solver.
+ *
+ *  Copyright (C) 2020 Aina Niemetz.
+ *  Copyright (C) 2020 Mathias Preiner.
+ *
+ *  This file is part of Boolector.
+ *  See COPYING for more information on using this software.
+ */
+
+#ifndef BTORMODELSNAP_H_INCLUDED
+#define BTORMODELSNAP_H_INCLUDED
+
+#include "btorcore.h"
+#include "utils/btormem.h"
+
+/*------------------------------------------------------------------------*/
+
+/* Immutable copy of the model of all externally referenced bit-vector terms,
+ * arrays and functions of a Btor instance.  Assignments are stored in binary
+ * form (64-bit words, least significant word first) in arrays sorted by node
+ * id.  A snapshot owns its memory manager and does not refer to the Btor
+ * instance it was taken from, hence it can be queried concurrently from
+ * several threads and independently of (and after deletion of) the Btor
+ * instance. */
+
+struct BtorModelSnap
+{
+  BtorMemMgr *mm;
+
+  uint32_t num_bv;    /* number of bit-vector terms */
+  int32_t *bv_ids;    /* node ids, sorted */
+  uint32_t *bv_width; /* bit-widths */
+  size_t *bv_pos;     /* position of assignment in 'bv_words' */
+  uint64_t *bv_words;
+  size_t bv_words_size;
+
+  uint32_t num_fun;       /* number of arrays and functions */
+  int32_t *fun_ids;       /* node ids, sorted */
+  size_t *fun_pos;        /* position of model in 'fun_words' */
+  size_t *fun_size;       /* number of words of model */
+  uint32_t *fun_entries;  /* number of argument/value entries */
+  bool *fun_default;      /* model has a default value */
+  uint64_t *fun_words;
+  size_t fun_words_size;
+};
+
+typedef struct BtorModelSnap BtorModelSnap;
+
+/* Take a snapshot of the current model of 'btor'. */
+BtorModelSnap *btor_model_snap_new (Btor *btor);
+
+void btor_model_snap_delete (BtorModelSnap *snap);
+
+/* Get the index of the bit-vector term with node id 'id' in the snapshot, or
+ * -1 if it is not part of the snapshot. */
+int32_t btor_model_snap_find_bv (const BtorModelSnap *snap, int32_t id);
+
+/* Write the assignment of the bit-vector term at index 'i' (negated if
+ * 'inverted') to 'words' as in btor_bv_to_words. */
+void btor_model_snap_get_bv (const BtorModelSnap *snap,
+                             uint32_t i,
+                             bool inverted,
+                             uint64_t *words);
+
+/* Get the index of the array or function with node id 'id' in the snapshot,
+ * or -1 if it is not part of the snapshot. */
+int32_t btor_model_snap_find_fun (const BtorModelSnap *snap, int32_t id);
+
+#endif
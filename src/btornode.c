@@ -22,6 +22,7 @@
 #include "utils/btorhashint.h"
 #include "utils/btorhashptr.h"
 #include "utils/btornodeiter.h"
+#include "utils/btoruniquetable.h"
 #include "utils/btorutil.h"
 
 #include <assert.h>
@@ -33,14 +34,6 @@
 
 /*------------------------------------------------------------------------*/
 
-#define BTOR_UNIQUE_TABLE_LIMIT 30
-
-#define BTOR_FULL_UNIQUE_TABLE(table)   \
-  ((table).num_elements >= (table).size \
-   && btor_util_log_2 ((table).size) < BTOR_UNIQUE_TABLE_LIMIT)
-
-/*------------------------------------------------------------------------*/
-
 const char *const g_btor_op2str[BTOR_NUM_OPS_NODE] = {
     [BTOR_INVALID_NODE] = "invalid", [BTOR_BV_CONST_NODE] = "bvconst",
     [BTOR_VAR_NODE] = "var",         [BTOR_PARAM_NODE] = "param",
@@ -322,7 +315,9 @@ hash_slice_exp (BtorNode *e, uint32_t upper, uint32_t lower)
 static inline uint32_t
 hash_bv_exp (Btor *btor, BtorNodeKind kind, uint32_t arity, BtorNode *e[])
 {
-  uint32_t hash = 0;
+  /* include the kind to distinguish nodes with the same children via the
+   * hash values cached in the unique table */
+  uint32_t hash = (uint32_t) kind;
   uint32_t i;
 #ifndef NDEBUG
   if (btor_opt_get (btor, BTOR_OPT_SORT_EXP) > 0
@@ -331,7 +326,6 @@ hash_bv_exp (Btor *btor, BtorNodeKind kind, uint32_t arity, BtorNode *e[])
                                  <= btor_node_real_addr (e[1])->id);
 #else
   (void) btor;
-  (void) kind;
 #endif
   assert (arity <= NPRIMES);
   for (i = 0; i < arity; i++)
@@ -419,11 +413,9 @@ hash_binder_exp (Btor *btor,
 
 /* Computes hash value of expresssion by children ids */
 static uint32_t
-compute_hash_exp (Btor *btor, BtorNode *exp, uint32_t table_size)
+compute_hash_exp (Btor *btor, BtorNode *exp)
 {
   assert (exp);
-  assert (table_size > 0);
-  assert (btor_util_is_power_of_2 (table_size));
   assert (btor_node_is_regular (exp));
   assert (!btor_node_is_bv_var (exp));
   assert (!btor_node_is_uf (exp));
@@ -447,7 +439,6 @@ compute_hash_exp (Btor *btor, BtorNode *exp, uint32_t table_size)
                            btor_node_bv_slice_get_lower (exp));
   else
     hash = hash_bv_exp (btor, exp->kind, exp->arity, exp->e);
-  hash &= table_size - 1;
   return hash;
 }
 
@@ -480,76 +471,21 @@ setup_node_and_add_to_id_table (Btor *btor, void *ptr)
   if (btor_node_is_apply (exp)) exp->apply_below = 1;
 }
 
-/* Enlarges unique table and rehashes expressions. */
-static void
-enlarge_nodes_unique_table (Btor *btor)
-{
-  assert (btor);
-
-  BtorMemMgr *mm;
-  uint32_t size, new_size, i;
-  uint32_t hash;
-  BtorNode *cur, *temp, **new_chains;
-
-  mm       = btor->mm;
-  size     = btor->nodes_unique_table.size;
-  new_size = size ? 2 * size : 1;
-  BTOR_CNEWN (mm, new_chains, new_size);
-  for (i = 0; i < size; i++)
-  {
-    cur = btor->nodes_unique_table.chains[i];
-    while (cur)
-    {
-      assert (btor_node_is_regular (cur));
-      assert (!btor_node_is_bv_var (cur));
-      assert (!btor_node_is_uf (cur));
-      temp             = cur->next;
-      hash             = compute_hash_exp (btor, cur, new_size);
-      cur->next        = new_chains[hash];
-      new_chains[hash] = cur;
-      cur              = temp;
-    }
-  }
-  BTOR_DELETEN (mm, btor->nodes_unique_table.chains, size);
-  btor->nodes_unique_table.size   = new_size;
-  btor->nodes_unique_table.chains = new_chains;
-}
-
 static void
 remove_from_nodes_unique_table_exp (Btor *btor, BtorNode *exp)
 {
   assert (exp);
   assert (btor_node_is_regular (exp));
 
-  uint32_t hash;
-  BtorNode *cur, *prev;
-
   if (!exp->unique) return;
 
   assert (btor);
   assert (btor->nodes_unique_table.num_elements > 0);
 
-  hash = compute_hash_exp (btor, exp, btor->nodes_unique_table.size);
-  prev = 0;
-  cur  = btor->nodes_unique_table.chains[hash];
-
-  while (cur != exp)
-  {
-    assert (cur);
-    assert (btor_node_is_regular (cur));
-    prev = cur;
-    cur  = cur->next;
-  }
-  assert (cur);
-  if (!prev)
-    btor->nodes_unique_table.chains[hash] = cur->next;
-  else
-    prev->next = cur->next;
-
-  btor->nodes_unique_table.num_elements--;
+  btor_uniquetable_remove (
+      &btor->nodes_unique_table, exp->id, compute_hash_exp (btor, exp));
 
   exp->unique = 0; /* NOTE: this is not debugging code ! */
-  exp->next   = 0;
 }
 
 static void
@@ -893,7 +829,7 @@ really_deallocate_exp (Btor *btor, BtorNode *exp)
   btor_sort_release (btor, btor_node_get_sort_id (exp));
   btor_node_set_sort_id (exp, 0);
 
-  btor_mem_free (mm, exp, exp->bytes);
+  btor_mem_slab_free (mm, exp, exp->bytes);
 }
 
 static void
@@ -1481,109 +1417,150 @@ sort_bv_exp (Btor *btor, BtorNodeKind kind, BtorNode *e[])
 
 /*------------------------------------------------------------------------*/
 
-/* Search for constant expression in hash table. Returns 0 if not found. */
-static BtorNode **
-find_const_exp (Btor *btor, BtorBitVector *bits)
+/* Lookups in the unique table (see btor_uniquetable_find) compare a
+ * candidate node with the given key only if their hash values match. */
+
+#define BTOR_UNIQUE_NODE(btor, id) BTOR_PEEK_STACK ((btor)->nodes_id_table, id)
+
+struct BtorFindConstExp
+{
+  Btor *btor;
+  BtorBitVector *bits;
+};
+
+typedef struct BtorFindConstExp BtorFindConstExp;
+
+static bool
+equal_const_exp (void *state, int32_t id)
+{
+  BtorFindConstExp *key = state;
+  BtorNode *cur         = BTOR_UNIQUE_NODE (key->btor, id);
+
+  assert (btor_node_is_regular (cur));
+  return btor_node_is_bv_const (cur)
+         && btor_node_bv_get_width (key->btor, cur)
+                == btor_bv_get_width (key->bits)
+         && !btor_bv_compare (btor_node_bv_const_get_bits (cur), key->bits);
+}
+
+/* Search for constant expression in unique table. Returns 0 if not found. */
+static BtorNode *
+find_const_exp (Btor *btor, BtorBitVector *bits, uint32_t *hash)
 {
   assert (btor);
   assert (bits);
+  assert (hash);
 
-  BtorNode *cur, **result;
-  uint32_t hash;
+  BtorFindConstExp key = {btor, bits};
+  int32_t id;
 
-  hash = btor_bv_hash (bits);
-  hash &= btor->nodes_unique_table.size - 1;
-  result = btor->nodes_unique_table.chains + hash;
-  cur    = *result;
-  while (cur)
-  {
-    assert (btor_node_is_regular (cur));
-    if (btor_node_is_bv_const (cur)
-        && btor_node_bv_get_width (btor, cur) == btor_bv_get_width (bits)
-        && !btor_bv_compare (btor_node_bv_const_get_bits (cur), bits))
-      break;
-    else
-    {
-      result = &cur->next;
-      cur    = *result;
-    }
-  }
-  return result;
+  *hash = btor_bv_hash (bits);
+  id    = btor_uniquetable_find (
+      &btor->nodes_unique_table, *hash, equal_const_exp, &key);
+  return id ? BTOR_UNIQUE_NODE (btor, id) : 0;
 }
 
-/* Search for slice expression in hash table. Returns 0 if not found. */
-static BtorNode **
-find_slice_exp (Btor *btor, BtorNode *e0, uint32_t upper, uint32_t lower)
+struct BtorFindSliceExp
+{
+  Btor *btor;
+  BtorNode *e0;
+  uint32_t upper, lower;
+};
+
+typedef struct BtorFindSliceExp BtorFindSliceExp;
+
+static bool
+equal_slice_exp (void *state, int32_t id)
+{
+  BtorFindSliceExp *key = state;
+  BtorNode *cur         = BTOR_UNIQUE_NODE (key->btor, id);
+
+  assert (btor_node_is_regular (cur));
+  return cur->kind == BTOR_BV_SLICE_NODE && cur->e[0] == key->e0
+         && btor_node_bv_slice_get_upper (cur) == key->upper
+         && btor_node_bv_slice_get_lower (cur) == key->lower;
+}
+
+/* Search for slice expression in unique table. Returns 0 if not found. */
+static BtorNode *
+find_slice_exp (
+    Btor *btor, BtorNode *e0, uint32_t upper, uint32_t lower, uint32_t *hash)
 {
   assert (btor);
   assert (e0);
   assert (upper >= lower);
 
-  BtorNode *cur, **result;
-  uint32_t hash;
+  BtorFindSliceExp key = {btor, e0, upper, lower};
+  uint32_t h;
+  int32_t id;
 
-  hash = hash_slice_exp (e0, upper, lower);
-  hash &= btor->nodes_unique_table.size - 1;
-  result = btor->nodes_unique_table.chains + hash;
-  cur    = *result;
-  while (cur)
-  {
-    assert (btor_node_is_regular (cur));
-    if (cur->kind == BTOR_BV_SLICE_NODE && cur->e[0] == e0
-        && btor_node_bv_slice_get_upper (cur) == upper
-        && btor_node_bv_slice_get_lower (cur) == lower)
-      break;
-    else
-    {
-      result = &cur->next;
-      cur    = *result;
-    }
-  }
-  return result;
+  h  = hash_slice_exp (e0, upper, lower);
+  id = btor_uniquetable_find (&btor->nodes_unique_table, h, equal_slice_exp, &key);
+  if (hash) *hash = h;
+  return id ? BTOR_UNIQUE_NODE (btor, id) : 0;
 }
 
-static BtorNode **
-find_bv_exp (Btor *btor, BtorNodeKind kind, BtorNode *e[], uint32_t arity)
+struct BtorFindBvExp
 {
-  bool equal;
+  Btor *btor;
+  BtorNodeKind kind;
+  BtorNode **e;
+  uint32_t arity;
+};
+
+typedef struct BtorFindBvExp BtorFindBvExp;
+
+static bool
+equal_bv_exp (void *state, int32_t id)
+{
+  BtorFindBvExp *key = state;
+  BtorNode *cur      = BTOR_UNIQUE_NODE (key->btor, id);
+  BtorNode **e       = key->e;
   uint32_t i;
-  uint32_t hash;
-  BtorNode *cur, **result;
+
+  assert (btor_node_is_regular (cur));
+  if (cur->kind != key->kind || cur->arity != key->arity) return false;
+  /* special case for bv eq; (= (bvnot a) b) == (= a (bvnot b)) */
+  if (key->kind == BTOR_BV_EQ_NODE && cur->e[0] == btor_node_invert (e[0])
+      && cur->e[1] == btor_node_invert (e[1]))
+    return true;
+  for (i = 0; i < key->arity; i++)
+    if (cur->e[i] != e[i]) break;
+  if (i == key->arity) return true;
+#ifndef NDEBUG
+  if (btor_opt_get (key->btor, BTOR_OPT_SORT_EXP) > 0
+      && btor_node_is_binary_commutative_kind (key->kind))
+    assert (key->arity == 2),
+        assert (e[0] == e[1] || btor_node_invert (e[0]) == e[1]
+                || !(cur->e[0] == e[1] && cur->e[1] == e[0]));
+#endif
+  return false;
+}
+
+static BtorNode *
+find_bv_exp (Btor *btor,
+             BtorNodeKind kind,
+             BtorNode *e[],
+             uint32_t arity,
+             uint32_t *hash)
+{
+  BtorFindBvExp key;
+  uint32_t h;
+  int32_t id;
 
   assert (kind != BTOR_BV_SLICE_NODE);
   assert (kind != BTOR_BV_CONST_NODE);
 
   sort_bv_exp (btor, kind, e);
-  hash = hash_bv_exp (btor, kind, arity, e);
-  hash &= btor->nodes_unique_table.size - 1;
+  h = hash_bv_exp (btor, kind, arity, e);
 
-  result = btor->nodes_unique_table.chains + hash;
-  cur    = *result;
-  while (cur)
-  {
-    assert (btor_node_is_regular (cur));
-    if (cur->kind == kind && cur->arity == arity)
-    {
-      equal = true;
-      /* special case for bv eq; (= (bvnot a) b) == (= a (bvnot b)) */
-      if (kind == BTOR_BV_EQ_NODE && cur->e[0] == btor_node_invert (e[0])
-          && cur->e[1] == btor_node_invert (e[1]))
-        break;
-      for (i = 0; i < arity && equal; i++)
-        if (cur->e[i] != e[i]) equal = false;
-      if (equal) break;
-#ifndef NDEBUG
-      if (btor_opt_get (btor, BTOR_OPT_SORT_EXP) > 0
-          && btor_node_is_binary_commutative_kind (kind))
-        assert (arity == 2),
-            assert (e[0] == e[1] || btor_node_invert (e[0]) == e[1]
-                    || !(cur->e[0] == e[1] && cur->e[1] == e[0]));
-#endif
-    }
-    result = &(cur->next);
-    cur    = *result;
-  }
-  return result;
+  key.btor  = btor;
+  key.kind  = kind;
+  key.e     = e;
+  key.arity = arity;
+  id = btor_uniquetable_find (&btor->nodes_unique_table, h, equal_bv_exp, &key);
+  if (hash) *hash = h;
+  return id ? BTOR_UNIQUE_NODE (btor, id) : 0;
 }
 
 static int32_t compare_binder_exp (Btor *btor,
@@ -1592,7 +1569,32 @@ static int32_t compare_binder_exp (Btor *btor,
                                    BtorNode *binder,
                                    BtorPtrHashTable *map);
 
-static BtorNode **
+struct BtorFindBinderExp
+{
+  Btor *btor;
+  BtorNodeKind kind;
+  BtorNode *param;
+  BtorNode *body;
+  BtorPtrHashTable *map;
+};
+
+typedef struct BtorFindBinderExp BtorFindBinderExp;
+
+static bool
+equal_binder_exp (void *state, int32_t id)
+{
+  BtorFindBinderExp *key = state;
+  BtorNode *cur          = BTOR_UNIQUE_NODE (key->btor, id);
+
+  assert (btor_node_is_regular (cur));
+  return cur->kind == key->kind
+         && ((!key->map && key->param == cur->e[0] && key->body == cur->e[1])
+             || (((key->map || !cur->parameterized)
+                  && compare_binder_exp (
+                      key->btor, key->param, key->body, cur, key->map))));
+}
+
+static BtorNode *
 find_binder_exp (Btor *btor,
                  BtorNodeKind kind,
                  BtorNode *param,
@@ -1607,8 +1609,10 @@ find_binder_exp (Btor *btor,
   assert (btor_node_is_regular (param));
   assert (btor_node_is_param (param));
 
-  BtorNode *cur, **result;
+  BtorFindBinderExp key = {btor, kind, param, body, map};
+  BtorNode *result;
   uint32_t hash;
+  int32_t id;
 
   hash = hash_binder_exp (btor, param, body, params);
 
@@ -1619,29 +1623,15 @@ find_binder_exp (Btor *btor,
            hash);
 
   if (binder_hash) *binder_hash = hash;
-  hash &= btor->nodes_unique_table.size - 1;
-  result = btor->nodes_unique_table.chains + hash;
-  cur    = *result;
-  while (cur)
-  {
-    assert (btor_node_is_regular (cur));
-    if (cur->kind == kind
-        && ((!map && param == cur->e[0] && body == cur->e[1])
-            || (((map || !cur->parameterized)
-                 && compare_binder_exp (btor, param, body, cur, map)))))
-      break;
-    else
-    {
-      result = &cur->next;
-      cur    = *result;
-    }
-  }
-  assert (!*result || btor_node_is_binder (*result));
+  id = btor_uniquetable_find (
+      &btor->nodes_unique_table, hash, equal_binder_exp, &key);
+  result = id ? BTOR_UNIQUE_NODE (btor, id) : 0;
+  assert (!result || btor_node_is_binder (result));
   BTORLOG (2,
            "found binder %s %s -> %s",
            btor_util_node2string (param),
            btor_util_node2string (body),
-           btor_util_node2string (*result));
+           btor_util_node2string (result));
   return result;
 }
 
@@ -1749,13 +1739,13 @@ compare_binder_exp (Btor *btor,
 
       if (btor_node_is_binder (real_cur))
       {
-        result = *find_binder_exp (btor,
-                                   real_cur->kind,
-                                   real_cur->e[0],
-                                   real_cur->e[1],
-                                   0,
-                                   0,
-                                   param_map);
+        result = find_binder_exp (btor,
+                                  real_cur->kind,
+                                  real_cur->e[0],
+                                  real_cur->e[1],
+                                  0,
+                                  0,
+                                  param_map);
         if (result)
         {
           b->data.as_ptr = result;
@@ -1782,10 +1772,11 @@ compare_binder_exp (Btor *btor,
 
       if (btor_node_is_bv_slice (real_cur))
       {
-        result = *find_slice_exp (btor,
-                                  e[0],
-                                  btor_node_bv_slice_get_upper (real_cur),
-                                  btor_node_bv_slice_get_lower (real_cur));
+        result = find_slice_exp (btor,
+                                 e[0],
+                                 btor_node_bv_slice_get_upper (real_cur),
+                                 btor_node_bv_slice_get_lower (real_cur),
+                                 0);
       }
       else if (btor_node_is_param (real_cur))
       {
@@ -1797,7 +1788,7 @@ compare_binder_exp (Btor *btor,
       else
       {
         assert (!btor_node_is_binder (real_cur));
-        result = *find_bv_exp (btor, real_cur->kind, e, real_cur->arity);
+        result = find_bv_exp (btor, real_cur->kind, e, real_cur->arity, 0);
       }
 
       if (!result)
@@ -1828,12 +1819,14 @@ NOT_EQUAL:
   return equal;
 }
 
-static BtorNode **
+/* Search for expression in unique table, 'hash' is set to its hash value.
+ * Returns 0 if not found. */
+static BtorNode *
 find_exp (Btor *btor,
           BtorNodeKind kind,
           BtorNode *e[],
           uint32_t arity,
-          uint32_t *binder_hash,
+          uint32_t *hash,
           BtorIntHashTable *params)
 {
   assert (btor);
@@ -1847,11 +1840,9 @@ find_exp (Btor *btor,
 
   if (kind == BTOR_LAMBDA_NODE || kind == BTOR_FORALL_NODE
       || kind == BTOR_EXISTS_NODE)
-    return find_binder_exp (btor, kind, e[0], e[1], binder_hash, params, 0);
-  else if (binder_hash)
-    *binder_hash = 0;
+    return find_binder_exp (btor, kind, e[0], e[1], hash, params, 0);
 
-  return find_bv_exp (btor, kind, e, arity);
+  return find_bv_exp (btor, kind, e, arity, hash);
 }
 
 /*------------------------------------------------------------------------*/
@@ -1864,7 +1855,7 @@ new_const_exp_node (Btor *btor, BtorBitVector *bits)
 
   BtorBVConstNode *exp;
 
-  BTOR_CNEW (btor->mm, exp);
+  BTOR_SLAB_CNEW (btor->mm, exp);
   set_kind (btor, (BtorNode *) exp, BTOR_BV_CONST_NODE);
   exp->bytes = sizeof *exp;
   btor_node_set_sort_id ((BtorNode *) exp,
@@ -1887,7 +1878,7 @@ new_slice_exp_node (Btor *btor, BtorNode *e0, uint32_t upper, uint32_t lower)
 
   BtorBVSliceNode *exp = 0;
 
-  BTOR_CNEW (btor->mm, exp);
+  BTOR_SLAB_CNEW (btor->mm, exp);
   set_kind (btor, (BtorNode *) exp, BTOR_BV_SLICE_NODE);
   exp->bytes = sizeof *exp;
   exp->arity = 1;
@@ -1921,7 +1912,7 @@ new_lambda_exp_node (Btor *btor, BtorNode *e_param, BtorNode *e_exp)
 
   BTOR_INIT_STACK (btor->mm, param_sorts);
 
-  BTOR_CNEW (btor->mm, lambda_exp);
+  BTOR_SLAB_CNEW (btor->mm, lambda_exp);
   set_kind (btor, (BtorNode *) lambda_exp, BTOR_LAMBDA_NODE);
   lambda_exp->bytes        = sizeof *lambda_exp;
   lambda_exp->arity        = 2;
@@ -2002,7 +1993,7 @@ new_quantifier_exp_node (Btor *btor,
 
   BtorBinderNode *res;
 
-  BTOR_CNEW (btor->mm, res);
+  BTOR_SLAB_CNEW (btor->mm, res);
   set_kind (btor, (BtorNode *) res, kind);
   res->bytes            = sizeof *res;
   res->arity            = 2;
@@ -2050,7 +2041,7 @@ new_args_exp_node (Btor *btor, uint32_t arity, BtorNode *e[])
   for (i = 0; i < arity; i++) assert (e[i]);
 #endif
 
-  BTOR_CNEW (btor->mm, exp);
+  BTOR_SLAB_CNEW (btor->mm, exp);
   set_kind (btor, (BtorNode *) exp, BTOR_ARGS_NODE);
   exp->bytes = sizeof (*exp);
   exp->arity = arity;
@@ -2109,7 +2100,7 @@ new_node (Btor *btor, BtorNodeKind kind, uint32_t arity, BtorNode *e[])
   }
 #endif
 
-  BTOR_CNEW (btor->mm, exp);
+  BTOR_SLAB_CNEW (btor->mm, exp);
   set_kind (btor, (BtorNode *) exp, kind);
   exp->bytes = sizeof (*exp);
   exp->arity = arity;
@@ -2171,8 +2162,8 @@ create_exp (Btor *btor, BtorNodeKind kind, uint32_t arity, BtorNode *e[])
   assert (e);
 
   uint32_t i;
-  uint32_t binder_hash;
-  BtorNode **lookup, *simp_e[3], *simp;
+  uint32_t hash;
+  BtorNode *lookup, *simp_e[3], *simp;
   BtorIntHashTable *params = 0;
 
   for (i = 0; i < arity; i++)
@@ -2186,72 +2177,63 @@ create_exp (Btor *btor, BtorNodeKind kind, uint32_t arity, BtorNode *e[])
       || kind == BTOR_FORALL_NODE || kind == BTOR_EXISTS_NODE)
     params = btor_hashint_table_new (btor->mm);
 
-  lookup = find_exp (btor, kind, simp_e, arity, &binder_hash, params);
-  if (!*lookup)
+  lookup = find_exp (btor, kind, simp_e, arity, &hash, params);
+  if (!lookup)
   {
-    if (BTOR_FULL_UNIQUE_TABLE (btor->nodes_unique_table))
-    {
-      enlarge_nodes_unique_table (btor);
-      lookup = find_exp (btor, kind, simp_e, arity, &binder_hash, 0);
-    }
-
     switch (kind)
     {
       case BTOR_LAMBDA_NODE:
         assert (arity == 2);
-        *lookup = new_lambda_exp_node (btor, simp_e[0], simp_e[1]);
-        btor_hashptr_table_get (btor->lambdas, *lookup)->data.as_int =
-            binder_hash;
+        lookup = new_lambda_exp_node (btor, simp_e[0], simp_e[1]);
+        btor_hashptr_table_get (btor->lambdas, lookup)->data.as_int = hash;
         BTORLOG (2,
                  "new lambda: %s (hash: %u, param: %u)",
-                 btor_util_node2string (*lookup),
-                 binder_hash,
-                 (*lookup)->parameterized);
+                 btor_util_node2string (lookup),
+                 hash,
+                 lookup->parameterized);
         break;
       case BTOR_FORALL_NODE:
       case BTOR_EXISTS_NODE:
         assert (arity == 2);
-        *lookup = new_quantifier_exp_node (btor, kind, e[0], e[1]);
-        btor_hashptr_table_get (btor->quantifiers, *lookup)->data.as_int =
-            binder_hash;
+        lookup = new_quantifier_exp_node (btor, kind, e[0], e[1]);
+        btor_hashptr_table_get (btor->quantifiers, lookup)->data.as_int = hash;
         break;
       case BTOR_ARGS_NODE:
-        *lookup = new_args_exp_node (btor, arity, simp_e);
+        lookup = new_args_exp_node (btor, arity, simp_e);
         break;
-      default: *lookup = new_node (btor, kind, arity, simp_e);
+      default: lookup = new_node (btor, kind, arity, simp_e);
     }
 
     if (params)
     {
-      assert (btor_node_is_binder (*lookup));
+      assert (btor_node_is_binder (lookup));
       if (params->count > 0)
       {
-        btor_hashptr_table_add (btor->parameterized, *lookup)->data.as_ptr =
+        btor_hashptr_table_add (btor->parameterized, lookup)->data.as_ptr =
             params;
-        (*lookup)->parameterized = 1;
+        lookup->parameterized = 1;
       }
       else
         btor_hashint_table_delete (params);
     }
 
-    assert (btor->nodes_unique_table.num_elements < INT32_MAX);
-    btor->nodes_unique_table.num_elements++;
-    (*lookup)->unique = 1;
+    btor_uniquetable_insert (&btor->nodes_unique_table, lookup->id, hash);
+    lookup->unique = 1;
   }
   else
   {
-    inc_exp_ref_counter (btor, *lookup);
+    inc_exp_ref_counter (btor, lookup);
     if (params) btor_hashint_table_delete (params);
   }
-  assert (btor_node_is_regular (*lookup));
-  if (btor_node_is_simplified (*lookup))
+  assert (btor_node_is_regular (lookup));
+  if (btor_node_is_simplified (lookup))
   {
     assert (btor_opt_get (btor, BTOR_OPT_NONDESTR_SUBST));
-    simp = btor_node_copy (btor, btor_node_get_simplified (btor, *lookup));
-    btor_node_release (btor, *lookup);
+    simp = btor_node_copy (btor, btor_node_get_simplified (btor, lookup));
+    btor_node_release (btor, lookup);
     return simp;
   }
-  return *lookup;
+  return lookup;
 }
 
 /*------------------------------------------------------------------------*/
@@ -2263,8 +2245,9 @@ btor_node_create_bv_const (Btor *btor, const BtorBitVector *bits)
   assert (bits);
 
   bool inv;
+  uint32_t hash;
   BtorBitVector *lookupbits;
-  BtorNode **lookup;
+  BtorNode *lookup;
 
   /* normalize constants, constants are always even */
   if (btor_bv_get_bit (bits, 0))
@@ -2278,28 +2261,22 @@ btor_node_create_bv_const (Btor *btor, const BtorBitVector *bits)
     inv        = false;
   }
 
-  lookup = find_const_exp (btor, lookupbits);
-  if (!*lookup)
+  lookup = find_const_exp (btor, lookupbits, &hash);
+  if (!lookup)
   {
-    if (BTOR_FULL_UNIQUE_TABLE (btor->nodes_unique_table))
-    {
-      enlarge_nodes_unique_table (btor);
-      lookup = find_const_exp (btor, lookupbits);
-    }
-    *lookup = new_const_exp_node (btor, lookupbits);
-    assert (btor->nodes_unique_table.num_elements < INT32_MAX);
-    btor->nodes_unique_table.num_elements += 1;
-    (*lookup)->unique = 1;
+    lookup = new_const_exp_node (btor, lookupbits);
+    btor_uniquetable_insert (&btor->nodes_unique_table, lookup->id, hash);
+    lookup->unique = 1;
   }
   else
-    inc_exp_ref_counter (btor, *lookup);
+    inc_exp_ref_counter (btor, lookup);
 
-  assert (btor_node_is_regular (*lookup));
+  assert (btor_node_is_regular (lookup));
 
   btor_bv_free (btor->mm, lookupbits);
 
-  if (inv) return btor_node_invert (*lookup);
-  return *lookup;
+  if (inv) return btor_node_invert (lookup);
+  return lookup;
 }
 
 BtorNode *
@@ -2312,7 +2289,7 @@ btor_node_create_var (Btor *btor, BtorSortId sort, const char *symbol)
 
   BtorBVVarNode *exp;
 
-  BTOR_CNEW (btor->mm, exp);
+  BTOR_SLAB_CNEW (btor->mm, exp);
   set_kind (btor, (BtorNode *) exp, BTOR_VAR_NODE);
   exp->bytes = sizeof *exp;
   setup_node_and_add_to_id_table (btor, exp);
@@ -2335,7 +2312,7 @@ btor_node_create_uf (Btor *btor, BtorSortId sort, const char *symbol)
   assert (btor_sort_is_bv (btor, btor_sort_fun_get_codomain (btor, sort))
           || btor_sort_is_bool (btor, btor_sort_fun_get_codomain (btor, sort)));
 
-  BTOR_CNEW (btor->mm, exp);
+  BTOR_SLAB_CNEW (btor->mm, exp);
   set_kind (btor, (BtorNode *) exp, BTOR_UF_NODE);
   exp->bytes = sizeof (*exp);
   btor_node_set_sort_id ((BtorNode *) exp, btor_sort_copy (btor, sort));
@@ -2355,7 +2332,7 @@ btor_node_create_param (Btor *btor, BtorSortId sort, const char *symbol)
 
   BtorParamNode *exp;
 
-  BTOR_CNEW (btor->mm, exp);
+  BTOR_SLAB_CNEW (btor->mm, exp);
   set_kind (btor, (BtorNode *) exp, BTOR_PARAM_NODE);
   exp->bytes         = sizeof *exp;
   exp->parameterized = 1;
@@ -2373,7 +2350,8 @@ unary_exp_slice_exp (Btor *btor, BtorNode *exp, uint32_t upper, uint32_t lower)
   assert (btor == btor_node_real_addr (exp)->btor);
 
   bool inv;
-  BtorNode **lookup;
+  uint32_t hash;
+  BtorNode *lookup;
 
   exp = btor_simplify_exp (btor, exp);
 
@@ -2390,24 +2368,18 @@ unary_exp_slice_exp (Btor *btor, BtorNode *exp, uint32_t upper, uint32_t lower)
   else
     inv = false;
 
-  lookup = find_slice_exp (btor, exp, upper, lower);
-  if (!*lookup)
+  lookup = find_slice_exp (btor, exp, upper, lower, &hash);
+  if (!lookup)
   {
-    if (BTOR_FULL_UNIQUE_TABLE (btor->nodes_unique_table))
-    {
-      enlarge_nodes_unique_table (btor);
-      lookup = find_slice_exp (btor, exp, upper, lower);
-    }
-    *lookup = new_slice_exp_node (btor, exp, upper, lower);
-    assert (btor->nodes_unique_table.num_elements < INT32_MAX);
-    btor->nodes_unique_table.num_elements++;
-    (*lookup)->unique = 1;
+    lookup = new_slice_exp_node (btor, exp, upper, lower);
+    btor_uniquetable_insert (&btor->nodes_unique_table, lookup->id, hash);
+    lookup->unique = 1;
   }
   else
-    inc_exp_ref_counter (btor, *lookup);
-  assert (btor_node_is_regular (*lookup));
-  if (inv) return btor_node_invert (*lookup);
-  return *lookup;
+    inc_exp_ref_counter (btor, lookup);
+  assert (btor_node_is_regular (lookup));
+  if (inv) return btor_node_invert (lookup);
+  return lookup;
 }
 
 BtorNode *
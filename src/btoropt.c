@@ -302,6 +302,11 @@ btor_opt_init_opts (Btor *btor)
                 "quant",
                 BTOR_ENGINE_QUANT,
                 "use the quantifier engine (BV only)");
+  add_opt_help (mm,
+                opts,
+                "portfolio",
+                BTOR_ENGINE_PORTFOLIO,
+                "race a portfolio of engines in parallel (QF_AUFBV only)");
   btor->options[BTOR_OPT_ENGINE].options = opts;
 
   init_opt (btor,
@@ -527,6 +532,138 @@ btor_opt_init_opts (Btor *btor)
             0,
             1,
             "normalize add/mul/and operators");
+  init_opt (btor,
+            BTOR_OPT_PP_SKIP,
+            false,
+            true,
+            "pp-skip",
+            0,
+            1,
+            0,
+            1,
+            "skip ineffective preprocessing passes");
+  init_opt (btor,
+            BTOR_OPT_RW_CACHE_SIZE,
+            false,
+            false,
+            "rw-cache-size",
+            0,
+            32,
+            1,
+            1u << 16,
+            "maximum size of rewrite cache in MB");
+  init_opt (btor,
+            BTOR_OPT_RW_CACHE_EVICT,
+            false,
+            false,
+            "rw-cache-evict",
+            0,
+            BTOR_RW_CACHE_EVICT_DFLT,
+            BTOR_RW_CACHE_EVICT_MIN,
+            BTOR_RW_CACHE_EVICT_MAX,
+            "rewrite cache eviction policy");
+  opts = btor_hashptr_table_new (
+      btor->mm, (BtorHashPtr) btor_hash_str, (BtorCmpPtr) strcmpoptval);
+  add_opt_help (mm,
+                opts,
+                "lru",
+                BTOR_RW_CACHE_EVICT_LRU,
+                "evict least recently used entry");
+  add_opt_help (
+      mm, opts, "fifo", BTOR_RW_CACHE_EVICT_FIFO, "evict oldest entry");
+  add_opt_help (mm,
+                opts,
+                "none",
+                BTOR_RW_CACHE_EVICT_NONE,
+                "never evict entries (unbounded cache)");
+  btor->options[BTOR_OPT_RW_CACHE_EVICT].options = opts;
+  init_opt (btor,
+            BTOR_OPT_MUL_ENC,
+            false,
+            false,
+            "mul-enc",
+            0,
+            BTOR_MUL_ENC_DFLT,
+            BTOR_MUL_ENC_MIN,
+            BTOR_MUL_ENC_MAX,
+            "encoding of bit-vector multiplication");
+  opts = btor_hashptr_table_new (
+      btor->mm, (BtorHashPtr) btor_hash_str, (BtorCmpPtr) strcmpoptval);
+  add_opt_help (
+      mm, opts, "array", BTOR_MUL_ENC_ARRAY, "array (shift-and-add) multiplier");
+  add_opt_help (
+      mm, opts, "wallace", BTOR_MUL_ENC_WALLACE, "Wallace tree multiplier");
+  add_opt_help (
+      mm, opts, "dadda", BTOR_MUL_ENC_DADDA, "Dadda tree multiplier");
+  add_opt_help (mm,
+                opts,
+                "sparse",
+                BTOR_MUL_ENC_SPARSE,
+                "Dadda tree multiplier without zero partial products");
+  btor->options[BTOR_OPT_MUL_ENC].options = opts;
+  init_opt (btor,
+            BTOR_OPT_CNF_ENC,
+            false,
+            false,
+            "cnf-enc",
+            0,
+            BTOR_CNF_ENC_DFLT,
+            BTOR_CNF_ENC_MIN,
+            BTOR_CNF_ENC_MAX,
+            "encoding of AIGs into CNF");
+  opts = btor_hashptr_table_new (
+      btor->mm, (BtorHashPtr) btor_hash_str, (BtorCmpPtr) strcmpoptval);
+  add_opt_help (mm,
+                opts,
+                "tseitin",
+                BTOR_CNF_ENC_TSEITIN,
+                "Tseitin encoding (both polarities)");
+  add_opt_help (mm,
+                opts,
+                "pg",
+                BTOR_CNF_ENC_PG,
+                "Plaisted-Greenbaum encoding (polarity-aware)");
+  btor->options[BTOR_OPT_CNF_ENC].options = opts;
+  init_opt (btor,
+            BTOR_OPT_CNF_XOR_ITE,
+            false,
+            true,
+            "cnf-xor-ite",
+            0,
+            1,
+            0,
+            1,
+            "detect XOR and ITE gates when encoding AIGs into CNF");
+  init_opt (btor,
+            BTOR_OPT_AIG_REWRITE,
+            false,
+            true,
+            "aig-rewrite",
+            0,
+            0,
+            0,
+            1,
+            "rewrite AIGs based on 4-input cuts before CNF encoding");
+  init_opt (btor,
+            BTOR_OPT_SAT_SWEEP,
+            false,
+            true,
+            "sat-sweep",
+            0,
+            0,
+            0,
+            1,
+            "merge equivalent AIGs by SAT sweeping before CNF encoding");
+  init_opt (btor,
+            BTOR_OPT_SAT_SWEEP_LIMIT,
+            false,
+            false,
+            "sat-sweep-limit",
+            0,
+            1000,
+            0,
+            UINT32_MAX,
+            "limit per SAT call of SAT sweeping (0 for no limit)");
 
   /* FUN engine ---------------------------------------------------------- */
   init_opt (btor,
@@ -679,6 +816,28 @@ btor_opt_init_opts (Btor *btor)
             1,
             "represent array store as lambda");
 
+  init_opt (btor,
+            BTOR_OPT_FUN_CUBE,
+            false,
+            false,
+            "fun-cube",
+            0,
+            0,
+            0,
+            BTOR_FUN_CUBE_MAX,
+            "number of input bits to split on in cube-and-conquer mode");
+  init_opt (btor,
+            BTOR_OPT_FUN_CUBE_THREADS,
+            false,
+            false,
+            "fun-cube-threads",
+            0,
+            0,
+            0,
+            UINT32_MAX,
+            "number of worker threads in cube-and-conquer mode "
+            "(0: number of cores)");
+
   init_opt (
       btor,
       BTOR_OPT_PRINT_DIMACS,
@@ -905,6 +1064,48 @@ btor_opt_init_opts (Btor *btor)
             1,
             "use bandit scheme for constraint selection");
 
+  /* PORTFOLIO engine ----------------------------------------------------- */
+  init_opt (btor,
+            BTOR_OPT_PORTFOLIO_FUN,
+            false,
+            true,
+            "portfolio-fun",
+            0,
+            1,
+            0,
+            1,
+            "race fun engine in portfolio");
+  init_opt (btor,
+            BTOR_OPT_PORTFOLIO_SLS,
+            false,
+            true,
+            "portfolio-sls",
+            0,
+            0,
+            0,
+            1,
+            "race sls engine in portfolio (QF_BV only)");
+  init_opt (btor,
+            BTOR_OPT_PORTFOLIO_PROP,
+            false,
+            true,
+            "portfolio-prop",
+            0,
+            1,
+            0,
+            1,
+            "race prop engine in portfolio (QF_BV only)");
+  init_opt (btor,
+            BTOR_OPT_PORTFOLIO_AIGPROP,
+            false,
+            true,
+            "portfolio-aigprop",
+            0,
+            0,
+            0,
+            1,
+            "race aigprop engine in portfolio (QF_BV only)");
+
   /* PROP engine ---------------------------------------------------------- */
   init_opt (btor,
             BTOR_OPT_PROP_NPROPS,
@@ -1614,27 +1815,6 @@ btor_opt_set (Btor *btor, const BtorOption opt, uint32_t val)
   else if (opt == BTOR_OPT_MODEL_GEN)
   {
     if (!val && btor_opt_get (btor, opt)) btor_model_delete (btor);
-    if (val && btor_opt_get (btor, BTOR_OPT_UCOPT))
-    {
-      btor_opt_set (btor, BTOR_OPT_UCOPT, 0);
-      BTOR_MSG (btor->msg,
-                1,
-                "Disabling unconstrained optimization since model generation "
-                "is enabled");
-    }
-    assert (!val || !btor_opt_get (btor, BTOR_OPT_UCOPT));
-  }
-  else if (opt == BTOR_OPT_UCOPT)
-  {
-    if (val && btor_opt_get (btor, BTOR_OPT_MODEL_GEN))
-    {
-      BTOR_MSG (btor->msg,
-                1,
-                "Disabling unconstrained optimization since model generation "
-                "is enabled");
-      val = 0;
-    }
-    assert (!val || !btor_opt_get (btor, BTOR_OPT_INCREMENTAL));
   }
   else if (opt == BTOR_OPT_SAT_ENGINE)
   {
@@ -98,9 +98,10 @@ enum BtorOptEngine
   BTOR_ENGINE_PROP,
   BTOR_ENGINE_AIGPROP,
   BTOR_ENGINE_QUANT,
+  BTOR_ENGINE_PORTFOLIO,
 };
 #define BTOR_ENGINE_MIN BTOR_ENGINE_FUN
-#define BTOR_ENGINE_MAX BTOR_ENGINE_QUANT
+#define BTOR_ENGINE_MAX BTOR_ENGINE_PORTFOLIO
 #define BTOR_ENGINE_DFLT BTOR_ENGINE_FUN
 typedef enum BtorOptEngine BtorOptEngine;
 
@@ -153,6 +154,39 @@ enum BtorOptDPQsort
 #define BTOR_DP_QSORT_DFLT BTOR_DP_QSORT_JUST
 typedef enum BtorOptDPQsort BtorOptDPQsort;
 
+enum BtorOptRwCacheEvict
+{
+  BTOR_RW_CACHE_EVICT_LRU,
+  BTOR_RW_CACHE_EVICT_FIFO,
+  BTOR_RW_CACHE_EVICT_NONE,
+};
+#define BTOR_RW_CACHE_EVICT_MIN BTOR_RW_CACHE_EVICT_LRU
+#define BTOR_RW_CACHE_EVICT_MAX BTOR_RW_CACHE_EVICT_NONE
+#define BTOR_RW_CACHE_EVICT_DFLT BTOR_RW_CACHE_EVICT_LRU
+typedef enum BtorOptRwCacheEvict BtorOptRwCacheEvict;
+
+enum BtorOptMulEnc
+{
+  BTOR_MUL_ENC_ARRAY,
+  BTOR_MUL_ENC_WALLACE,
+  BTOR_MUL_ENC_DADDA,
+  BTOR_MUL_ENC_SPARSE,
+};
+#define BTOR_MUL_ENC_MIN BTOR_MUL_ENC_ARRAY
+#define BTOR_MUL_ENC_MAX BTOR_MUL_ENC_SPARSE
+#define BTOR_MUL_ENC_DFLT BTOR_MUL_ENC_ARRAY
+typedef enum BtorOptMulEnc BtorOptMulEnc;
+
+enum BtorOptCnfEnc
+{
+  BTOR_CNF_ENC_TSEITIN,
+  BTOR_CNF_ENC_PG,
+};
+#define BTOR_CNF_ENC_MIN BTOR_CNF_ENC_TSEITIN
+#define BTOR_CNF_ENC_MAX BTOR_CNF_ENC_PG
+#define BTOR_CNF_ENC_DFLT BTOR_CNF_ENC_TSEITIN
+typedef enum BtorOptCnfEnc BtorOptCnfEnc;
+
 enum BtorOptJustHeur
 {
   BTOR_JUST_HEUR_BRANCH_LEFT = 1,
@@ -212,6 +246,9 @@ enum BtorOptFunEagerLemmas
 #define BTOR_FUN_EAGER_LEMMAS_DFLT BTOR_FUN_EAGER_LEMMAS_CONF
 typedef enum BtorOptFunEagerLemmas BtorOptFunEagerLemmas;
 
+/* maximum number of cube bits, i.e., at most 2^16 cubes */
+#define BTOR_FUN_CUBE_MAX 16
+
 enum BtorOptIncrementalSMT1
 {
   BTOR_INCREMENTAL_SMT1_BASIC = 1,
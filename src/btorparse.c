@@ -19,6 +19,7 @@
 #include "parser/btorsmt2.h"
 #include "utils/btormem.h"
 #include "utils/btorstack.h"
+#include "utils/btorutil.h"
 
 #include <ctype.h>
 
@@ -58,6 +59,7 @@ parse_aux (Btor *btor,
   BtorParseResult parse_res;
   int32_t res;
   char *emsg;
+  double start, delta, mb;
 
   res        = BOOLECTOR_UNKNOWN;
   *error_msg = 0;
@@ -65,6 +67,8 @@ parse_aux (Btor *btor,
   BTOR_MSG (btor->msg, 1, "%s", msg);
   parser = parser_api->init (btor);
 
+  /* Note: exclude time spent in check-sat commands (interactive mode) */
+  start = btor_util_time_stamp () - btor->time.sat;
   if ((emsg = parser_api->parse (
            parser, prefix, infile, infile_name, outfile, &parse_res)))
   {
@@ -76,6 +80,18 @@ parse_aux (Btor *btor,
   {
     res = parse_res.nsatcalls ? parse_res.result : BOOLECTOR_PARSE_UNKNOWN;
 
+    mb    = parse_res.bytes / (double) (1 << 20);
+    delta = btor_util_time_stamp () - btor->time.sat - start;
+    if (delta > 0)
+      BTOR_MSG (btor->msg,
+                1,
+                "read %.1f MB in %.2f seconds (%.1f MB/s)",
+                mb,
+                delta,
+                mb / delta);
+    else
+      BTOR_MSG (btor->msg, 1, "read %.1f MB", mb);
+
     if (parse_res.logic == BTOR_LOGIC_QF_BV)
       BTOR_MSG (btor->msg, 1, "logic QF_BV");
     else if (parse_res.logic == BTOR_LOGIC_BV)
@@ -42,6 +42,7 @@ struct BtorParseResult
   int32_t status;
   int32_t result;
   uint32_t nsatcalls;
+  uint64_t bytes; /* number of bytes read */
 };
 
 struct BtorParserAPI
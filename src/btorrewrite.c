@@ -139,6 +139,10 @@ check_rw_cache (
       result = btor_node_copy (btor, btor_node_get_simplified (btor, result));
     }
   }
+  if (result)
+    btor->rw_cache->num_hits[kind]++;
+  else
+    btor->rw_cache->num_misses[kind]++;
   return result;
 }
 
@@ -8,11 +8,16 @@
 
 #include "btorrwcache.h"
 #include "btorcore.h"
+#include "btoropt.h"
+#include "utils/btorutil.h"
+
+/* Initial number of entries, allocated on first insertion. */
+#define BTOR_RW_CACHE_INIT_SIZE (1u << 12)
 
 static uint32_t hash_primes[] = {
     333444569u, 76891121u, 456790003u, 2654435761u};
 
-int32_t
+static int32_t
 compare_rw_cache_tuple (const BtorRwCacheTuple *t0, const BtorRwCacheTuple *t1)
 {
   assert (t0);
@@ -26,7 +31,7 @@ compare_rw_cache_tuple (const BtorRwCacheTuple *t0, const BtorRwCacheTuple *t1)
   return 1;
 }
 
-uint32_t
+static uint32_t
 hash_rw_cache_tuple (const BtorRwCacheTuple *t)
 {
   uint32_t hash;
@@ -48,6 +53,108 @@ is_valid_node (Btor *btor, int32_t id)
   return true;
 }
 
+static bool
+is_valid_tuple (Btor *btor, BtorRwCacheTuple *t)
+{
+  assert (t->kind != BTOR_INVALID_NODE);
+
+  /* We remove all cache entries that store invalid children node ids. An
+   * invalid node is either a node that does not exist anymore (deallocated) or
+   * if the node id belongs to a proxy node. Proxy nodes are never used to
+   * query the cache and are therefore useless cache entries. */
+  if (!is_valid_node (btor, t->n[0])) return false;
+  /* For slice nodes nid1 and nid2 correspond to the upper/lower indices. */
+  if (t->kind != BTOR_BV_SLICE_NODE)
+  {
+    if (t->n[1] && !is_valid_node (btor, t->n[1])) return false;
+    if (t->n[2] && !is_valid_node (btor, t->n[2])) return false;
+  }
+  return btor_node_get_by_id (btor, t->result) != 0;
+}
+
+/* Maximum number of entries as configured via BTOR_OPT_RW_CACHE_SIZE. */
+static uint32_t
+max_size_rw_cache (BtorRwCache *rwc)
+{
+  uint64_t max;
+  uint32_t res;
+
+  max = ((uint64_t) btor_opt_get (rwc->btor, BTOR_OPT_RW_CACHE_SIZE) << 20)
+        / sizeof (BtorRwCacheTuple);
+  for (res = BTOR_RW_CACHE_WAYS; res < (1u << 31) && 2 * res <= max; res *= 2)
+    ;
+  return res;
+}
+
+static uint32_t
+next_stamp_rw_cache (BtorRwCache *rwc)
+{
+  uint32_t i;
+
+  if (++rwc->stamp == 0)
+  {
+    /* overflow, restart counting (eviction order is lost once) */
+    for (i = 0; i < rwc->size; i++) rwc->cache[i].stamp = 0;
+    rwc->stamp = 1;
+  }
+  return rwc->stamp;
+}
+
+/* Returns the first entry of the set 't' maps to. */
+static BtorRwCacheTuple *
+get_set_rw_cache (BtorRwCache *rwc, const BtorRwCacheTuple *t)
+{
+  assert (rwc->size);
+  assert (btor_util_is_power_of_2 (rwc->size));
+  return rwc->cache
+         + ((hash_rw_cache_tuple (t) * BTOR_RW_CACHE_WAYS) & (rwc->size - 1));
+}
+
+static BtorRwCacheTuple *
+find_rw_cache (BtorRwCache *rwc, const BtorRwCacheTuple *t)
+{
+  uint32_t i;
+  BtorRwCacheTuple *set;
+
+  if (!rwc->size) return 0;
+  set = get_set_rw_cache (rwc, t);
+  for (i = 0; i < BTOR_RW_CACHE_WAYS; i++)
+  {
+    if (set[i].kind != BTOR_INVALID_NODE
+        && !compare_rw_cache_tuple (set + i, t))
+      return set + i;
+  }
+  return 0;
+}
+
+static void
+enlarge_rw_cache (BtorRwCache *rwc)
+{
+  uint32_t i, j, old_size, new_size;
+  BtorRwCacheTuple *old_cache, *set;
+  BtorMemMgr *mm;
+
+  mm        = rwc->btor->mm;
+  old_size  = rwc->size;
+  old_cache = rwc->cache;
+  new_size  = old_size ? 2 * old_size : BTOR_RW_CACHE_INIT_SIZE;
+
+  BTOR_CNEWN (mm, rwc->cache, new_size);
+  rwc->size = new_size;
+
+  /* Note: the entries of a set are distributed over two sets of the enlarged
+   *       table, hence every entry finds a free slot. */
+  for (i = 0; i < old_size; i++)
+  {
+    if (old_cache[i].kind == BTOR_INVALID_NODE) continue;
+    set = get_set_rw_cache (rwc, old_cache + i);
+    for (j = 0; set[j].kind != BTOR_INVALID_NODE; j++)
+      assert (j + 1 < BTOR_RW_CACHE_WAYS);
+    set[j] = old_cache[i];
+  }
+  BTOR_DELETEN (mm, old_cache, old_size);
+}
+
 int32_t
 btor_rw_cache_get (BtorRwCache *rwc,
                    BtorNodeKind kind,
@@ -65,11 +172,15 @@ btor_rw_cache_get (BtorRwCache *rwc,
   }
 #endif
 
-  BtorRwCacheTuple t   = {.kind = kind, .n = {nid0, nid1, nid2}};
-  BtorPtrHashBucket *b = btor_hashptr_table_get (rwc->cache, &t);
-  if (b)
+  BtorRwCacheTuple t       = {.kind = kind, .n = {nid0, nid1, nid2}};
+  BtorRwCacheTuple *cached = find_rw_cache (rwc, &t);
+  if (cached)
   {
-    BtorRwCacheTuple *cached = b->key;
+    if (btor_opt_get (rwc->btor, BTOR_OPT_RW_CACHE_EVICT)
+        == BTOR_RW_CACHE_EVICT_LRU)
+    {
+      cached->stamp = next_stamp_rw_cache (rwc);
+    }
     return cached->result;
   }
   return 0;
@@ -96,43 +207,68 @@ btor_rw_cache_add (BtorRwCache *rwc,
   }
 #endif
 
-  /* The bruttomesso benchmark family produces extremely many distinct slice
-   * nodes that let's the cache grow to several GB in some cases. For now, we
-   * will disable caching of slice nodes until we find a better solution.
-   * Note: Calling btor_rw_cache_gc(...) does not help here. */
-  if (kind == BTOR_BV_SLICE_NODE)
-  {
-    return;
-  }
+  uint32_t i, evict, max_size;
+  BtorRwCacheTuple t = {.kind = kind, .n = {nid0, nid1, nid2}}, *set, *slot;
+
+  /* Note: Slice nodes used to be excluded from caching since the bruttomesso
+   *       benchmark family produces extremely many distinct slice nodes that
+   *       let the (unbounded) cache grow to several GB. The cache is bounded
+   *       now, hence slices are cached, too. */
 
-  int32_t cached_result_id;
-  if ((cached_result_id = btor_rw_cache_get (rwc, kind, nid0, nid1, nid2)))
+  if ((slot = find_rw_cache (rwc, &t)))
   {
     /* This can only happen if the node corresponding to cached_result_id does
      * not exist anymore (= deallocated). */
-    if (cached_result_id != result)
+    if (slot->result != result)
     {
-      assert (btor_node_get_by_id (rwc->btor, cached_result_id) == 0);
-      BtorRwCacheTuple t   = {.kind = kind, .n = {nid0, nid1, nid2}};
-      BtorPtrHashBucket *b = btor_hashptr_table_get (rwc->cache, &t);
-      assert (b);
-      BtorRwCacheTuple *cached = b->key;
-      cached->result           = result;  // Update the result
+      assert (btor_node_get_by_id (rwc->btor, slot->result) == 0);
+      slot->result = result;  // Update the result
       rwc->num_update++;
     }
     return;
   }
 
-  BtorRwCacheTuple *t;
-  BTOR_CNEW (rwc->btor->mm, t);
-  t->kind   = kind;
-  t->n[0]   = nid0;
-  t->n[1]   = nid1;
-  t->n[2]   = nid2;
-  t->result = result;
-  rwc->num_add++;
+  evict    = btor_opt_get (rwc->btor, BTOR_OPT_RW_CACHE_EVICT);
+  max_size = evict == BTOR_RW_CACHE_EVICT_NONE ? 1u << 31
+                                               : max_size_rw_cache (rwc);
 
-  btor_hashptr_table_add (rwc->cache, t);
+  if (!rwc->size || (rwc->count >= rwc->size / 2 && rwc->size < max_size))
+  {
+    enlarge_rw_cache (rwc);
+  }
+
+  for (;;)
+  {
+    set  = get_set_rw_cache (rwc, &t);
+    slot = 0;
+    for (i = 0; i < BTOR_RW_CACHE_WAYS; i++)
+    {
+      if (set[i].kind == BTOR_INVALID_NODE)
+      {
+        slot = set + i;
+        break;
+      }
+      if (!slot || set[i].stamp < slot->stamp) slot = set + i;
+    }
+    assert (slot);
+    if (slot->kind == BTOR_INVALID_NODE) break;
+    /* set is full, only enlarge if the cache is reasonably filled (else,
+     * sets of frequently colliding tuples let the cache grow quickly) */
+    if (rwc->size >= max_size
+        || (evict != BTOR_RW_CACHE_EVICT_NONE && rwc->count < rwc->size / 4))
+      break;
+    enlarge_rw_cache (rwc);
+  }
+
+  if (slot->kind == BTOR_INVALID_NODE)
+    rwc->count++;
+  else
+    rwc->num_evict++;
+
+  t.result    = result;
+  t.stamp     = next_stamp_rw_cache (rwc);
+  *slot       = t;
+  rwc->num_add++;
 
   if (rwc->num_add % 100000 == 0)
   {
@@ -144,31 +280,35 @@ void
 btor_rw_cache_init (BtorRwCache *rwc, Btor *btor)
 {
   assert (rwc);
-  rwc->btor       = btor;
-  rwc->cache      = btor_hashptr_table_new (btor->mm,
-                                       (BtorHashPtr) hash_rw_cache_tuple,
-                                       (BtorCmpPtr) compare_rw_cache_tuple);
-  rwc->num_add    = 0;
-  rwc->num_get    = 0;
-  rwc->num_update = 0;
-  rwc->num_remove = 0;
+  BTOR_CLR (rwc);
+  rwc->btor = btor;
 }
 
 void
-btor_rw_cache_delete (BtorRwCache *rwc)
+btor_rw_cache_clone (BtorRwCache *rwc, BtorRwCache *res, Btor *clone)
 {
   assert (rwc);
+  assert (res);
+  assert (clone);
 
-  BtorPtrHashTableIterator it;
-  BtorRwCacheTuple *t;
-
-  btor_iter_hashptr_init (&it, rwc->cache);
-  while (btor_iter_hashptr_has_next (&it))
+  memcpy (res, rwc, sizeof (BtorRwCache));
+  res->btor = clone;
+  if (rwc->size)
   {
-    t = btor_iter_hashptr_next (&it);
-    BTOR_DELETE (rwc->btor->mm, t);
+    BTOR_NEWN (clone->mm, res->cache, rwc->size);
+    memcpy (res->cache, rwc->cache, rwc->size * sizeof (BtorRwCacheTuple));
   }
-  btor_hashptr_table_delete (rwc->cache);
+}
+
+void
+btor_rw_cache_delete (BtorRwCache *rwc)
+{
+  assert (rwc);
+
+  if (rwc->cache) BTOR_DELETEN (rwc->btor->mm, rwc->cache, rwc->size);
+  rwc->cache = 0;
+  rwc->size  = 0;
+  rwc->count = 0;
 }
 
 void
@@ -176,64 +316,28 @@ btor_rw_cache_reset (BtorRwCache *rwc)
 {
   assert (rwc);
   assert (rwc->btor->mm);
-  assert (rwc->cache);
 
-  Btor *btor = rwc->btor;
   btor_rw_cache_delete (rwc);
-  btor_rw_cache_init (rwc, btor);
 }
 
 void
 btor_rw_cache_gc (BtorRwCache *rwc)
 {
   assert (rwc->btor->mm);
-  assert (rwc->cache);
 
-  bool remove;
-  BtorPtrHashTableIterator it;
+  uint32_t i;
   BtorRwCacheTuple *t;
-  BtorNodeKind kind;
-
-  Btor *btor            = rwc->btor;
-  BtorPtrHashTable *old = rwc->cache;
-
-  rwc->cache = btor_hashptr_table_new (btor->mm, old->hash, old->cmp);
 
-  /* We remove all cache entries that store invalid children node ids. An
-   * invalid node is either a node that does not exist anymore (deallocated) or
-   * if the node id belongs to a proxy node. Proxy nodes are never used to
-   * query the cache and are therefore useless cache entries. */
-  btor_iter_hashptr_init (&it, old);
-  while (btor_iter_hashptr_has_next (&it))
+  for (i = 0; i < rwc->size; i++)
   {
-    t = btor_iter_hashptr_next (&it);
-    kind = t->kind;
-
-    remove = !is_valid_node (btor, t->n[0]);
-
-    if (!remove && kind != BTOR_BV_SLICE_NODE)
+    t = rwc->cache + i;
+    if (t->kind == BTOR_INVALID_NODE) continue;
+    if (!is_valid_tuple (rwc->btor, t))
     {
-      if (t->n[1])
-      {
-        remove = remove || !is_valid_node (btor, t->n[1]);
-      }
-      if (!remove && t->n[2])
-      {
-        remove = remove || !is_valid_node (btor, t->n[2]);
-      }
-
-      remove = remove || !btor_node_get_by_id (btor, t->result);
-    }
-
-    if (remove)
-    {
-      BTOR_DELETE (btor->mm, t);
+      BTOR_CLR (t);
+      assert (rwc->count > 0);
+      rwc->count--;
       rwc->num_remove++;
     }
-    else
-    {
-      btor_hashptr_table_add (rwc->cache, t);
-    }
   }
-  btor_hashptr_table_delete (old);
 }
@@ -10,7 +10,6 @@
 #define BTORRWCACHE_H_INCLUDED
 
 #include "btornode.h"
-#include "utils/btorhashptr.h"
 
 /* Cache entry that stores the result of rewriting a node with kind 'kind' and
  * it's children 'n'.
@@ -18,23 +17,41 @@
  * indices. */
 struct BtorRwCacheTuple
 {
-  BtorNodeKind kind;
+  BtorNodeKind kind; /* BTOR_INVALID_NODE if entry is empty */
   int32_t n[3];
   int32_t result;
+  uint32_t stamp; /* time of last access (LRU) or insertion (FIFO) */
 };
 
 typedef struct BtorRwCacheTuple BtorRwCacheTuple;
 
+/* Number of entries per set. The cache is set-associative, a tuple is stored
+ * in one of the BTOR_RW_CACHE_WAYS consecutive entries of the set it hashes
+ * to, hence a lookup probes at most BTOR_RW_CACHE_WAYS entries. */
+#define BTOR_RW_CACHE_WAYS 8
+
 /* Stores all cache entries and some statistics. Note that the statistics are
- * not reset if btor_rw_cache_reset() or btor_rw_cache_gc() is called. */
+ * not reset if btor_rw_cache_reset() or btor_rw_cache_gc() is called.
+ *
+ * The cache grows (doubles) when it is half full, up to the capacity given by
+ * option BTOR_OPT_RW_CACHE_SIZE. If the set of a new tuple is full (and the
+ * cache is not grown), an entry of that set is evicted according to option
+ * BTOR_OPT_RW_CACHE_EVICT. */
 struct BtorRwCache
 {
   Btor *btor;
-  BtorPtrHashTable *cache;  /* Hash table of BtorRwCacheTuple. */
-  uint64_t num_add;         /* Number of cached rewrite rules. */
-  uint64_t num_get;         /* Number of cache checks. */
-  uint64_t num_update;      /* Number of updated cache entries. */
-  uint64_t num_remove;      /* Number of removed cache entries (GC). */
+  BtorRwCacheTuple *cache; /* Open-addressed table of 'size' entries. */
+  uint32_t size;           /* Number of entries (power of 2). */
+  uint32_t count;          /* Number of non-empty entries. */
+  uint32_t stamp;          /* Access counter for eviction. */
+  uint64_t num_add;        /* Number of cached rewrite rules. */
+  uint64_t num_get;        /* Number of cache checks. */
+  uint64_t num_update;     /* Number of updated cache entries. */
+  uint64_t num_remove;     /* Number of removed cache entries (GC). */
+  uint64_t num_evict;      /* Number of evicted cache entries. */
+  /* Number of cache hits/misses per node kind. */
+  uint64_t num_hits[BTOR_NUM_OPS_NODE];
+  uint64_t num_misses[BTOR_NUM_OPS_NODE];
 };
 
 typedef struct BtorRwCache BtorRwCache;
@@ -57,6 +74,9 @@ int32_t btor_rw_cache_get (BtorRwCache *cache,
 /* Initialize the rewrite cache. */
 void btor_rw_cache_init (BtorRwCache *cache, Btor *mm);
 
+/* Clone the rewrite cache 'rwc' into 'res' for the cloned instance 'clone'. */
+void btor_rw_cache_clone (BtorRwCache *rwc, BtorRwCache *res, Btor *clone);
+
 /* Delete the rewrite cache. */
 void btor_rw_cache_delete (BtorRwCache *cache);
 
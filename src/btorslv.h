@@ -24,6 +24,7 @@ enum BtorSolverKind
   BTOR_PROP_SOLVER_KIND,
   BTOR_AIGPROP_SOLVER_KIND,
   BTOR_QUANT_SOLVER_KIND,
+  BTOR_PORTFOLIO_SOLVER_KIND,
 };
 typedef enum BtorSolverKind BtorSolverKind;
 
@@ -20,6 +20,7 @@
 #include "btormodel.h"
 #include "btoropt.h"
 #include "btorprintmodel.h"
+#include "btorslvfuncube.h"
 #include "btorslvprop.h"
 #include "btorslvsls.h"
 #include "utils/btorhashint.h"
@@ -55,6 +56,11 @@ clone_fun_solver (Btor *clone, BtorFunSolver *slv, BtorNodeMap *exp_map)
   btor_clone_node_ptr_stack (
       clone->mm, &slv->cur_lemmas, &res->cur_lemmas, exp_map, false);
 
+  /* the cube-and-conquer winner is owned by 'slv' and only used to
+   * initialize the model of the original instance */
+  res->cube_winner = 0;
+  res->cube_share  = 0;
+
   if (slv->score)
   {
     h = btor_opt_get (btor, BTOR_OPT_FUN_JUST_HEURISTIC);
@@ -113,6 +119,8 @@ delete_fun_solver (BtorFunSolver *slv)
 
   btor = slv->btor;
 
+  if (slv->cube_winner) btor_delete (slv->cube_winner);
+
   btor_iter_hashptr_init (&it, slv->lemmas);
   while (btor_iter_hashptr_has_next (&it))
     btor_node_release (btor, btor_iter_hashptr_next (&it));
@@ -2421,11 +2429,17 @@ sat_fun_solver (BtorFunSolver *slv)
   BtorNode *clone_root, *lemma;
   BtorNodeMap *exp_map;
   BtorIntHashTable *init_apps_cache;
-  BtorNodePtrStack init_apps;
+  BtorNodePtrStack init_apps, imported;
 
   btor = slv->btor;
   assert (!btor->inconsistent);
 
+  if (slv->cube_winner)
+  {
+    btor_delete (slv->cube_winner);
+    slv->cube_winner = 0;
+  }
+
   /* make initial applies in bv skeleton global in order to prevent
    * traversing the whole formula every refinement round */
   BTOR_INIT_STACK (btor->mm, init_apps);
@@ -2487,6 +2501,8 @@ sat_fun_solver (BtorFunSolver *slv)
     goto DONE;
   }
 
+  if (btor_fun_cube_sat (slv, &result)) goto DONE;
+
   configure_sat_mgr (btor);
 
   if (slv->assume_lemmas) reset_lemma_cache (slv);
@@ -2508,6 +2524,24 @@ sat_fun_solver (BtorFunSolver *slv)
       goto UNKNOWN;
     }
 
+    /* add lemmas generated by other cube-and-conquer workers */
+    if (slv->cube_share)
+    {
+      BTOR_INIT_STACK (btor->mm, imported);
+      btor_fun_cube_import_lemmas (slv, &imported);
+      for (i = 0; i < BTOR_COUNT_STACK (imported); i++)
+      {
+        lemma = BTOR_PEEK_STACK (imported, i);
+        btor_insert_unsynthesized_constraint (btor, lemma);
+        if (clone)
+          add_lemma_to_dual_prop_clone (
+              btor, clone, &clone_root, lemma, exp_map);
+        btor_node_release (btor, lemma);
+      }
+      BTOR_RELEASE_STACK (imported);
+      if (btor->inconsistent) goto UNSAT;
+    }
+
     btor_process_unsynthesized_constraints (btor);
     if (btor->found_constraint_false)
     {
@@ -2555,6 +2589,7 @@ sat_fun_solver (BtorFunSolver *slv)
       if (clone)
         add_lemma_to_dual_prop_clone (btor, clone, &clone_root, lemma, exp_map);
     }
+    if (slv->cube_share) btor_fun_cube_export_lemmas (slv);
     BTOR_RESET_STACK (slv->cur_lemmas);
 
     if (btor_opt_get (btor, BTOR_OPT_VERBOSITY))
@@ -2602,6 +2637,12 @@ generate_model_fun_solver (BtorFunSolver *slv,
 
   (void) reset;
 
+  if (slv->cube_winner)
+  {
+    btor_model_import (slv->btor, slv->cube_winner, model_for_all_nodes);
+    return;
+  }
+
   /* already created during check_and_resolve_conflicts */
   if (!slv->btor->bv_model)
     btor_model_init_bv (slv->btor, &slv->btor->bv_model);
@@ -2668,6 +2709,20 @@ print_stats_fun_solver (BtorFunSolver *slv)
     }
   }
 
+  if (slv->stats.cube_runs)
+  {
+    BTOR_MSG (btor->msg, 1, "");
+    BTOR_MSG (btor->msg, 1, "cube-and-conquer statistics:");
+    BTOR_MSG (btor->msg, 1, "%4u cube-and-conquer runs", slv->stats.cube_runs);
+    BTOR_MSG (btor->msg, 1, "%4u cubes solved", slv->stats.cubes);
+    BTOR_MSG (btor->msg, 1, "  %4u cubes refuted", slv->stats.cubes_unsat);
+    BTOR_MSG (btor->msg, 1, "%4u lemmas shared", slv->stats.lemmas_exported);
+    BTOR_MSG (btor->msg,
+              1,
+              "%4u shared lemmas imported",
+              slv->stats.lemmas_imported);
+  }
+
   BTOR_MSG (btor->msg, 1, "");
   BTOR_MSG (
       btor->msg, 1, "%7lld expression evaluations", slv->stats.eval_exp_calls);
@@ -2781,6 +2836,17 @@ print_time_stats_fun_solver (BtorFunSolver *slv)
             slv->time.prop_cleanup);
 
   BTOR_MSG (btor->msg, 1, "%.2f seconds in pure SAT solving", slv->time.sat);
+  if (slv->stats.cube_runs)
+  {
+    BTOR_MSG (btor->msg,
+              1,
+              "%.2f seconds cloning cube-and-conquer workers",
+              slv->time.cube_clone);
+    BTOR_MSG (btor->msg,
+              1,
+              "%.2f seconds cube-and-conquer (wall clock)",
+              slv->time.cube);
+  }
   BTOR_MSG (btor->msg, 1, "");
 }
 
@@ -30,6 +30,12 @@ struct BtorFunSolver
   int32_t sat_limit;
   bool assume_lemmas;
 
+  /* cube-and-conquer mode, see btorslvfuncube.h */
+  Btor *cube_winner; /* worker clone that determined 'sat' */
+  struct BtorFunCubeShare *cube_share; /* lemma pool (cube workers only) */
+  uint32_t cube_worker;                /* worker id (cube workers only) */
+  uint32_t cube_imported; /* number of lemma pool entries processed */
+
   struct
   {
     uint32_t lod_refinements; /* number of lemmas on demand refinements */
@@ -54,6 +60,12 @@ struct BtorFunSolver
     uint_least64_t eval_exp_calls;
     uint_least64_t propagations;
     uint_least64_t propagations_down;
+
+    uint32_t cube_runs;       /* number of cube-and-conquer sat calls */
+    uint32_t cubes;           /* number of cubes solved */
+    uint32_t cubes_unsat;     /* number of cubes refuted */
+    uint32_t lemmas_exported; /* number of lemmas shared with other cubes */
+    uint32_t lemmas_imported; /* number of lemmas from other cubes */
   } stats;
 
   struct
@@ -76,6 +88,8 @@ struct BtorFunSolver
     double find_conf_app;
     double check_extensionality;
     double prop_cleanup;
+    double cube_clone;
+    double cube;
   } time;
 };
 
@@ -0,0 +1,724 @@
+/*  Boolector: Satisfiability Modulo Theories (SMT) solver.
+ *
+ *  Copyright (C) 2020 Aina Niemetz.
+ *  Copyright (C) 2020 Mathias Preiner.
+ *
+ *  This file is part of Boolector.
+ *  See COPYING for more information on using this software.
+ */
+
+#include "btorslvfuncube.h"
+
+#include "btorbv.h"
+#include "btorclone.h"
+#include "btorcore.h"
+#include "btorexp.h"
+#include "btornode.h"
+#include "btoropt.h"
+#include "btorsat.h"
+#include "utils/btorhashint.h"
+#include "utils/btorhashptr.h"
+#include "utils/btorstack.h"
+#include "utils/btorutil.h"
+
+#include <unistd.h>
+
+#ifdef BTOR_HAVE_PTHREADS
+#include <pthread.h>
+#endif
+
+/*------------------------------------------------------------------------*/
+
+/* A node of a shared lemma.  Nodes of the formula the workers were cloned
+ * from have the same id in all workers and are referenced by id, nodes
+ * created by a worker are rebuilt from their kind and children. */
+struct BtorFunCubeNode
+{
+  BtorNodeKind kind; /* BTOR_INVALID_NODE: reference to node 'id' */
+  int32_t id;
+  uint32_t arity;
+  int32_t e[3]; /* children, index + 1 in lemma nodes (< 0: inverted) */
+  uint32_t upper, lower; /* slice indices */
+  BtorBitVector *bits;   /* constant bits */
+};
+
+typedef struct BtorFunCubeNode BtorFunCubeNode;
+
+BTOR_DECLARE_STACK (BtorFunCubeNode, BtorFunCubeNode);
+
+struct BtorFunCubeLemma
+{
+  uint32_t worker; /* the worker that generated this lemma */
+  int32_t root;    /* index + 1 of the lemma in 'nodes' (< 0: inverted) */
+  uint32_t nnodes;
+  BtorFunCubeNode *nodes; /* in topological order */
+};
+
+typedef struct BtorFunCubeLemma BtorFunCubeLemma;
+
+BTOR_DECLARE_STACK (BtorFunCubeLemmaPtr, BtorFunCubeLemma *);
+
+struct BtorFunCubeShare
+{
+  BtorMemMgr *mm; /* memory of the lemma pool */
+  int32_t nids;   /* nodes with id < nids are shared by all workers */
+  BtorFunCubeLemmaPtrStack lemmas; /* lemma pool */
+
+  BtorIntStack bit_ids; /* ids of the variables to split on */
+  BtorUIntStack bits;   /* bit indices of the variables to split on */
+  uint32_t ncubes;
+  uint32_t next_cube; /* next cube to be solved */
+  uint32_t nunsat;    /* number of refuted cubes */
+  bool done;          /* 'sat' cube found or formula refuted */
+  bool unsat;         /* formula refuted independently of cubes */
+
+#ifdef BTOR_HAVE_PTHREADS
+  pthread_mutex_t mutex; /* protects all of the above */
+#endif
+};
+
+struct BtorFunCubeWorker
+{
+  Btor *btor;  /* the original instance */
+  Btor *clone; /* the instance this worker solves cubes on */
+  BtorFunCubeShare *share;
+  BtorNodePtrStack vars; /* variables to split on (in 'clone') */
+  BtorSolverResult result;
+  uint32_t cubes;
+  uint32_t cubes_unsat;
+};
+
+typedef struct BtorFunCubeWorker BtorFunCubeWorker;
+
+/*------------------------------------------------------------------------*/
+
+static void
+lock_share (BtorFunCubeShare *share)
+{
+#ifdef BTOR_HAVE_PTHREADS
+  pthread_mutex_lock (&share->mutex);
+#else
+  (void) share;
+#endif
+}
+
+static void
+unlock_share (BtorFunCubeShare *share)
+{
+#ifdef BTOR_HAVE_PTHREADS
+  pthread_mutex_unlock (&share->mutex);
+#else
+  (void) share;
+#endif
+}
+
+/*------------------------------------------------------------------------*/
+
+static int32_t
+compare_cube_vars (const void *p1, const void *p2)
+{
+  BtorNode *a, *b;
+
+  a = *((BtorNode **) p1);
+  b = *((BtorNode **) p2);
+  /* more parents first, ties are broken by id for reproducibility */
+  if (a->parents != b->parents) return a->parents > b->parents ? -1 : 1;
+  return a->id - b->id;
+}
+
+/* Select (at most) 'k' bits of the input variables to split on.  Variables
+ * with many parents are preferred and bits are picked round-robin from the
+ * most significant bit downwards such that the cubes are spread over the
+ * most relevant inputs. */
+static void
+select_cube_bits (Btor *btor, uint32_t k, BtorFunCubeShare *share)
+{
+  uint32_t i, j, w;
+  bool added;
+  BtorNode *var;
+  BtorNodePtrStack vars;
+  BtorIntHashTable *cache;
+  BtorPtrHashTableIterator it;
+
+  BTOR_INIT_STACK (btor->mm, vars);
+  cache = btor_hashint_table_new (btor->mm);
+
+  btor_iter_hashptr_init (&it, btor->bv_vars);
+  while (btor_iter_hashptr_has_next (&it))
+  {
+    var = btor_node_real_addr (
+        btor_node_get_simplified (btor, btor_iter_hashptr_next (&it)));
+    if (!btor_node_is_bv_var (var) || !var->parents
+        || btor_hashint_table_contains (cache, var->id))
+      continue;
+    btor_hashint_table_add (cache, var->id);
+    BTOR_PUSH_STACK (vars, var);
+  }
+  qsort (vars.start,
+         BTOR_COUNT_STACK (vars),
+         sizeof (BtorNode *),
+         compare_cube_vars);
+
+  for (i = 0, added = true; added && BTOR_COUNT_STACK (share->bits) < k; i++)
+  {
+    added = false;
+    for (j = 0; j < BTOR_COUNT_STACK (vars); j++)
+    {
+      if (BTOR_COUNT_STACK (share->bits) == k) break;
+      var = BTOR_PEEK_STACK (vars, j);
+      w   = btor_node_bv_get_width (btor, var);
+      if (i >= w) continue;
+      BTOR_PUSH_STACK (share->bit_ids, var->id);
+      BTOR_PUSH_STACK (share->bits, w - 1 - i);
+      added = true;
+    }
+  }
+
+  btor_hashint_table_delete (cache);
+  BTOR_RELEASE_STACK (vars);
+}
+
+/*------------------------------------------------------------------------*/
+
+static bool
+is_shareable_kind (BtorNodeKind kind)
+{
+  switch (kind)
+  {
+    case BTOR_BV_CONST_NODE:
+    case BTOR_BV_SLICE_NODE:
+    case BTOR_BV_AND_NODE:
+    case BTOR_BV_EQ_NODE:
+    case BTOR_FUN_EQ_NODE:
+    case BTOR_BV_ADD_NODE:
+    case BTOR_BV_MUL_NODE:
+    case BTOR_BV_ULT_NODE:
+    case BTOR_BV_SLL_NODE:
+    case BTOR_BV_SRL_NODE:
+    case BTOR_BV_UDIV_NODE:
+    case BTOR_BV_UREM_NODE:
+    case BTOR_BV_CONCAT_NODE:
+    case BTOR_APPLY_NODE:
+    case BTOR_COND_NODE:
+    case BTOR_ARGS_NODE:
+    case BTOR_UPDATE_NODE: return true;
+    /* variables, parameters, lambdas and quantifiers created by a worker
+     * can not be shared */
+    default: return false;
+  }
+}
+
+static int32_t
+node_ref (BtorIntHashTable *map, BtorNode *exp)
+{
+  int32_t idx;
+
+  idx = btor_hashint_map_get (map, btor_node_real_addr (exp)->id)->as_int;
+  assert (idx > 0);
+  return btor_node_is_inverted (exp) ? -idx : idx;
+}
+
+/* Serialize 'lemma' into the lemma pool (called with the lock held).
+ * Lemmas that contain nodes that can not be rebuilt are skipped. */
+static bool
+export_lemma (BtorFunSolver *slv, BtorNode *lemma)
+{
+  bool res;
+  uint32_t i;
+  Btor *btor;
+  BtorFunCubeShare *share;
+  BtorFunCubeNode n;
+  BtorFunCubeNodeStack nodes;
+  BtorFunCubeLemma *l;
+  BtorNode *cur;
+  BtorNodePtrStack visit;
+  BtorIntHashTable *map;
+  BtorHashTableData *d;
+
+  btor  = slv->btor;
+  share = slv->cube_share;
+  res   = true;
+
+  BTOR_INIT_STACK (btor->mm, visit);
+  BTOR_INIT_STACK (share->mm, nodes);
+  map = btor_hashint_map_new (btor->mm);
+
+  BTOR_PUSH_STACK (visit, lemma);
+  while (!BTOR_EMPTY_STACK (visit))
+  {
+    cur = btor_node_real_addr (BTOR_POP_STACK (visit));
+    d   = btor_hashint_map_get (map, cur->id);
+
+    if (!d)
+    {
+      if (cur->id < share->nids)
+      {
+        BTOR_CLR (&n);
+        n.kind = BTOR_INVALID_NODE;
+        n.id   = cur->id;
+        BTOR_PUSH_STACK (nodes, n);
+        d         = btor_hashint_map_add (map, cur->id);
+        d->as_int = BTOR_COUNT_STACK (nodes);
+        continue;
+      }
+      if (!is_shareable_kind (cur->kind))
+      {
+        res = false;
+        break;
+      }
+      btor_hashint_map_add (map, cur->id)->as_int = 0;
+      BTOR_PUSH_STACK (visit, cur);
+      for (i = 0; i < cur->arity; i++) BTOR_PUSH_STACK (visit, cur->e[i]);
+    }
+    else if (d->as_int == 0)
+    {
+      BTOR_CLR (&n);
+      n.kind  = cur->kind;
+      n.arity = cur->arity;
+      for (i = 0; i < cur->arity; i++) n.e[i] = node_ref (map, cur->e[i]);
+      if (btor_node_is_bv_const (cur))
+        n.bits = btor_bv_copy (share->mm, btor_node_bv_const_get_bits (cur));
+      else if (btor_node_is_bv_slice (cur))
+      {
+        n.upper = btor_node_bv_slice_get_upper (cur);
+        n.lower = btor_node_bv_slice_get_lower (cur);
+      }
+      BTOR_PUSH_STACK (nodes, n);
+      btor_hashint_map_get (map, cur->id)->as_int = BTOR_COUNT_STACK (nodes);
+    }
+  }
+
+  if (res)
+  {
+    BTOR_NEW (share->mm, l);
+    l->worker = slv->cube_worker;
+    l->root   = node_ref (map, lemma);
+    l->nnodes = BTOR_COUNT_STACK (nodes);
+    BTOR_NEWN (share->mm, l->nodes, l->nnodes);
+    memcpy (l->nodes, nodes.start, l->nnodes * sizeof (BtorFunCubeNode));
+    BTOR_PUSH_STACK (share->lemmas, l);
+  }
+  else
+  {
+    for (i = 0; i < BTOR_COUNT_STACK (nodes); i++)
+      if (nodes.start[i].bits) btor_bv_free (share->mm, nodes.start[i].bits);
+  }
+
+  btor_hashint_map_delete (map);
+  BTOR_RELEASE_STACK (nodes);
+  BTOR_RELEASE_STACK (visit);
+  return res;
+}
+
+void
+btor_fun_cube_export_lemmas (BtorFunSolver *slv)
+{
+  assert (slv);
+  assert (slv->cube_share);
+
+  uint32_t i;
+  BtorFunCubeShare *share;
+
+  share = slv->cube_share;
+
+  lock_share (share);
+  for (i = 0; i < BTOR_COUNT_STACK (slv->cur_lemmas); i++)
+  {
+    if (export_lemma (slv, BTOR_PEEK_STACK (slv->cur_lemmas, i)))
+      slv->stats.lemmas_exported += 1;
+  }
+  unlock_share (share);
+}
+
+static BtorNode *
+get_lemma_node (BtorNodePtrStack *nodes, int32_t ref)
+{
+  BtorNode *res;
+
+  assert (ref != 0);
+  res = BTOR_PEEK_STACK (*nodes, abs (ref) - 1);
+  return ref < 0 ? btor_node_invert (res) : res;
+}
+
+/* Rebuild a lemma of another worker, returns 0 if a node of the formula
+ * the lemma refers to does not exist anymore in this worker. */
+static BtorNode *
+import_lemma (Btor *btor, BtorFunCubeLemma *l)
+{
+  uint32_t i, j;
+  BtorNode *res, *exp, *e[3];
+  BtorNodePtrStack nodes;
+  BtorFunCubeNode *n;
+
+  res = 0;
+  BTOR_INIT_STACK (btor->mm, nodes);
+
+  for (i = 0; i < l->nnodes; i++)
+  {
+    n = &l->nodes[i];
+    if (n->kind == BTOR_INVALID_NODE)
+    {
+      if (!(exp = btor_node_get_by_id (btor, n->id))) goto DONE;
+      exp = btor_node_copy (btor, btor_node_get_simplified (btor, exp));
+    }
+    else
+    {
+      for (j = 0; j < n->arity; j++) e[j] = get_lemma_node (&nodes, n->e[j]);
+      if (n->kind == BTOR_BV_CONST_NODE)
+        exp = btor_exp_bv_const (btor, n->bits);
+      else if (n->kind == BTOR_BV_SLICE_NODE)
+        exp = btor_exp_bv_slice (btor, e[0], n->upper, n->lower);
+      else
+        exp = btor_exp_create (btor, n->kind, e, n->arity);
+    }
+    BTOR_PUSH_STACK (nodes, exp);
+  }
+  res = btor_node_copy (btor, get_lemma_node (&nodes, l->root));
+  assert (btor_node_bv_get_width (btor, res) == 1);
+
+DONE:
+  while (!BTOR_EMPTY_STACK (nodes))
+    btor_node_release (btor, BTOR_POP_STACK (nodes));
+  BTOR_RELEASE_STACK (nodes);
+  return res;
+}
+
+void
+btor_fun_cube_import_lemmas (BtorFunSolver *slv, BtorNodePtrStack *lemmas)
+{
+  assert (slv);
+  assert (slv->cube_share);
+  assert (lemmas);
+
+  uint32_t i;
+  BtorFunCubeShare *share;
+  BtorFunCubeLemma *l;
+  BtorNode *lemma;
+  BtorVoidPtrStack pool;
+
+  share = slv->cube_share;
+
+  /* lemmas in the pool are not modified once added, only the pool itself
+   * needs to be accessed with the lock held */
+  BTOR_INIT_STACK (slv->btor->mm, pool);
+  lock_share (share);
+  for (i = slv->cube_imported; i < BTOR_COUNT_STACK (share->lemmas); i++)
+  {
+    l = BTOR_PEEK_STACK (share->lemmas, i);
+    if (l->worker != slv->cube_worker) BTOR_PUSH_STACK (pool, l);
+  }
+  slv->cube_imported = BTOR_COUNT_STACK (share->lemmas);
+  unlock_share (share);
+
+  for (i = 0; i < BTOR_COUNT_STACK (pool); i++)
+  {
+    lemma = import_lemma (slv->btor, BTOR_PEEK_STACK (pool, i));
+    if (!lemma) continue;
+    BTOR_PUSH_STACK (*lemmas, lemma);
+    slv->stats.lemmas_imported += 1;
+  }
+  BTOR_RELEASE_STACK (pool);
+}
+
+/*------------------------------------------------------------------------*/
+
+static int32_t
+terminate_cube_worker (void *state)
+{
+  BtorFunCubeWorker *worker = (BtorFunCubeWorker *) state;
+  return worker->share->done || btor_terminate (worker->btor);
+}
+
+/* Assume the literals of 'cube' in the clone of 'worker'. */
+static void
+assume_cube (BtorFunCubeWorker *worker, uint32_t cube)
+{
+  uint32_t i, bit;
+  Btor *clone;
+  BtorNode *var, *lit, *tmp;
+
+  clone = worker->clone;
+  for (i = 0; i < BTOR_COUNT_STACK (worker->vars); i++)
+  {
+    var = BTOR_PEEK_STACK (worker->vars, i);
+    bit = BTOR_PEEK_STACK (worker->share->bits, i);
+    lit = btor_exp_bv_slice (clone, var, bit, bit);
+    if (!((cube >> i) & 1))
+    {
+      tmp = btor_exp_bv_not (clone, lit);
+      btor_node_release (clone, lit);
+      lit = tmp;
+    }
+    btor_assume_exp (clone, lit);
+    btor_node_release (clone, lit);
+  }
+}
+
+static void *
+run_cube_worker (void *state)
+{
+  uint32_t cube;
+  BtorSolverResult res;
+  BtorFunCubeWorker *worker;
+  BtorFunCubeShare *share;
+
+  worker = (BtorFunCubeWorker *) state;
+  share  = worker->share;
+
+  while (true)
+  {
+    lock_share (share);
+    if (share->done || share->next_cube >= share->ncubes)
+    {
+      unlock_share (share);
+      break;
+    }
+    cube = share->next_cube++;
+    unlock_share (share);
+
+    assume_cube (worker, cube);
+    res = btor_check_sat (worker->clone, -1, -1);
+    worker->cubes += 1;
+
+    lock_share (share);
+    if (res == BTOR_RESULT_SAT && !share->done)
+    {
+      share->done    = true;
+      worker->result = BTOR_RESULT_SAT;
+    }
+    else if (res == BTOR_RESULT_UNSAT)
+    {
+      share->nunsat += 1;
+      worker->cubes_unsat += 1;
+      /* the formula itself (including lemmas) is unsatisfiable */
+      if (worker->clone->inconsistent) share->done = share->unsat = true;
+    }
+    unlock_share (share);
+
+    /* terminated or limit reached */
+    if (res != BTOR_RESULT_UNSAT) break;
+  }
+  return 0;
+}
+
+static void
+init_cube_worker (BtorFunSolver *slv,
+                  BtorFunCubeWorker *worker,
+                  BtorFunCubeShare *share,
+                  uint32_t id)
+{
+  uint32_t i;
+  Btor *btor, *clone;
+  BtorFunSolver *cslv;
+  BtorNode *var;
+  double start;
+
+  btor  = slv->btor;
+  start = btor_util_time_stamp ();
+
+  BTOR_CLR (worker);
+  worker->btor   = btor;
+  worker->share  = share;
+  worker->result = BTOR_RESULT_UNKNOWN;
+
+  clone = btor_clone_btor (btor);
+  btor_opt_set (clone, BTOR_OPT_FUN_CUBE, 0);
+  /* cubes are solved incrementally via assumptions, the formula was already
+   * simplified (including unconstrained optimization) in 'btor' */
+  btor_opt_set (clone, BTOR_OPT_UCOPT, 0);
+  if (!btor_opt_get (clone, BTOR_OPT_INCREMENTAL))
+    btor_opt_set (clone, BTOR_OPT_INCREMENTAL, 1);
+  btor_opt_set (clone, BTOR_OPT_VERBOSITY, 0);
+  btor_set_term (clone, terminate_cube_worker, worker);
+  worker->clone = clone;
+
+  assert (clone->slv);
+  assert (clone->slv->kind == BTOR_FUN_SOLVER_KIND);
+  cslv                        = BTOR_FUN_SOLVER (clone);
+  cslv->cube_share            = share;
+  cslv->cube_worker           = id;
+  cslv->cube_imported         = 0;
+  cslv->stats.lemmas_exported = 0;
+  cslv->stats.lemmas_imported = 0;
+
+  /* keep the variables to split on alive (they may get substituted by
+   * shared lemmas) */
+  BTOR_INIT_STACK (clone->mm, worker->vars);
+  for (i = 0; i < BTOR_COUNT_STACK (share->bit_ids); i++)
+  {
+    var = btor_node_get_by_id (clone, BTOR_PEEK_STACK (share->bit_ids, i));
+    assert (var);
+    BTOR_PUSH_STACK (worker->vars, btor_node_copy (clone, var));
+  }
+
+  slv->time.cube_clone += btor_util_time_stamp () - start;
+}
+
+static void
+release_cube_worker (BtorFunCubeWorker *worker)
+{
+  BtorFunSolver *cslv;
+
+  while (!BTOR_EMPTY_STACK (worker->vars))
+    btor_node_release (worker->clone, BTOR_POP_STACK (worker->vars));
+  BTOR_RELEASE_STACK (worker->vars);
+
+  /* the share and the worker are released after solving */
+  cslv             = BTOR_FUN_SOLVER (worker->clone);
+  cslv->cube_share = 0;
+  btor_set_term (worker->clone, 0, 0);
+}
+
+static void
+delete_share (BtorFunCubeShare *share)
+{
+  uint32_t i, j;
+  BtorMemMgr *mm;
+  BtorFunCubeLemma *l;
+
+  mm = share->mm;
+  for (i = 0; i < BTOR_COUNT_STACK (share->lemmas); i++)
+  {
+    l = BTOR_PEEK_STACK (share->lemmas, i);
+    for (j = 0; j < l->nnodes; j++)
+      if (l->nodes[j].bits) btor_bv_free (mm, l->nodes[j].bits);
+    BTOR_DELETEN (mm, l->nodes, l->nnodes);
+    BTOR_DELETE (mm, l);
+  }
+  BTOR_RELEASE_STACK (share->lemmas);
+  BTOR_RELEASE_STACK (share->bit_ids);
+  BTOR_RELEASE_STACK (share->bits);
+#ifdef BTOR_HAVE_PTHREADS
+  pthread_mutex_destroy (&share->mutex);
+#endif
+  BTOR_DELETE (mm, share);
+  btor_mem_mgr_delete (mm);
+}
+
+/*------------------------------------------------------------------------*/
+
+bool
+btor_fun_cube_sat (BtorFunSolver *slv, BtorSolverResult *result)
+{
+  assert (slv);
+  assert (slv->kind == BTOR_FUN_SOLVER_KIND);
+  assert (result);
+
+  uint32_t i, k, nworkers, nlemmas;
+  double start;
+  BtorMemMgr *mm;
+  BtorSATMgr *smgr;
+  Btor *btor;
+  BtorFunSolver *cslv;
+  BtorFunCubeShare *share;
+  BtorFunCubeWorker *workers, *worker;
+#ifdef BTOR_HAVE_PTHREADS
+  pthread_t *threads;
+#endif
+
+  btor = slv->btor;
+  k    = btor_opt_get (btor, BTOR_OPT_FUN_CUBE);
+  smgr = btor_get_sat_mgr (btor);
+
+  /* workers are cloned from the current instance, cubes are assumptions */
+  if (!k || slv->cube_share || btor->assumptions->count > 0
+      || btor_opt_get (btor, BTOR_OPT_PRINT_DIMACS)
+      || (btor_sat_is_initialized (smgr)
+          && !btor_sat_mgr_has_clone_support (smgr)))
+    return false;
+
+  mm = btor_mem_mgr_new ();
+  BTOR_CNEW (mm, share);
+  share->mm = mm;
+  BTOR_INIT_STACK (mm, share->lemmas);
+  BTOR_INIT_STACK (mm, share->bit_ids);
+  BTOR_INIT_STACK (mm, share->bits);
+#ifdef BTOR_HAVE_PTHREADS
+  pthread_mutex_init (&share->mutex, 0);
+#endif
+
+  select_cube_bits (btor, k, share);
+  if (BTOR_EMPTY_STACK (share->bits))
+  {
+    BTOR_MSG (btor->msg, 1, "no input bits to split on, disable cubing");
+    delete_share (share);
+    return false;
+  }
+
+  start         = btor_util_current_time ();
+  k             = BTOR_COUNT_STACK (share->bits);
+  share->ncubes = 1u << k;
+  share->nids   = BTOR_COUNT_STACK (btor->nodes_id_table);
+
+  nworkers = btor_opt_get (btor, BTOR_OPT_FUN_CUBE_THREADS);
+#ifdef BTOR_HAVE_PTHREADS
+  if (!nworkers) nworkers = sysconf (_SC_NPROCESSORS_ONLN);
+  if (nworkers < 1) nworkers = 1;
+  if (nworkers > share->ncubes) nworkers = share->ncubes;
+#else
+  /* without thread support all cubes are solved one after the other */
+  nworkers = 1;
+#endif
+
+  BTOR_MSG (btor->msg,
+            1,
+            "cube-and-conquer: %u cubes on %u input bit(s), %u worker(s)",
+            share->ncubes,
+            k,
+            nworkers);
+
+  BTOR_CNEWN (btor->mm, workers, nworkers);
+  for (i = 0; i < nworkers; i++) init_cube_worker (slv, &workers[i], share, i);
+
+#ifdef BTOR_HAVE_PTHREADS
+  BTOR_NEWN (btor->mm, threads, nworkers);
+  for (i = 0; i < nworkers; i++)
+    pthread_create (&threads[i], 0, run_cube_worker, &workers[i]);
+  for (i = 0; i < nworkers; i++) pthread_join (threads[i], 0);
+  BTOR_DELETEN (btor->mm, threads, nworkers);
+#else
+  run_cube_worker (&workers[0]);
+#endif
+
+  if (share->unsat || share->nunsat == share->ncubes)
+    *result = BTOR_RESULT_UNSAT;
+  else if (share->done)
+    *result = BTOR_RESULT_SAT;
+  else
+    *result = BTOR_RESULT_UNKNOWN;
+
+  nlemmas = BTOR_COUNT_STACK (share->lemmas);
+  slv->stats.cube_runs += 1;
+  for (i = 0; i < nworkers; i++)
+  {
+    worker = &workers[i];
+    cslv   = BTOR_FUN_SOLVER (worker->clone);
+    slv->stats.cubes += worker->cubes;
+    slv->stats.cubes_unsat += worker->cubes_unsat;
+    slv->stats.lemmas_exported += cslv->stats.lemmas_exported;
+    slv->stats.lemmas_imported += cslv->stats.lemmas_imported;
+    release_cube_worker (worker);
+    if (worker->result == BTOR_RESULT_SAT && *result == BTOR_RESULT_SAT)
+    {
+      assert (!slv->cube_winner);
+      slv->cube_winner = worker->clone;
+    }
+    else
+      btor_delete (worker->clone);
+  }
+  BTOR_DELETEN (btor->mm, workers, nworkers);
+  delete_share (share);
+
+  slv->time.cube += btor_util_current_time () - start;
+
+  BTOR_MSG (btor->msg,
+            1,
+            "cube-and-conquer determined %s in %.2f seconds, "
+            "%u lemma(s) shared",
+            *result == BTOR_RESULT_SAT
+                ? "'sat'"
+                : (*result == BTOR_RESULT_UNSAT ? "'unsat'" : "'unknown'"),
+            btor_util_current_time () - start,
+            nlemmas);
+  return true;
+}
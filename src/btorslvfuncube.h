@@ -0,0 +1,47 @@
+/*  Boolector: Satisfiability Modulo Theories (SMT) solver.
+ *
+ *  Copyright (C) 2020 Aina Niemetz.
+ *  Copyright (C) 2020 Mathias Preiner.
+ *
+ *  This file is part of Boolector.
+ *  See COPYING for more information on using this software.
+ */
+
+#ifndef BTORSLVFUNCUBE_H_INCLUDED
+#define BTORSLVFUNCUBE_H_INCLUDED
+
+#include <stdbool.h>
+
+#include "btorslvfun.h"
+
+/*------------------------------------------------------------------------*/
+
+/**
+ * Cube-and-conquer mode of the function solver engine (BTOR_OPT_FUN_CUBE).
+ *
+ * The current formula is split into 2^k cubes by assuming all combinations
+ * of values for k selected input bits.  Each worker thread solves cubes on
+ * its own clone of the current (simplified) instance, one after the other
+ * via assumptions, i.e., the SAT solver of a worker is reused incrementally
+ * for all its cubes.  Lemmas generated by the lemmas on demand loop of a
+ * worker are independent of the cube and shared with all other workers via
+ * a common lemma pool.
+ */
+
+typedef struct BtorFunCubeShare BtorFunCubeShare;
+
+/* Determine satisfiability of the formula of 'slv' in cube-and-conquer mode.
+ * Returns false if cube-and-conquer mode is not applicable (e.g., if
+ * assumptions are present), in which case 'result' is not set. */
+bool btor_fun_cube_sat (BtorFunSolver *slv, BtorSolverResult *result);
+
+/* Add the lemmas in 'slv->cur_lemmas' to the lemma pool of a worker. */
+void btor_fun_cube_export_lemmas (BtorFunSolver *slv);
+
+/* Rebuild lemmas added to the lemma pool by other workers since the last
+ * call and push them onto 'lemmas' (the caller takes ownership). */
+void btor_fun_cube_import_lemmas (BtorFunSolver *slv, BtorNodePtrStack *lemmas);
+
+/*------------------------------------------------------------------------*/
+
+#endif
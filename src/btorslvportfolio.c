@@ -0,0 +1,389 @@
+/*  Boolector: Satisfiability Modulo Theories (SMT) solver.
+ *
+ *  Copyright (C) 2020 Aina Niemetz.
+ *  Copyright (C) 2020 Mathias Preiner.
+ *
+ *  This file is part of Boolector.
+ *  See COPYING for more information on using this software.
+ */
+
+#include "btorslvportfolio.h"
+
+#include "btorabort.h"
+#include "btorclone.h"
+#include "btorcore.h"
+#include "btormodel.h"
+#include "btornode.h"
+#include "btoropt.h"
+#include "btorprintmodel.h"
+#include "utils/btorutil.h"
+
+#ifdef BTOR_HAVE_PTHREADS
+#include <pthread.h>
+#endif
+
+/*------------------------------------------------------------------------*/
+
+struct BtorPortfolioWorker
+{
+  Btor *btor;  /* the original instance */
+  Btor *clone; /* the instance this worker solves */
+  BtorOptEngine engine;
+  BtorSolverResult result;
+  double time;
+
+  bool *found_result;
+#ifdef BTOR_HAVE_PTHREADS
+  pthread_mutex_t *found_result_mutex;
+#endif
+};
+
+typedef struct BtorPortfolioWorker BtorPortfolioWorker;
+
+/*------------------------------------------------------------------------*/
+
+static const char *
+engine_name (BtorOptEngine engine)
+{
+  switch (engine)
+  {
+    case BTOR_ENGINE_SLS: return "sls";
+    case BTOR_ENGINE_PROP: return "prop";
+    case BTOR_ENGINE_AIGPROP: return "aigprop";
+    default: assert (engine == BTOR_ENGINE_FUN); return "fun";
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
+static BtorPortfolioSolver *
+clone_portfolio_solver (Btor *clone,
+                        BtorPortfolioSolver *slv,
+                        BtorNodeMap *exp_map)
+{
+  assert (clone);
+  assert (slv);
+  assert (slv->kind == BTOR_PORTFOLIO_SOLVER_KIND);
+
+  (void) exp_map;
+
+  BtorPortfolioSolver *res;
+
+  BTOR_NEW (clone->mm, res);
+  memcpy (res, slv, sizeof (BtorPortfolioSolver));
+  res->btor = clone;
+  /* the winner clone is owned by 'slv' and its model is only used to
+   * initialize the model of the original instance */
+  res->winner = 0;
+  return res;
+}
+
+static void
+delete_portfolio_solver (BtorPortfolioSolver *slv)
+{
+  assert (slv);
+  assert (slv->kind == BTOR_PORTFOLIO_SOLVER_KIND);
+  assert (slv->btor);
+  assert (slv->btor->slv == (BtorSolver *) slv);
+
+  if (slv->winner) btor_delete (slv->winner);
+  BTOR_DELETE (slv->btor->mm, slv);
+}
+
+/*------------------------------------------------------------------------*/
+
+static int32_t
+terminate_worker (void *state)
+{
+  BtorPortfolioWorker *worker = (BtorPortfolioWorker *) state;
+  return *worker->found_result || btor_terminate (worker->btor);
+}
+
+static void *
+run_worker (void *state)
+{
+  BtorPortfolioWorker *worker;
+  BtorSolverResult res;
+  double start;
+
+  worker = (BtorPortfolioWorker *) state;
+#ifdef BTOR_HAVE_PTHREADS
+  start = btor_util_process_time_thread ();
+#else
+  start = btor_util_time_stamp ();
+#endif
+
+  res = btor_check_sat (worker->clone, -1, -1);
+
+#ifdef BTOR_HAVE_PTHREADS
+  worker->time = btor_util_process_time_thread () - start;
+  pthread_mutex_lock (worker->found_result_mutex);
+#else
+  worker->time = btor_util_time_stamp () - start;
+#endif
+  worker->result = res;
+  if (res != BTOR_RESULT_UNKNOWN && !*worker->found_result)
+  {
+    BTOR_MSG (worker->btor->msg,
+              1,
+              "%s engine determined %s in %.2f seconds",
+              engine_name (worker->engine),
+              res == BTOR_RESULT_SAT ? "'sat'" : "'unsat'",
+              worker->time);
+    *worker->found_result = true;
+  }
+  else
+  {
+    /* either an engine that finished earlier determined the result or
+     * this engine gave up (e.g., limit reached) */
+    worker->result = BTOR_RESULT_UNKNOWN;
+  }
+#ifdef BTOR_HAVE_PTHREADS
+  pthread_mutex_unlock (worker->found_result_mutex);
+#endif
+  return 0;
+}
+
+static void
+init_worker (BtorPortfolioSolver *slv,
+             BtorPortfolioWorker *worker,
+             BtorOptEngine engine,
+             bool *found_result)
+{
+  assert (slv);
+  assert (worker);
+  assert (found_result);
+
+  Btor *btor, *clone;
+  double start;
+
+  btor  = slv->btor;
+  start = btor_util_time_stamp ();
+
+  BTOR_CLR (worker);
+  worker->btor         = btor;
+  worker->engine       = engine;
+  worker->result       = BTOR_RESULT_UNKNOWN;
+  worker->found_result = found_result;
+
+  clone = btor_clone_btor (btor);
+  /* the clone inherits this solver, which must not be used to solve the
+   * clone itself (the engine is selected by the worker) */
+  if (clone->slv)
+  {
+    clone->slv->api.delet (clone->slv);
+    clone->slv = 0;
+  }
+  btor_opt_set (clone, BTOR_OPT_ENGINE, engine);
+  btor_set_term (clone, terminate_worker, worker);
+  worker->clone = clone;
+
+  slv->time.clone += btor_util_time_stamp () - start;
+}
+
+/*------------------------------------------------------------------------*/
+
+static BtorSolverResult
+sat_portfolio_solver (BtorPortfolioSolver *slv)
+{
+  assert (slv);
+  assert (slv->kind == BTOR_PORTFOLIO_SOLVER_KIND);
+  assert (slv->btor);
+  assert (slv->btor->slv == (BtorSolver *) slv);
+
+  bool found_result, is_qf_bv;
+  uint32_t i;
+  double start;
+  BtorSolverResult res;
+  BtorOptEngine engines[BTOR_ENGINE_MAX + 1];
+  uint32_t nengines;
+  Btor *btor;
+  BtorPortfolioWorker workers[BTOR_ENGINE_MAX + 1];
+  BtorPortfolioWorker *worker;
+#ifdef BTOR_HAVE_PTHREADS
+  pthread_mutex_t found_result_mutex = PTHREAD_MUTEX_INITIALIZER;
+  pthread_t *threads;
+#endif
+
+  btor  = slv->btor;
+  start = btor_util_current_time ();
+  res   = BTOR_RESULT_UNKNOWN;
+
+  if (slv->winner)
+  {
+    btor_delete (slv->winner);
+    slv->winner = 0;
+  }
+
+  if (btor_terminate (btor)) goto DONE;
+
+  /* local search engines work on QF_BV only */
+  is_qf_bv = btor->ufs->count == 0 && btor->feqs->count == 0;
+
+  nengines = 0;
+  if (btor_opt_get (btor, BTOR_OPT_PORTFOLIO_FUN))
+    engines[nengines++] = BTOR_ENGINE_FUN;
+  if (is_qf_bv && btor_opt_get (btor, BTOR_OPT_PORTFOLIO_SLS))
+    engines[nengines++] = BTOR_ENGINE_SLS;
+  if (is_qf_bv && btor_opt_get (btor, BTOR_OPT_PORTFOLIO_PROP))
+    engines[nengines++] = BTOR_ENGINE_PROP;
+  if (is_qf_bv && btor_opt_get (btor, BTOR_OPT_PORTFOLIO_AIGPROP))
+    engines[nengines++] = BTOR_ENGINE_AIGPROP;
+  /* make sure that there is at least one engine */
+  if (nengines == 0)
+  {
+    BTOR_MSG (btor->msg,
+              1,
+              "no applicable portfolio engine enabled, using fun engine");
+    engines[nengines++] = BTOR_ENGINE_FUN;
+  }
+
+  found_result = false;
+  for (i = 0; i < nengines; i++)
+    init_worker (slv, &workers[i], engines[i], &found_result);
+  slv->stats.races += 1;
+  slv->stats.workers += nengines;
+
+  BTOR_MSG (btor->msg,
+            1,
+            "racing %u engine(s)",
+            nengines);
+
+#ifdef BTOR_HAVE_PTHREADS
+  BTOR_NEWN (btor->mm, threads, nengines);
+  for (i = 0; i < nengines; i++)
+  {
+    worker                     = &workers[i];
+    worker->found_result_mutex = &found_result_mutex;
+    pthread_create (&threads[i], 0, run_worker, worker);
+  }
+  for (i = 0; i < nengines; i++)
+    pthread_join (threads[i], 0);
+  BTOR_DELETEN (btor->mm, threads, nengines);
+#else
+  /* without thread support the engines are run one after the other */
+  for (i = 0; i < nengines && !found_result; i++)
+    run_worker (&workers[i]);
+#endif
+
+  for (i = 0; i < nengines; i++)
+  {
+    worker = &workers[i];
+    if (worker->result != BTOR_RESULT_UNKNOWN)
+    {
+      assert (!slv->winner);
+      res                = worker->result;
+      slv->winner        = worker->clone;
+      slv->winner_engine = worker->engine;
+      slv->stats.wins[worker->engine] += 1;
+    }
+    else
+      btor_delete (worker->clone);
+  }
+
+DONE:
+  slv->time.race += btor_util_current_time () - start;
+  btor->last_sat_result = res;
+  return res;
+}
+
+static void
+generate_model_portfolio_solver (BtorPortfolioSolver *slv,
+                                 bool model_for_all_nodes,
+                                 bool reset)
+{
+  assert (slv);
+  assert (slv->kind == BTOR_PORTFOLIO_SOLVER_KIND);
+  assert (slv->btor);
+  assert (slv->btor->slv == (BtorSolver *) slv);
+
+  (void) reset;
+
+  Btor *btor = slv->btor;
+
+  if (!slv->winner)
+  {
+    btor_model_init_bv (btor, &btor->bv_model);
+    btor_model_init_fun (btor, &btor->fun_model);
+    return;
+  }
+  btor_model_import (btor, slv->winner, model_for_all_nodes);
+}
+
+static void
+print_stats_portfolio_solver (BtorPortfolioSolver *slv)
+{
+  assert (slv);
+  assert (slv->kind == BTOR_PORTFOLIO_SOLVER_KIND);
+  assert (slv->btor);
+  assert (slv->btor->slv == (BtorSolver *) slv);
+
+  BtorOptEngine engine;
+  Btor *btor = slv->btor;
+
+  BTOR_MSG (btor->msg, 1, "");
+  BTOR_MSG (btor->msg, 1, "portfolio races: %u", slv->stats.races);
+  BTOR_MSG (btor->msg, 1, "portfolio workers: %u", slv->stats.workers);
+  for (engine = BTOR_ENGINE_FUN; engine <= BTOR_ENGINE_AIGPROP; engine++)
+    BTOR_MSG (btor->msg,
+              1,
+              "  %s engine wins: %u",
+              engine_name (engine),
+              slv->stats.wins[engine]);
+}
+
+static void
+print_time_stats_portfolio_solver (BtorPortfolioSolver *slv)
+{
+  assert (slv);
+  assert (slv->kind == BTOR_PORTFOLIO_SOLVER_KIND);
+  assert (slv->btor);
+  assert (slv->btor->slv == (BtorSolver *) slv);
+
+  Btor *btor = slv->btor;
+
+  BTOR_MSG (btor->msg, 1, "");
+  BTOR_MSG (btor->msg,
+            1,
+            "%.2f seconds cloning portfolio workers",
+            slv->time.clone);
+  BTOR_MSG (btor->msg,
+            1,
+            "%.2f seconds racing portfolio engines (wall clock)",
+            slv->time.race);
+}
+
+static void
+print_model_portfolio_solver (BtorPortfolioSolver *slv,
+                              const char *format,
+                              FILE *file)
+{
+  btor_print_model_aufbv (slv->btor, format, file);
+}
+
+BtorSolver *
+btor_new_portfolio_solver (Btor *btor)
+{
+  assert (btor);
+
+  BtorPortfolioSolver *slv;
+
+  BTOR_CNEW (btor->mm, slv);
+
+  slv->btor = btor;
+  slv->kind = BTOR_PORTFOLIO_SOLVER_KIND;
+
+  slv->api.clone = (BtorSolverClone) clone_portfolio_solver;
+  slv->api.delet = (BtorSolverDelete) delete_portfolio_solver;
+  slv->api.sat   = (BtorSolverSat) sat_portfolio_solver;
+  slv->api.generate_model =
+      (BtorSolverGenerateModel) generate_model_portfolio_solver;
+  slv->api.print_stats = (BtorSolverPrintStats) print_stats_portfolio_solver;
+  slv->api.print_time_stats =
+      (BtorSolverPrintTimeStats) print_time_stats_portfolio_solver;
+  slv->api.print_model = (BtorSolverPrintModel) print_model_portfolio_solver;
+
+  BTOR_MSG (btor->msg, 1, "enabled portfolio engine");
+
+  return (BtorSolver *) slv;
+}
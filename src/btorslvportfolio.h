@@ -0,0 +1,46 @@
+/*  Boolector: Satisfiability Modulo Theories (SMT) solver.
+ *
+ *  Copyright (C) 2020 Aina Niemetz.
+ *  Copyright (C) 2020 Mathias Preiner.
+ *
+ *  This file is part of Boolector.
+ *  See COPYING for more information on using this software.
+ */
+
+#ifndef BTORSLVPORTFOLIO_H_INCLUDED
+#define BTORSLVPORTFOLIO_H_INCLUDED
+
+#include "btoropt.h"
+#include "btorslv.h"
+#include "btortypes.h"
+
+#define BTOR_PORTFOLIO_SOLVER(btor) ((BtorPortfolioSolver *) (btor)->slv)
+
+struct BtorPortfolioSolver
+{
+  BTOR_SOLVER_STRUCT;
+
+  /* clone that determined the result of the last sat call (kept until the
+   * next sat call since the model is imported lazily) */
+  Btor *winner;
+  BtorOptEngine winner_engine;
+
+  struct
+  {
+    uint32_t races;
+    uint32_t workers;
+    uint32_t wins[BTOR_ENGINE_MAX + 1];
+  } stats;
+
+  struct
+  {
+    double clone;
+    double race;
+  } time;
+};
+
+typedef struct BtorPortfolioSolver BtorPortfolioSolver;
+
+BtorSolver *btor_new_portfolio_solver (Btor *btor);
+
+#endif
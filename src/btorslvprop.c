@@ -174,6 +174,7 @@ move (Btor *btor, uint32_t nmoves)
       exps,
       true,
       &slv->stats.updates,
+      &slv->stats.evals,
       &slv->time.update_cone,
       &slv->time.update_cone_reset,
       &slv->time.update_cone_model_gen,
@@ -443,6 +444,11 @@ print_stats_prop_solver (BtorPropSolver *slv)
             "propagation (steps) per second: %.2f",
             (double) slv->stats.props / (btor->time.sat - btor->time.simplify));
   BTOR_MSG (btor->msg, 1, "updates (cone): %u", slv->stats.updates);
+  BTOR_MSG (btor->msg, 1, "re-evaluations (cone): %u", slv->stats.evals);
+  BTOR_MSG (btor->msg,
+            1,
+            "nodes re-evaluated per move: %.2f",
+            BTOR_AVERAGE_UTIL (slv->stats.evals, slv->stats.moves));
   BTOR_MSG (btor->msg, 1, "");
   BTOR_MSG (btor->msg,
             1,
@@ -41,6 +41,7 @@ struct BtorPropSolver
     uint64_t props_cons;
     uint64_t props_inv;
     uint64_t updates;
+    uint64_t evals;
 
 #ifndef NDEBUG
     uint32_t inv_add;
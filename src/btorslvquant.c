@@ -97,6 +97,7 @@ struct BtorGroundSolvers
   bool *found_result;
   pthread_mutex_t *found_result_mutex;
 #endif
+  bool measure_thread_time; /* measure time per thread (dual solver) */
 };
 
 typedef struct BtorGroundSolvers BtorGroundSolvers;
@@ -336,12 +337,10 @@ flat_model_free (FlatModel *flat_model)
 
 /*------------------------------------------------------------------------*/
 
-static bool g_measure_thread_time = false;
-
 static double
-time_stamp (void)
+time_stamp (BtorGroundSolvers *gslv)
 {
-  if (g_measure_thread_time) return btor_util_process_time_thread ();
+  if (gslv->measure_thread_time) return btor_util_process_time_thread ();
   return btor_util_time_stamp ();
 }
 
@@ -2397,9 +2396,9 @@ find_model (BtorGroundSolvers *gslv, bool skip_exists)
   if (!skip_exists)
   {
     /* query exists solver */
-    start = time_stamp ();
+    start = time_stamp (gslv);
     r     = btor_check_sat (gslv->exists, -1, -1);
-    gslv->statistics.time.e_solver += time_stamp () - start;
+    gslv->statistics.time.e_solver += time_stamp (gslv) - start;
 
     if (r == BTOR_RESULT_UNSAT) /* formula is UNSAT */
     {
@@ -2413,7 +2412,7 @@ find_model (BtorGroundSolvers *gslv, bool skip_exists)
       goto DONE;
     }
 
-    start      = time_stamp ();
+    start      = time_stamp (gslv);
     flat_model = flat_model_generate (gslv);
 
     /* synthesize model based on 'partial_model' */
@@ -2423,17 +2422,17 @@ find_model (BtorGroundSolvers *gslv, bool skip_exists)
     /* save currently synthesized model */
     delete_model (gslv);
     gslv->forall_synth_model = synth_model;
-    gslv->statistics.time.synth += time_stamp () - start;
+    gslv->statistics.time.synth += time_stamp (gslv) - start;
   }
 
-  start = time_stamp ();
+  start = time_stamp (gslv);
   if (evar_map)
   {
     btor_nodemap_delete (evar_map);
     evar_map = btor_nodemap_new (gslv->forall);
   }
   g = instantiate_formula (gslv, synth_model, evar_map);
-  gslv->statistics.time.checkinst += time_stamp () - start;
+  gslv->statistics.time.checkinst += time_stamp (gslv) - start;
 
   /* if there are no universal variables in the formula, we have a simple
    * ground formula */
@@ -2441,20 +2440,20 @@ find_model (BtorGroundSolvers *gslv, bool skip_exists)
   {
     assert (skip_exists);
     btor_assert_exp (gslv->forall, g);
-    start = time_stamp ();
+    start = time_stamp (gslv);
     res   = btor_check_sat (gslv->forall, -1, -1);
-    gslv->statistics.time.f_solver += time_stamp () - start;
+    gslv->statistics.time.f_solver += time_stamp (gslv) - start;
     goto DONE;
   }
 
   btor_assume_exp (gslv->forall, btor_node_invert (g));
 
   /* query forall solver */
-  start = time_stamp ();
+  start = time_stamp (gslv);
   r     = btor_check_sat (gslv->forall, -1, -1);
   update_formula (gslv);
   assert (!btor_node_is_proxy (gslv->forall_formula));
-  gslv->statistics.time.f_solver += time_stamp () - start;
+  gslv->statistics.time.f_solver += time_stamp (gslv) - start;
 
   if (r == BTOR_RESULT_UNSAT) /* formula is SAT */
   {
@@ -2470,15 +2469,15 @@ find_model (BtorGroundSolvers *gslv, bool skip_exists)
 
   /* if refinement fails, we got a counter-example that we already got in
    * a previous call. in this case we produce a model using all refinements */
-  start = time_stamp ();
+  start = time_stamp (gslv);
   refine_exists_solver (gslv, evar_map);
-  gslv->statistics.time.refine += time_stamp () - start;
+  gslv->statistics.time.refine += time_stamp (gslv) - start;
 
   if (opt_synth_qi)
   {
-    start = time_stamp ();
+    start = time_stamp (gslv);
     synthesize_quant_inst (gslv);
-    gslv->statistics.time.qinst += time_stamp () - start;
+    gslv->statistics.time.qinst += time_stamp (gslv) - start;
   }
 
 DONE:
@@ -2532,8 +2531,9 @@ run_parallel (BtorGroundSolvers *gslv, BtorGroundSolvers *dgslv)
   BtorSolverResult res;
   pthread_t thread_orig, thread_dual;
 
-  thread_found_result   = false;
-  g_measure_thread_time = true;
+  thread_found_result        = false;
+  gslv->measure_thread_time  = true;
+  dgslv->measure_thread_time = true;
   btor_set_term (gslv->forall, thread_terminate, &thread_found_result);
   btor_set_term (gslv->exists, thread_terminate, &thread_found_result);
   btor_set_term (dgslv->forall, thread_terminate, &thread_found_result);
@@ -352,6 +352,7 @@ try_move (Btor *btor,
                             cans,
                             false,
                             &slv->stats.updates,
+                            &slv->stats.evals,
                             &slv->time.update_cone,
                             &slv->time.update_cone_reset,
                             &slv->time.update_cone_model_gen,
@@ -1262,6 +1263,7 @@ move (Btor *btor, uint32_t nmoves)
                             slv->max_cans,
                             true,
                             &slv->stats.updates,
+                            &slv->stats.evals,
                             &slv->time.update_cone,
                             &slv->time.update_cone_reset,
                             &slv->time.update_cone_model_gen,
@@ -1676,6 +1678,18 @@ print_stats_sls_solver (BtorSLSSolver *slv)
   BTOR_MSG (btor->msg, 1, "sls moves: %d", slv->stats.moves);
   BTOR_MSG (btor->msg, 1, "sls flips: %d", slv->stats.flips);
   BTOR_MSG (btor->msg, 1, "sls propagation steps: %u", slv->stats.props);
+  BTOR_MSG (btor->msg,
+            1,
+            "sls moves per second: %.2f",
+            (double) slv->stats.moves / (btor->time.sat - btor->time.simplify));
+  BTOR_MSG (btor->msg, 1, "sls updates (cone): %u", slv->stats.updates);
+  BTOR_MSG (btor->msg, 1, "sls re-evaluations (cone): %u", slv->stats.evals);
+  /* tried and performed moves */
+  BTOR_MSG (btor->msg,
+            1,
+            "sls nodes re-evaluated per move: %.2f",
+            BTOR_AVERAGE_UTIL (slv->stats.evals,
+                               slv->stats.flips + slv->stats.moves));
   BTOR_MSG (btor->msg, 1, "");
   BTOR_MSG (btor->msg,
             1,
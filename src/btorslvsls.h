@@ -110,6 +110,7 @@ struct BtorSLSSolver
     uint32_t move_gw_rand;
     uint32_t move_gw_rand_walk;
     uint64_t updates;
+    uint64_t evals;
   } stats;
 
   struct
@@ -26,6 +26,8 @@ typedef enum BtorSolverResult BtorSolverResult;
 /* public API types */
 typedef struct BoolectorNode BoolectorNode;
 
+typedef struct BoolectorModel BoolectorModel;
+
 typedef struct BoolectorAnonymous BoolectorAnonymous;
 
 typedef BoolectorAnonymous* BoolectorSort;
@@ -143,6 +145,10 @@ enum BtorOption
         bit-blasted formula (the AIG layer)
       * BTOR_ENGINE_QUANT:
         the quantifier engine (BV only)
+      * BTOR_ENGINE_PORTFOLIO:
+        run a portfolio of engines (configured via the portfolio engine
+        options) in parallel on clones of the input formula, the first engine
+        to determine the result wins (quantifier-free formulas only)
   */
   BTOR_OPT_ENGINE,
 
@@ -283,6 +289,8 @@ enum BtorOption
 
       Enable (``value``: 1) or disable (``value``: 0) unconstrained
       optimization.
+      In incremental mode, only terms that are neither referenced nor named
+      by the user are considered unconstrained.
   */
   BTOR_OPT_UCOPT,
 
@@ -318,6 +326,113 @@ enum BtorOption
   */
   BTOR_OPT_NORMALIZE_ADD,
 
+  /*!
+    * **BTOR_OPT_PP_SKIP**
+
+      | Enable (``value``: 1) or disable (``value``: 0) skipping of
+        preprocessing passes that did not simplify the formula.
+      | If enabled, a pass that neither reduced the number of nodes nor
+        produced new constraints is not run again in further rounds of the
+        same simplification call.
+  */
+  BTOR_OPT_PP_SKIP,
+
+  /*!
+    * **BTOR_OPT_RW_CACHE_SIZE**
+
+      | Set the maximum size of the rewrite cache in MB (``value``: 1-65536).
+      | Default is 32 MB.
+  */
+  BTOR_OPT_RW_CACHE_SIZE,
+
+  /*!
+    * **BTOR_OPT_RW_CACHE_EVICT**
+
+      | Set the eviction policy of the rewrite cache, i.e., which entry to
+        replace if the cache is full.
+
+      * BTOR_RW_CACHE_EVICT_LRU [default]:
+        evict least recently used entry
+      * BTOR_RW_CACHE_EVICT_FIFO:
+        evict oldest entry
+      * BTOR_RW_CACHE_EVICT_NONE:
+        never evict entries, the cache grows without bound
+  */
+  BTOR_OPT_RW_CACHE_EVICT,
+
+  /*!
+    * **BTOR_OPT_MUL_ENC**
+
+      | Set the encoding of bit-vector multiplication when bit-blasting.
+
+      * BTOR_MUL_ENC_ARRAY [default]:
+        array multiplier (shift-and-add with ripple-carry adders)
+      * BTOR_MUL_ENC_WALLACE:
+        Wallace tree reduction of the partial products
+      * BTOR_MUL_ENC_DADDA:
+        Dadda tree reduction of the partial products
+      * BTOR_MUL_ENC_SPARSE:
+        Dadda tree reduction, partial products that are known to be zero
+        (e.g., for constant operands) are dropped before building the tree
+  */
+  BTOR_OPT_MUL_ENC,
+
+  /*!
+    * **BTOR_OPT_CNF_ENC**
+
+      | Set the encoding of AIGs into CNF.
+
+      * BTOR_CNF_ENC_TSEITIN [default]:
+        Tseitin encoding, all clauses of a gate are added
+      * BTOR_CNF_ENC_PG:
+        Plaisted-Greenbaum encoding, only the clauses required by the
+        polarities in which a gate occurs are added (gates of assertions are
+        only encoded in the polarity in which they are asserted, the
+        remaining clauses are added if the gate is used in the other
+        polarity later on)
+  */
+  BTOR_OPT_CNF_ENC,
+
+  /*!
+    * **BTOR_OPT_CNF_XOR_ITE**
+
+      | Enable (``value``: 1) or disable (``value``: 0) detection of XOR
+        and ITE gates when encoding AIGs into CNF. Detected gates are
+        encoded with 4 ternary clauses instead of the clauses of the 3 AND
+        gates they consist of.
+  */
+  BTOR_OPT_CNF_XOR_ITE,
+
+  /*!
+    * **BTOR_OPT_AIG_REWRITE**
+
+      | Enable (``value``: 1) or disable (``value``: 0) DAG-aware cut
+        rewriting of the AIGs of constraints before they are encoded into
+        CNF.
+      | Subgraphs between AIGs and their 4-feasible cuts are replaced by
+        smaller implementations of the functions of the cuts.
+  */
+  BTOR_OPT_AIG_REWRITE,
+
+  /*!
+    * **BTOR_OPT_SAT_SWEEP**
+
+      | Enable (``value``: 1) or disable (``value``: 0) SAT sweeping of the
+        AIGs of constraints before they are encoded into CNF.
+      | Functionally equivalent AIGs are determined by random simulation and
+        SAT calls on a separate SAT solver instance, and merged.
+  */
+  BTOR_OPT_SAT_SWEEP,
+
+  /*!
+    * **BTOR_OPT_SAT_SWEEP_LIMIT**
+
+      | Set the conflict (or decision, depending on the SAT solver) limit of
+        the SAT calls of SAT sweeping, 0 for no limit.
+      | Default is 1000.
+  */
+  BTOR_OPT_SAT_SWEEP_LIMIT,
+
   /* --------------------------------------------------------------------- */
   /*!
     **Fun Engine Options:**
@@ -411,6 +526,29 @@ enum BtorOption
 
   BTOR_OPT_FUN_STORE_LAMBDAS,
 
+  /*!
+    * **BTOR_OPT_FUN_CUBE**
+
+      | Enable (``value``: > 0) or disable (``value``: 0) cube-and-conquer
+        mode of the function solver engine.
+      | In cube-and-conquer mode, the problem is split into
+        2^\ ``value`` cubes by assuming all combinations of values for
+        ``value`` selected input bits. The cubes are solved in parallel on
+        clones of the current instance (see BTOR_OPT_FUN_CUBE_THREADS),
+        lemmas generated while solving a cube are shared with all other
+        cubes.
+      | Cube-and-conquer mode is not used if assumptions are present.
+  */
+  BTOR_OPT_FUN_CUBE,
+
+  /*!
+    * **BTOR_OPT_FUN_CUBE_THREADS**
+
+      | Set the number of worker threads used in cube-and-conquer mode
+        (``value``: 0 uses one thread per available core).
+  */
+  BTOR_OPT_FUN_CUBE_THREADS,
+
   /*!
     * **BTOR_OPT_PRINT_DIMACS**
 
@@ -768,6 +906,47 @@ enum BtorOption
   */
   BTOR_OPT_AIGPROP_USE_BANDIT,
 
+  /* --------------------------------------------------------------------- */
+  /*!
+    **Portfolio Engine Options**:
+   */
+  /* --------------------------------------------------------------------- */
+
+  /*!
+    * **BTOR_OPT_PORTFOLIO_FUN**
+
+      Enable (``value``: 1) or disable (``value``: 0) the fun engine in the
+      portfolio.
+  */
+  BTOR_OPT_PORTFOLIO_FUN,
+
+  /*!
+    * **BTOR_OPT_PORTFOLIO_SLS**
+
+      | Enable (``value``: 1) or disable (``value``: 0) the SLS engine in the
+        portfolio.
+      | The SLS engine is only raced on QF_BV formulas.
+  */
+  BTOR_OPT_PORTFOLIO_SLS,
+
+  /*!
+    * **BTOR_OPT_PORTFOLIO_PROP**
+
+      | Enable (``value``: 1) or disable (``value``: 0) the prop engine in the
+        portfolio.
+      | The prop engine is only raced on QF_BV formulas.
+  */
+  BTOR_OPT_PORTFOLIO_PROP,
+
+  /*!
+    * **BTOR_OPT_PORTFOLIO_AIGPROP**
+
+      | Enable (``value``: 1) or disable (``value``: 0) the AIGProp engine in
+        the portfolio.
+      | The AIGProp engine is only raced on QF_BV formulas.
+  */
+  BTOR_OPT_PORTFOLIO_AIGPROP,
+
   /* QUANT engine ------------------------------------------------------- */
   /*!
     * **BTOR_OPT_QUANT_SYNTH**
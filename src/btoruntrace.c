@@ -475,6 +475,7 @@ parse (FILE *file)
   char *ret_str;                 /* actual return value string */
   void *ret_ptr;                 /* actual return value string */
   char **res1_pptr, **res2_pptr; /* result pointer */
+  uint64_t *words;               /* result buffer */
 
   char *btor_str; /* btor pointer string */
   char *exp_str;  /* expression string (pointer) */
@@ -1779,6 +1780,46 @@ NEXT:
                                     hmap_get (hmap, arg2_str),
                                     arg3_uint);
     }
+    else if (!strcmp (tok, "bv_assignments_words"))
+    {
+      arg1_uint = parse_uint_arg (tok); /* n */
+      BTOR_NEWN (g_btorunt->mm, tmp, arg1_uint);
+      for (i = 0; i < arg1_uint; i++) /* nodes */
+        tmp[i] = hmap_get (hmap, parse_str_arg (tok));
+      arg2_uint = parse_uint_arg (tok); /* size */
+      parse_check_last_arg (tok);
+      BTOR_NEWN (g_btorunt->mm, words, arg2_uint);
+      ret_uint = boolector_bv_assignments_words (
+          btor, arg1_uint, tmp, words, arg2_uint);
+      BTOR_DELETEN (g_btorunt->mm, words, arg2_uint);
+      BTOR_DELETEN (g_btorunt->mm, tmp, arg1_uint);
+      exp_ret = RET_UINT;
+    }
+    else if (!strcmp (tok, "bv_assignments_uint64"))
+    {
+      arg1_uint = parse_uint_arg (tok); /* n */
+      BTOR_NEWN (g_btorunt->mm, tmp, arg1_uint);
+      for (i = 0; i < arg1_uint; i++) /* nodes */
+        tmp[i] = hmap_get (hmap, parse_str_arg (tok));
+      parse_check_last_arg (tok);
+      BTOR_NEWN (g_btorunt->mm, words, arg1_uint);
+      boolector_bv_assignments_uint64 (btor, arg1_uint, tmp, words);
+      BTOR_DELETEN (g_btorunt->mm, words, arg1_uint);
+      BTOR_DELETEN (g_btorunt->mm, tmp, arg1_uint);
+    }
+    else if (!strcmp (tok, "fun_assignment_words"))
+    {
+      PARSE_ARGS2 (tok, str, uint);
+      BTOR_NEWN (g_btorunt->mm, words, arg2_uint);
+      ret_uint = boolector_fun_assignment_words (btor,
+                                                 hmap_get (hmap, arg1_str),
+                                                 words,
+                                                 arg2_uint,
+                                                 &arg3_uint,
+                                                 &ret_bool);
+      BTOR_DELETEN (g_btorunt->mm, words, arg2_uint);
+      exp_ret = RET_UINT;
+    }
     else if (!strcmp (tok, "print_model"))
     {
       PARSE_ARGS1 (tok, str);
@@ -12,6 +12,7 @@
 #include "btorbv.h"
 #include "btormsg.h"
 #include "btorparse.h"
+#include "utils/btorinbuf.h"
 #include "utils/btormem.h"
 #include "utils/btorstack.h"
 #include "utils/btorutil.h"
@@ -60,6 +61,7 @@ struct BtorBTORParser
   uint32_t nprefix;
   BtorCharStack *prefix;
   FILE *infile;
+  BtorInBuf inbuf;
   const char *infile_name;
   uint32_t lineno;
   bool saved;
@@ -156,7 +158,7 @@ nextch_btor (BtorBTORParser *parser)
     ch = parser->prefix->start[parser->nprefix++];
   }
   else
-    ch = getc (parser->infile);
+    ch = btor_inbuf_getc (&parser->inbuf);
 
   if (ch == '\n') parser->lineno++;
 
@@ -1830,6 +1832,8 @@ delete_btor_parser (BtorBTORParser *parser)
 
   mm = parser->mem;
 
+  btor_inbuf_release (&parser->inbuf);
+
   BTOR_RELEASE_STACK (parser->exps);
   BTOR_RELEASE_STACK (parser->info);
   BTOR_RELEASE_STACK (parser->regs);
@@ -1876,6 +1880,7 @@ parse_btor_parser (BtorBTORParser *parser,
   parser->infile_name = infile_name;
   parser->lineno      = 1;
   parser->saved       = false;
+  btor_inbuf_init (parser->mem, &parser->inbuf, infile);
 
   BTOR_INIT_STACK (parser->mem, parser->lambdas);
   BTOR_INIT_STACK (parser->mem, parser->params);
@@ -1899,6 +1904,7 @@ NEXT:
       else
         res->logic = BTOR_LOGIC_QF_BV;
       res->status = BOOLECTOR_UNKNOWN;
+      res->bytes  = parser->nprefix + btor_inbuf_bytes (&parser->inbuf);
     }
 
     return 0;
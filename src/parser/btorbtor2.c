@@ -115,6 +115,7 @@ parse_btor2_parser (BtorBTOR2Parser *parser,
   BtorMsg *msg;
   Btor *btor;
   bool found_arrays, found_lambdas;
+  off_t pos;
 
   btor = parser->btor;
   msg  = boolector_get_btor_msg (btor);
@@ -147,6 +148,8 @@ parse_btor2_parser (BtorBTOR2Parser *parser,
     assert (parser->error);
     goto DONE;
   }
+  /* Note: btor2parser reads the whole input up front */
+  if ((pos = ftello (infile)) > 0) res->bytes = pos;
 
   sortmap = btor_hashint_map_new (mm);
   nodemap = btor_hashint_map_new (mm);
@@ -12,6 +12,7 @@
 #include "btorbv.h"
 #include "btoropt.h"
 #include "utils/btorhashptr.h"
+#include "utils/btorinbuf.h"
 #include "utils/btormem.h"
 #include "utils/btorstack.h"
 #include "utils/btorutil.h"
@@ -192,6 +193,7 @@ struct BtorSMTParser
   uint32_t nprefix;
   BtorCharStack *prefix;
   FILE *infile;
+  BtorInBuf inbuf;
   const char *infile_name;
   FILE *outfile;
   uint32_t lineno;
@@ -448,6 +450,7 @@ release_smt_internals (BtorSMTParser *parser)
 {
   release_smt_nodes (parser);
   release_smt_symbols (parser);
+  btor_inbuf_release (&parser->inbuf);
 
   if (parser->nodes)
   {
@@ -731,10 +734,7 @@ nextch_smt (BtorSMTParser *parser)
     res = parser->prefix->start[parser->nprefix++];
   }
   else
-  {
-    parser->bytes++;
-    res = getc (parser->infile);
-  }
+    res = btor_inbuf_getc (&parser->inbuf);
 
   if (res == '\n') parser->lineno++;
 
@@ -2856,6 +2856,7 @@ parse (BtorSMTParser *parser,
   parser->outfile     = outfile;
   parser->lineno      = 1;
   parser->saved       = false;
+  btor_inbuf_init (parser->mem, &parser->inbuf, infile);
 
   BTOR_CLR (res);
 
@@ -2900,7 +2901,9 @@ NEXT_TOKEN:
     top = parser->stack.start[0];
     BTOR_RESET_STACK (parser->stack);
 
-    smt_message (parser, 2, "read %llu bytes", parser->bytes);
+    res->bytes = parser->bytes + btor_inbuf_bytes (&parser->inbuf);
+    smt_message (
+        parser, 2, "read %llu bytes", (unsigned long long) res->bytes);
     smt_message (parser, 2, "found %u symbols", parser->symbols);
     smt_message (parser, 2, "generated %u nodes", parser->nodes->count);
 
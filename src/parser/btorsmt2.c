@@ -14,6 +14,7 @@
 #include "btorcore.h"
 #include "btormsg.h"
 #include "btoropt.h"
+#include "utils/btorinbuf.h"
 #include "utils/btormem.h"
 #include "utils/btorutil.h"
 
@@ -361,6 +362,7 @@ typedef struct BtorSMT2Parser
   char *error;
   unsigned char cc[256];
   FILE *infile;
+  BtorInBuf inbuf;
   char *infile_name;
   FILE *outfile;
   double parse_start;
@@ -531,7 +533,7 @@ nextch_smt2 (BtorSMT2Parser *parser)
            && parser->nprefix < BTOR_COUNT_STACK (*parser->prefix))
     res = parser->prefix->start[parser->nprefix++];
   else
-    res = getc (parser->infile);
+    res = btor_inbuf_getc (&parser->inbuf);
   if (res == '\n')
   {
     parser->nextcoo.x++;
@@ -1047,6 +1049,7 @@ delete_smt2_parser (BtorSMT2Parser *parser)
   release_symbols_smt2 (parser);
   release_work_smt2 (parser);
 
+  btor_inbuf_release (&parser->inbuf);
   if (parser->infile_name) btor_mem_freestr (mem, parser->infile_name);
   if (parser->error) btor_mem_freestr (mem, parser->error);
 
@@ -4937,6 +4940,7 @@ parse_smt2_parser (BtorSMT2Parser *parser,
   parser->nextcoo.y   = 1;
   parser->infile      = infile;
   parser->infile_name = btor_mem_strdup (parser->mem, infile_name);
+  btor_inbuf_init (parser->mem, &parser->inbuf, infile);
   parser->outfile     = outfile;
   parser->saved       = false;
   parser->parse_start = start;
@@ -4947,6 +4951,8 @@ parse_smt2_parser (BtorSMT2Parser *parser,
          && !boolector_terminate (parser->btor))
     ;
 
+  res->bytes = parser->nprefix + btor_inbuf_bytes (&parser->inbuf);
+
   if (parser->error) return parser->error;
 
   if (!boolector_terminate (parser->btor))
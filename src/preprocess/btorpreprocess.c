@@ -33,20 +33,294 @@
 #include "utils/btornodeiter.h"
 #include "utils/btorutil.h"
 
+#include <stdlib.h>
+#include <string.h>
+
+/*------------------------------------------------------------------------*/
+
+static bool
+enabled_var_subst (Btor *btor)
+{
+  return btor_opt_get (btor, BTOR_OPT_REWRITE_LEVEL) > 1
+         && btor_opt_get (btor, BTOR_OPT_VAR_SUBST);
+}
+
+static bool
+enabled_embedded (Btor *btor)
+{
+  return btor_opt_get (btor, BTOR_OPT_REWRITE_LEVEL) > 1;
+}
+
+static bool
+enabled_elim_slices (Btor *btor)
+{
+  return btor_opt_get (btor, BTOR_OPT_ELIMINATE_SLICES)
+         && btor_opt_get (btor, BTOR_OPT_REWRITE_LEVEL) > 2;
+}
+
+static bool
+enabled_skeleton (Btor *btor)
+{
+#ifndef BTOR_DO_NOT_PROCESS_SKELETON
+  return btor_opt_get (btor, BTOR_OPT_REWRITE_LEVEL) > 2
+         && btor_opt_get (btor, BTOR_OPT_SKELETON_PREPROC);
+#else
+  (void) btor;
+  return false;
+#endif
+}
+
+static bool
+enabled_ucopt (Btor *btor)
+{
+  return btor_opt_get (btor, BTOR_OPT_UCOPT)
+         && btor_opt_get (btor, BTOR_OPT_REWRITE_LEVEL) > 2;
+}
+
+static bool
+enabled_extract_lambdas (Btor *btor)
+{
+  return btor_opt_get (btor, BTOR_OPT_REWRITE_LEVEL) > 2
+         && btor_opt_get (btor, BTOR_OPT_EXTRACT_LAMBDAS);
+}
+
+static bool
+enabled_merge_lambdas (Btor *btor)
+{
+  return btor_opt_get (btor, BTOR_OPT_REWRITE_LEVEL) > 2
+         && btor_opt_get (btor, BTOR_OPT_MERGE_LAMBDAS);
+}
+
+static bool
+enabled_elim_applies (Btor *btor)
+{
+  return btor_opt_get (btor, BTOR_OPT_BETA_REDUCE);
+}
+
+static bool
+enabled_ackermann (Btor *btor)
+{
+  return btor_opt_get (btor, BTOR_OPT_ACKERMANN);
+}
+
+static bool
+enabled_normalize_adds (Btor *btor)
+{
+  return btor_opt_get (btor, BTOR_OPT_REWRITE_LEVEL) > 2
+         && btor_opt_get (btor, BTOR_OPT_SIMP_NORMAMLIZE_ADDERS);
+}
+
+/*------------------------------------------------------------------------*/
+
+static void
+run_embedded (Btor *btor)
+{
+  while (btor->embedded_constraints->count && !btor->inconsistent)
+    btor_process_embedded_constraints (btor);
+}
+
+static void
+run_skeleton (Btor *btor)
+{
+#ifndef BTOR_DO_NOT_PROCESS_SKELETON
+  btor_process_skeleton (btor);
+#else
+  (void) btor;
+  assert (false);
+#endif
+}
+
+/* rewrite/beta-reduce applies on lambdas */
+static void
+run_elim_applies (Btor *btor)
+{
+  /* If no UFs or function equalities are present, we eagerly eliminate all
+   * remaining lambdas. */
+  if (btor->ufs->count == 0 && btor->feqs->count == 0
+      && !btor_opt_get (btor, BTOR_OPT_INCREMENTAL))
+  {
+    BTOR_MSG (btor->msg,
+              1,
+              "no UFs or function equalities, enable beta-reduction=all");
+    btor_opt_set (btor, BTOR_OPT_BETA_REDUCE, BTOR_BETA_REDUCE_ALL);
+  }
+  btor_eliminate_applies (btor);
+}
+
+/*------------------------------------------------------------------------*/
+
+struct BtorPPPassInfo
+{
+  const char *name; /* name of the pass in btor_pp_set_order */
+  const char *desc;
+  bool (*enabled) (Btor *);
+  void (*run) (Btor *);
+  uint32_t max_runs; /* maximum number of runs per call, 0: no limit */
+  bool skip;         /* may be skipped if it did not simplify the formula */
+};
+typedef struct BtorPPPassInfo BtorPPPassInfo;
+
+static const BtorPPPassInfo g_btor_pp_passes[BTOR_PP_NUM_PASSES] = {
+    {"varsubst",
+     "variable substitution",
+     enabled_var_subst,
+     btor_substitute_var_exps,
+     0,
+     false},
+    {"embedded",
+     "embedded constraints",
+     enabled_embedded,
+     run_embedded,
+     0,
+     false},
+    {"slices",
+     "slice elimination",
+     enabled_elim_slices,
+     btor_eliminate_slices_on_bv_vars,
+     0,
+     true},
+    {"skeleton",
+     "skeleton preprocessing",
+     enabled_skeleton,
+     run_skeleton,
+     1,
+     true},
+    {"ucopt",
+     "unconstrained optimization",
+     enabled_ucopt,
+     btor_optimize_unconstrained,
+     0,
+     true},
+    {"extract",
+     "lambda extraction",
+     enabled_extract_lambdas,
+     btor_extract_lambdas,
+     0,
+     true},
+    {"merge",
+     "lambda merging",
+     enabled_merge_lambdas,
+     btor_merge_lambdas,
+     0,
+     true},
+    {"elimapplies",
+     "apply elimination",
+     enabled_elim_applies,
+     run_elim_applies,
+     0,
+     false},
+    {"ackermann",
+     "ackermann constraints",
+     enabled_ackermann,
+     btor_add_ackermann_constraints,
+     0,
+     false},
+    {"normadd",
+     "adder normalization",
+     enabled_normalize_adds,
+     btor_normalize_adds,
+     0,
+     true},
+};
+
+static const BtorPPPass g_btor_pp_dflt_order[] = {
+    BTOR_PP_ELIM_SLICES,
+    BTOR_PP_SKELETON,
+    BTOR_PP_UCOPT,
+    BTOR_PP_EXTRACT_LAMBDAS,
+    BTOR_PP_MERGE_LAMBDAS,
+    BTOR_PP_ELIM_APPLIES,
+    BTOR_PP_ACKERMANN,
+    BTOR_PP_NORMALIZE_ADDS,
+};
+
+/*------------------------------------------------------------------------*/
+
+/* we do not count proxies */
+static uint32_t
+num_nodes (Btor *btor)
+{
+  uint32_t i, res;
+
+  for (i = 1, res = 0; i < BTOR_NUM_OPS_NODE - 1; i++) res += btor->ops[i].cur;
+  return res;
+}
+
+/* Run 'pass' and update its statistics, 'time' is the time spent in 'pass'
+ * during the current call to btor_simplify.  Returns true if the pass
+ * simplified the formula, i.e., if it eliminated nodes, produced new
+ * constraints or determined that the formula is inconsistent. */
+static bool
+run_pass (Btor *btor, BtorPPPass pass, double *time)
+{
+  assert (pass < BTOR_PP_NUM_PASSES);
+  assert (time);
+
+  const BtorPPPassInfo *info;
+  uint32_t nodes, constraints;
+  int64_t eliminated;
+  double start, delta;
+
+  info        = &g_btor_pp_passes[pass];
+  nodes       = num_nodes (btor);
+  constraints = btor->unsynthesized_constraints->count;
+  start       = btor_util_time_stamp ();
+
+  info->run (btor);
+
+  delta      = btor_util_time_stamp () - start;
+  eliminated = (int64_t) nodes - (int64_t) num_nodes (btor);
+  *time += delta;
+  btor->time.pp[pass] += delta;
+  btor->stats.pp[pass].runs++;
+  btor->stats.pp[pass].nodes += eliminated;
+  BTOR_MSG (btor->msg,
+            2,
+            "%s: %lld nodes eliminated in %.2f seconds",
+            info->desc,
+            (long long) eliminated,
+            delta);
+
+  if (btor->inconsistent)
+  {
+    BTORLOG (1, "formula inconsistent after %s", info->desc);
+    return true;
+  }
+  return eliminated > 0 || btor->varsubst_constraints->count
+         || btor->embedded_constraints->count
+         || btor->unsynthesized_constraints->count != constraints;
+}
+
 int32_t
 btor_simplify (Btor *btor)
 {
   assert (btor);
 
   BtorSolverResult result;
-  uint32_t rounds;
-  double start, delta;
-#ifndef BTOR_DO_NOT_PROCESS_SKELETON
-  uint32_t skelrounds = 0;
-#endif
+  BtorPPPass pass;
+  const BtorPPPassInfo *info;
+  const BtorPPPass *order;
+  uint32_t i, num_passes, rounds, runs[BTOR_PP_NUM_PASSES];
+  bool skip, ineffective[BTOR_PP_NUM_PASSES];
+  double start, delta, time[BTOR_PP_NUM_PASSES];
 
   rounds = 0;
   start  = btor_util_time_stamp ();
+  skip   = btor_opt_get (btor, BTOR_OPT_PP_SKIP) != 0;
+  BTOR_CLRN (runs, BTOR_PP_NUM_PASSES);
+  BTOR_CLRN (ineffective, BTOR_PP_NUM_PASSES);
+  BTOR_CLRN (time, BTOR_PP_NUM_PASSES);
+
+  if (btor->pp.num_passes)
+  {
+    order      = btor->pp.order;
+    num_passes = btor->pp.num_passes;
+  }
+  else
+  {
+    order      = g_btor_pp_dflt_order;
+    num_passes = sizeof g_btor_pp_dflt_order / sizeof *g_btor_pp_dflt_order;
+  }
 
   if (btor->valid_assignments) btor_reset_incremental_usage (btor);
 
@@ -68,134 +342,53 @@ btor_simplify (Btor *btor)
     //       var_substitutions and var_rhs?
   }
 
+  /* Each round first runs variable substitution and embedded constraint
+   * processing until no new constraints are left, and then the configurable
+   * passes in order.  A new round is started as soon as a pass produces new
+   * variable substitution or embedded constraints. */
   do
   {
     rounds++;
     assert (btor_dbg_check_all_hash_tables_proxy_free (btor));
     assert (btor_dbg_check_all_hash_tables_simp_free (btor));
     assert (btor_dbg_check_unique_table_children_proxy_free (btor));
-    if (btor_opt_get (btor, BTOR_OPT_REWRITE_LEVEL) > 1)
-    {
-      if (btor_opt_get (btor, BTOR_OPT_VAR_SUBST))
-      {
-        btor_substitute_var_exps (btor);
-
-        if (btor->inconsistent)
-        {
-          BTORLOG (1, "formula inconsistent after variable substitution");
-          break;
-        }
 
-        if (btor->varsubst_constraints->count)
-          break;  // TODO (ma): continue instead of break?
-      }
-
-      while (btor->embedded_constraints->count)
-      {
-        btor_process_embedded_constraints (btor);
-
-        if (btor->inconsistent)
-        {
-          BTORLOG (1,
-                   "formula inconsistent after embedded constraint processing");
-          break;
-        }
-      }
-
-      if (btor->varsubst_constraints->count) continue;
-    }
-
-    if (btor_opt_get (btor, BTOR_OPT_ELIMINATE_SLICES)
-        && btor_opt_get (btor, BTOR_OPT_REWRITE_LEVEL) > 2
-        && !btor_opt_get (btor, BTOR_OPT_INCREMENTAL))
+    if (btor->varsubst_constraints->count && enabled_var_subst (btor))
     {
-      btor_eliminate_slices_on_bv_vars (btor);
-      if (btor->inconsistent)
-      {
-        BTORLOG (1, "formula inconsistent after slice elimination");
-        break;
-      }
-
-      if (btor->varsubst_constraints->count
-          || btor->embedded_constraints->count)
-        continue;
+      run_pass (btor, BTOR_PP_VAR_SUBST, &time[BTOR_PP_VAR_SUBST]);
+      if (btor->inconsistent) goto DONE;
     }
 
-#ifndef BTOR_DO_NOT_PROCESS_SKELETON
-    if (btor_opt_get (btor, BTOR_OPT_REWRITE_LEVEL) > 2
-        && btor_opt_get (btor, BTOR_OPT_SKELETON_PREPROC))
+    if (btor->embedded_constraints->count && enabled_embedded (btor))
     {
-      skelrounds++;
-      if (skelrounds <= 1)  // TODO only one?
-      {
-        btor_process_skeleton (btor);
-        if (btor->inconsistent)
-        {
-          BTORLOG (1, "formula inconsistent after skeleton preprocessing");
-          break;
-        }
-      }
-
-      if (btor->varsubst_constraints->count
-          || btor->embedded_constraints->count)
-        continue;
+      run_pass (btor, BTOR_PP_EMBEDDED, &time[BTOR_PP_EMBEDDED]);
+      if (btor->inconsistent) goto DONE;
     }
-#endif
 
-    if (btor->varsubst_constraints->count || btor->embedded_constraints->count)
-      continue;
+    if (btor->varsubst_constraints->count) continue;
 
-    if (btor_opt_get (btor, BTOR_OPT_UCOPT)
-        && btor_opt_get (btor, BTOR_OPT_REWRITE_LEVEL) > 2
-        && !btor_opt_get (btor, BTOR_OPT_INCREMENTAL)
-        && !btor_opt_get (btor, BTOR_OPT_MODEL_GEN))
+    for (i = 0; i < num_passes; i++)
     {
-      btor_optimize_unconstrained (btor);
-      if (btor->inconsistent)
-      {
-        BTORLOG (1, "formula inconsistent after skeleton preprocessing");
-        break;
-      }
-    }
-
-    if (btor->varsubst_constraints->count || btor->embedded_constraints->count)
-      continue;
+      pass = order[i];
+      info = &g_btor_pp_passes[pass];
+      if (!info->enabled (btor)) continue;
 
-    if (btor_opt_get (btor, BTOR_OPT_REWRITE_LEVEL) > 2
-        && btor_opt_get (btor, BTOR_OPT_EXTRACT_LAMBDAS))
-      btor_extract_lambdas (btor);
-
-    if (btor_opt_get (btor, BTOR_OPT_REWRITE_LEVEL) > 2
-        && btor_opt_get (btor, BTOR_OPT_MERGE_LAMBDAS))
-      btor_merge_lambdas (btor);
-
-    if (btor->varsubst_constraints->count || btor->embedded_constraints->count)
-      continue;
-
-    /* rewrite/beta-reduce applies on lambdas */
-    if (btor_opt_get (btor, BTOR_OPT_BETA_REDUCE))
-    {
-      /* If no UFs or function equalities are present, we eagerly eliminate all
-       * remaining lambdas. */
-      if (btor->ufs->count == 0 && btor->feqs->count == 0
-          && !btor_opt_get (btor, BTOR_OPT_INCREMENTAL))
+      if ((info->max_runs && runs[pass] >= info->max_runs)
+          || (btor->pp.budget[pass] > 0 && time[pass] >= btor->pp.budget[pass])
+          || (skip && info->skip && ineffective[pass]))
       {
-        BTOR_MSG (btor->msg,
-                  1,
-                  "no UFs or function equalities, enable beta-reduction=all");
-        btor_opt_set (btor, BTOR_OPT_BETA_REDUCE, BTOR_BETA_REDUCE_ALL);
+        btor->stats.pp[pass].skipped++;
+        continue;
       }
-      btor_eliminate_applies (btor);
-    }
-
-    /* add ackermann constraints for all uninterpreted functions */
-    if (btor_opt_get (btor, BTOR_OPT_ACKERMANN))
-      btor_add_ackermann_constraints (btor);
 
-    if (btor_opt_get (btor, BTOR_OPT_REWRITE_LEVEL) > 2
-        && btor_opt_get (btor, BTOR_OPT_SIMP_NORMAMLIZE_ADDERS))
-      btor_normalize_adds (btor);
+      runs[pass]++;
+      ineffective[pass] = !run_pass (btor, pass, &time[pass]);
+      if (btor->inconsistent) goto DONE;
 
+      if (btor->varsubst_constraints->count
+          || btor->embedded_constraints->count)
+        break;
+    }
   } while (btor->varsubst_constraints->count
            || btor->embedded_constraints->count);
 
@@ -218,3 +411,79 @@ DONE:
   BTOR_MSG (btor->msg, 1, "simplification returned %d", result);
   return result;
 }
+
+bool
+btor_pp_set_order (Btor *btor, const char *order)
+{
+  assert (btor);
+  assert (order);
+
+  BtorPPPass pass, passes[BTOR_PP_NUM_PASSES];
+  uint32_t num_passes;
+  bool listed[BTOR_PP_NUM_PASSES];
+  double budget[BTOR_PP_NUM_PASSES];
+  const char *p, *end;
+  char *endptr;
+  size_t len;
+
+  BTOR_CLRN (listed, BTOR_PP_NUM_PASSES);
+  BTOR_CLRN (budget, BTOR_PP_NUM_PASSES);
+  num_passes = 0;
+
+  for (p = order;; p = end + 1)
+  {
+    for (end = p; *end && *end != ',' && *end != ':'; end++)
+      ;
+    len = end - p;
+
+    /* variable substitution and embedded constraints are not configurable */
+    for (pass = BTOR_PP_ELIM_SLICES; pass < BTOR_PP_NUM_PASSES; pass++)
+    {
+      if (strlen (g_btor_pp_passes[pass].name) == len
+          && !strncmp (g_btor_pp_passes[pass].name, p, len))
+        break;
+    }
+    if (pass == BTOR_PP_NUM_PASSES || listed[pass]) return false;
+    listed[pass]         = true;
+    passes[num_passes++] = pass;
+
+    if (*end == ':')
+    {
+      budget[pass] = strtod (end + 1, &endptr);
+      if (endptr == end + 1 || !(budget[pass] >= 0)) return false;
+      end = endptr;
+      if (*end && *end != ',') return false;
+    }
+    if (!*end) break;
+  }
+
+  memcpy (btor->pp.order, passes, num_passes * sizeof *passes);
+  memcpy (btor->pp.budget, budget, sizeof budget);
+  btor->pp.num_passes = num_passes;
+  return true;
+}
+
+void
+btor_pp_print_stats (Btor *btor)
+{
+  assert (btor);
+
+  BtorPPPass pass;
+  BtorPPStats *stats;
+
+  BTOR_MSG (btor->msg, 1, "");
+  BTOR_MSG (btor->msg, 1, "preprocessing passes:");
+  for (pass = 0; pass < BTOR_PP_NUM_PASSES; pass++)
+  {
+    stats = &btor->stats.pp[pass];
+    if (!stats->runs && !stats->skipped) continue;
+    BTOR_MSG (btor->msg,
+              1,
+              "  %-26s %u runs, %u skipped, %lld nodes, %.2f seconds",
+              g_btor_pp_passes[pass].desc,
+              stats->runs,
+              stats->skipped,
+              (long long) stats->nodes,
+              btor->time.pp[pass]);
+  }
+}
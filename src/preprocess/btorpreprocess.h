@@ -9,10 +9,49 @@
 #ifndef BTORPREPROCESS_H_INCLUDED
 #define BTORPREPROCESS_H_INCLUDED
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "btortypes.h"
 
+/* Preprocessing passes of btor_simplify.  Variable substitution and embedded
+ * constraint processing are always run first in each round, the order of the
+ * remaining passes is configurable via btor_pp_set_order. */
+enum BtorPPPass
+{
+  BTOR_PP_VAR_SUBST,
+  BTOR_PP_EMBEDDED,
+  BTOR_PP_ELIM_SLICES,
+  BTOR_PP_SKELETON,
+  BTOR_PP_UCOPT,
+  BTOR_PP_EXTRACT_LAMBDAS,
+  BTOR_PP_MERGE_LAMBDAS,
+  BTOR_PP_ELIM_APPLIES,
+  BTOR_PP_ACKERMANN,
+  BTOR_PP_NORMALIZE_ADDS,
+  BTOR_PP_NUM_PASSES,
+};
+typedef enum BtorPPPass BtorPPPass;
+
+struct BtorPPStats
+{
+  uint32_t runs;    /* number of runs */
+  uint32_t skipped; /* number of skipped runs (ineffective, out of budget) */
+  int64_t nodes;    /* number of eliminated nodes (negative if added) */
+};
+typedef struct BtorPPStats BtorPPStats;
+
 int32_t btor_simplify (Btor* btor);
 
+/* Set the order and the time budgets of the configurable preprocessing
+ * passes.  'order' is a comma separated list of pass names, each optionally
+ * followed by ':<seconds>', the time budget of the pass per call to
+ * btor_simplify.  A pass that exhausted its budget is not run again until
+ * the next call, a pass that is not listed is never run.
+ * Returns false (and leaves the current order unchanged) if 'order' is
+ * invalid. */
+bool btor_pp_set_order (Btor* btor, const char* order);
+
+void btor_pp_print_stats (Btor* btor);
+
 #endif
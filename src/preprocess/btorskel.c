@@ -40,7 +40,10 @@ fixed_exp (Btor *btor, BtorNode *exp)
     res = -1;
   else
   {
-    id = btor_aig_get_cnf_id (aig);
+    /* the value of a partially (Plaisted-Greenbaum) encoded AIG is not
+     * necessarily fixed if its CNF id is fixed */
+    if (!btor_aig_is_encoded (btor_get_aig_mgr (btor), aig)) return 0;
+    id = btor_aig_get_cnf_id (btor_get_aig_mgr (btor), aig);
     if (!id) return 0;
     smgr = btor_get_sat_mgr (btor);
     res  = btor_sat_fixed (smgr, id);
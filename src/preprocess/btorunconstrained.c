@@ -15,6 +15,7 @@
 #include "btordbg.h"
 #include "btorexp.h"
 #include "btorlog.h"
+#include "btormodel.h"
 #include "btormsg.h"
 #include "btorsubst.h"
 #include "utils/btorhashint.h"
@@ -38,8 +39,75 @@ is_uc_write (BtorNode *cond)
   return btor_node_lambda_get_static_rho (lambda) != 0;
 }
 
+/* Record the kind and the children of unconstrained term 'exp' (which will
+ * be substituted by 'subst') for model reconstruction. */
 static void
-mark_uc (Btor *btor, BtorIntHashTable *uc, BtorNode *exp)
+record_uc (Btor *btor, BtorIntHashTable *uc, BtorNode *exp, BtorNode *subst)
+{
+  assert (btor_node_is_regular (exp));
+  assert (!exp->parameterized);
+  assert (btor_node_is_bv_var (subst));
+
+  uint32_t i;
+  BtorUCTerm *uc_term;
+
+  BTOR_CNEW (btor->mm, uc_term);
+  uc_term->kind  = exp->kind;
+  uc_term->arity = exp->arity;
+  if (btor_node_is_bv_slice (exp))
+  {
+    uc_term->upper = btor_node_bv_slice_get_upper (exp);
+    uc_term->lower = btor_node_bv_slice_get_lower (exp);
+  }
+  for (i = 0; i < exp->arity; i++)
+  {
+    uc_term->e[i] = btor_node_copy (btor, exp->e[i]);
+    if (btor_hashint_table_contains (uc, btor_node_real_addr (exp->e[i])->id))
+      uc_term->uc |= 1u << i;
+  }
+  uc_term->exp   = btor_node_copy (btor, exp);
+  uc_term->subst = btor_node_copy (btor, subst);
+  BTOR_PUSH_STACK (btor->uc_terms, uc_term);
+}
+
+/* Collect the nodes the user may still refer to, i.e., nodes that are
+ * referenced externally or have a symbol, and the nodes they have been
+ * simplified to. */
+static BtorIntHashTable *
+collect_external (Btor *btor)
+{
+  uint32_t i;
+  BtorNode *cur;
+  BtorIntHashTable *res;
+  BtorPtrHashTableIterator it;
+  BtorNodePtrStack visit;
+
+  res = btor_hashint_table_new (btor->mm);
+  BTOR_INIT_STACK (btor->mm, visit);
+  for (i = 1; i < BTOR_COUNT_STACK (btor->nodes_id_table); i++)
+  {
+    cur = BTOR_PEEK_STACK (btor->nodes_id_table, i);
+    if (cur && cur->ext_refs) BTOR_PUSH_STACK (visit, cur);
+  }
+  btor_iter_hashptr_init (&it, btor->node2symbol);
+  while (btor_iter_hashptr_has_next (&it))
+    BTOR_PUSH_STACK (visit, btor_iter_hashptr_next (&it));
+
+  while (!BTOR_EMPTY_STACK (visit))
+  {
+    cur = btor_node_real_addr (BTOR_POP_STACK (visit));
+    while (cur && !btor_hashint_table_contains (res, cur->id))
+    {
+      btor_hashint_table_add (res, cur->id);
+      cur = cur->simplified ? btor_node_real_addr (cur->simplified) : 0;
+    }
+  }
+  BTOR_RELEASE_STACK (visit);
+  return res;
+}
+
+static void
+mark_uc (Btor *btor, BtorIntHashTable *uc, BtorNode *exp, bool record)
 {
   assert (btor_node_is_regular (exp));
   /* no inputs allowed here */
@@ -76,6 +144,7 @@ mark_uc (Btor *btor, BtorIntHashTable *uc, BtorNode *exp)
   else
     subst = btor_exp_var (btor, btor_node_get_sort_id (exp), 0);
 
+  if (record) record_uc (btor, uc, exp, subst);
   btor_insert_substitution (btor, exp, subst, false);
   btor_node_release (btor, subst);
 }
@@ -85,12 +154,10 @@ btor_optimize_unconstrained (Btor *btor)
 {
   assert (btor);
   assert (btor_opt_get (btor, BTOR_OPT_REWRITE_LEVEL) > 2);
-  assert (!btor_opt_get (btor, BTOR_OPT_INCREMENTAL));
-  assert (!btor_opt_get (btor, BTOR_OPT_MODEL_GEN));
 
   double start, delta;
   uint32_t i, num_ucs;
-  bool uc[3], ucp[3];
+  bool uc[3], ucp[3], bv_only;
   BtorNode *cur, *cur_parent;
   BtorNodePtrStack stack, roots;
   BtorPtrHashTableIterator it;
@@ -99,6 +166,7 @@ btor_optimize_unconstrained (Btor *btor)
   BtorIntHashTable *ucs;  /* unconstrained candidate nodes */
   BtorIntHashTable *ucsp; /* parameterized unconstrained candidate nodes */
   BtorIntHashTable *mark;
+  BtorIntHashTable *ext; /* nodes the user may refer to (incremental only) */
   BtorHashTableData *d;
 
   if (btor->bv_vars->count == 0 && btor->ufs->count == 0) return;
@@ -116,6 +184,18 @@ btor_optimize_unconstrained (Btor *btor)
   ucsp = btor_hashint_table_new (mm);
   btor_init_substitutions (btor);
 
+  /* In incremental mode, nodes the user may still refer to may get new
+   * parents (and thus constraints) in later calls and are therefore never
+   * considered as unconstrained.  All other nodes cannot be reached by the
+   * user anymore, hence their substitution is valid in every later context
+   * (push/pop included) and does not have to be undone.  In incremental
+   * mode and with model generation, only bit-vector terms are considered and
+   * recorded in order to reconstruct the values of their unconstrained
+   * inputs (see btor_reconstruct_unconstrained). */
+  ext     = btor_opt_get (btor, BTOR_OPT_INCREMENTAL) ? collect_external (btor)
+                                                      : 0;
+  bv_only = ext || btor_opt_get (btor, BTOR_OPT_MODEL_GEN);
+
   /* collect nodes that might contribute to a unconstrained candidate
    * propagation */
   btor_iter_hashptr_init (&it, btor->bv_vars);
@@ -126,6 +206,8 @@ btor_optimize_unconstrained (Btor *btor)
     assert (btor_node_is_regular (cur));
 
     if (btor_node_is_simplified (cur)) continue;
+    if (ext && btor_hashint_table_contains (ext, cur->id)) continue;
+    if (bv_only && btor_node_is_uf (cur)) continue;
 
     if (cur->parents == 1)
     {
@@ -191,7 +273,11 @@ btor_optimize_unconstrained (Btor *btor)
       btor_hashint_map_remove (mark, cur->id, 0);
 
       /* propagate unconstrained candidates */
-      if (cur->parents == 0 || (cur->parents == 1 && !cur->constraint))
+      if ((cur->parents == 0 || (cur->parents == 1 && !cur->constraint))
+          && (!ext || !btor_hashint_table_contains (ext, cur->id))
+          && (!bv_only
+              || (!cur->parameterized && !btor_node_is_fun (cur)
+                  && !btor_node_is_apply (cur) && !btor_node_is_fun_eq (cur))))
       {
         for (i = 0; i < cur->arity; i++)
         {
@@ -212,17 +298,17 @@ btor_optimize_unconstrained (Btor *btor)
             {
               if (cur->parameterized)
               {
-                if (btor_node_is_apply (cur)) mark_uc (btor, ucsp, cur);
+                if (btor_node_is_apply (cur)) mark_uc (btor, ucsp, cur, false);
               }
               else
-                mark_uc (btor, ucs, cur);
+                mark_uc (btor, ucs, cur, bv_only);
             }
             break;
           case BTOR_BV_ADD_NODE:
           case BTOR_BV_EQ_NODE:
           case BTOR_FUN_EQ_NODE:
             if (!cur->parameterized && (uc[0] || uc[1]))
-              mark_uc (btor, ucs, cur);
+              mark_uc (btor, ucs, cur, bv_only);
             break;
           case BTOR_BV_ULT_NODE:
           case BTOR_BV_CONCAT_NODE:
@@ -232,19 +318,20 @@ btor_optimize_unconstrained (Btor *btor)
           case BTOR_BV_SRL_NODE:
           case BTOR_BV_UDIV_NODE:
           case BTOR_BV_UREM_NODE:
-            if (!cur->parameterized && uc[0] && uc[1]) mark_uc (btor, ucs, cur);
+            if (!cur->parameterized && uc[0] && uc[1])
+              mark_uc (btor, ucs, cur, bv_only);
             break;
           case BTOR_COND_NODE:
             if ((uc[1] && uc[2]) || (uc[0] && (uc[1] || uc[2])))
-              mark_uc (btor, ucs, cur);
+              mark_uc (btor, ucs, cur, bv_only);
             else if (uc[1] && ucp[2])
             {
               /* case: x = t ? uc : ucp */
-              if (is_uc_write (cur)) mark_uc (btor, ucsp, cur);
+              if (is_uc_write (cur)) mark_uc (btor, ucsp, cur, false);
             }
             break;
           case BTOR_UPDATE_NODE:
-            if (uc[0] && uc[2]) mark_uc (btor, ucs, cur);
+            if (uc[0] && uc[2]) mark_uc (btor, ucs, cur, bv_only);
             break;
           // TODO (ma): functions with parents > 1 can still be
           //            handled as unconstrained, but the applications
@@ -256,7 +343,7 @@ btor_optimize_unconstrained (Btor *btor)
                 /* only consider head lambda of curried lambdas */
                 && (!cur->first_parent
                     || !btor_node_is_lambda (cur->first_parent)))
-              mark_uc (btor, ucs, cur);
+              mark_uc (btor, ucs, cur, bv_only);
             break;
           default: break;
         }
@@ -272,6 +359,7 @@ btor_optimize_unconstrained (Btor *btor)
   btor_delete_substitutions (btor);
   btor_hashint_table_delete (ucs);
   btor_hashint_table_delete (ucsp);
+  if (ext) btor_hashint_table_delete (ext);
   BTOR_RELEASE_STACK (stack);
   BTOR_RELEASE_STACK (roots);
 
@@ -287,3 +375,176 @@ btor_optimize_unconstrained (Btor *btor)
   assert (btor_dbg_check_all_hash_tables_simp_free (btor));
   assert (btor_dbg_check_unique_table_children_proxy_free (btor));
 }
+
+/*------------------------------------------------------------------------*/
+
+static void
+set_model_value (Btor *btor,
+                 BtorIntHashTable *bv_model,
+                 BtorNode *exp,
+                 const BtorBitVector *value)
+{
+  assert (btor_node_is_regular (exp));
+  assert (btor_node_is_bv_var (exp));
+  assert (!btor_node_is_simplified (exp));
+
+  BtorHashTableData *d, dd;
+
+  if ((d = btor_hashint_map_get (bv_model, exp->id)))
+  {
+    btor_bv_free (btor->mm, d->as_ptr);
+    d->as_ptr = btor_bv_copy (btor->mm, value);
+  }
+  else
+    btor_model_add_to_bv (btor, bv_model, exp, value);
+
+  /* invalidate cached assignment of inverted exp */
+  if (btor_hashint_map_contains (bv_model, -exp->id))
+  {
+    btor_hashint_map_remove (bv_model, -exp->id, &dd);
+    btor_bv_free (btor->mm, dd.as_ptr);
+    btor_node_release (btor, btor_node_invert (exp));
+  }
+}
+
+/* Assign 'value' to unconstrained child 'exp' of a recorded term.  If 'exp'
+ * is a recorded term itself, its fresh variable gets the assignment. */
+static void
+set_uc_value (Btor *btor,
+              BtorIntHashTable *bv_model,
+              BtorIntHashTable *uc_terms,
+              BtorNode *exp,
+              const BtorBitVector *value)
+{
+  BtorHashTableData *d;
+  BtorBitVector *inv;
+  BtorNode *real_exp;
+
+  real_exp = btor_node_real_addr (exp);
+  if ((d = btor_hashint_map_get (uc_terms, real_exp->id)))
+    real_exp = ((BtorUCTerm *) d->as_ptr)->subst;
+  assert (btor_node_is_regular (real_exp));
+
+  if (btor_node_is_inverted (exp))
+  {
+    inv = btor_bv_not (btor->mm, value);
+    set_model_value (btor, bv_model, real_exp, inv);
+    btor_bv_free (btor->mm, inv);
+  }
+  else
+    set_model_value (btor, bv_model, real_exp, value);
+}
+
+void
+btor_reconstruct_unconstrained (Btor *btor,
+                                BtorIntHashTable *bv_model,
+                                BtorIntHashTable *fun_model)
+{
+  assert (btor);
+  assert (bv_model);
+  assert (fun_model);
+
+  uint32_t i, j, w;
+  BtorMemMgr *mm;
+  BtorUCTerm *uc_term;
+  BtorIntHashTable *uc_terms;
+  const BtorBitVector *t, *vals[3];
+  BtorBitVector *res[3];
+
+  if (BTOR_EMPTY_STACK (btor->uc_terms)) return;
+
+  mm       = btor->mm;
+  uc_terms = btor_hashint_map_new (mm);
+  for (i = 0; i < BTOR_COUNT_STACK (btor->uc_terms); i++)
+  {
+    uc_term = BTOR_PEEK_STACK (btor->uc_terms, i);
+    btor_hashint_map_add (uc_terms, uc_term->exp->id)->as_ptr = uc_term;
+  }
+
+  /* Terms are recorded bottom-up, hence processing them in reverse order
+   * determines the value of a term before the values of its children.  The
+   * value of a term is the value of its fresh variable, the values of its
+   * unconstrained children are chosen such that the term evaluates to this
+   * value.  Unconstrained children only occur in the recorded term, hence
+   * changing their values does not affect the rest of the model. */
+  for (i = BTOR_COUNT_STACK (btor->uc_terms); i > 0; i--)
+  {
+    uc_term = BTOR_PEEK_STACK (btor->uc_terms, i - 1);
+    t = btor_model_get_bv_aux (btor, bv_model, fun_model, uc_term->subst);
+    for (j = 0; j < uc_term->arity; j++)
+    {
+      vals[j] =
+          btor_model_get_bv_aux (btor, bv_model, fun_model, uc_term->e[j]);
+      res[j] = 0;
+    }
+
+    switch (uc_term->kind)
+    {
+      case BTOR_BV_SLICE_NODE:
+        res[0] = btor_bv_copy (mm, vals[0]);
+        for (j = uc_term->lower; j <= uc_term->upper; j++)
+          btor_bv_set_bit (res[0], j, btor_bv_get_bit (t, j - uc_term->lower));
+        break;
+      case BTOR_BV_ADD_NODE:
+        if (uc_term->uc & 1)
+          res[0] = btor_bv_sub (mm, t, vals[1]);
+        else
+          res[1] = btor_bv_sub (mm, t, vals[0]);
+        break;
+      case BTOR_BV_EQ_NODE:
+        j      = uc_term->uc & 1 ? 0 : 1;
+        res[j] = btor_bv_is_true (t) ? btor_bv_copy (mm, vals[1 - j])
+                                     : btor_bv_not (mm, vals[1 - j]);
+        break;
+      case BTOR_BV_ULT_NODE:
+        w      = btor_bv_get_width (vals[0]);
+        res[0] = btor_bv_new (mm, w);
+        res[1] = btor_bv_is_true (t) ? btor_bv_ones (mm, w)
+                                     : btor_bv_new (mm, w);
+        break;
+      case BTOR_BV_CONCAT_NODE:
+        w      = btor_bv_get_width (vals[1]);
+        res[0] = btor_bv_slice (mm, t, btor_bv_get_width (t) - 1, w);
+        res[1] = btor_bv_slice (mm, t, w - 1, 0);
+        break;
+      case BTOR_BV_AND_NODE:
+        res[0] = btor_bv_copy (mm, t);
+        res[1] = btor_bv_ones (mm, btor_bv_get_width (vals[1]));
+        break;
+      case BTOR_BV_MUL_NODE:
+      case BTOR_BV_UDIV_NODE:
+        res[0] = btor_bv_copy (mm, t);
+        res[1] = btor_bv_one (mm, btor_bv_get_width (vals[1]));
+        break;
+      case BTOR_BV_SLL_NODE:
+      case BTOR_BV_SRL_NODE:
+      case BTOR_BV_UREM_NODE:
+        res[0] = btor_bv_copy (mm, t);
+        res[1] = btor_bv_new (mm, btor_bv_get_width (vals[1]));
+        break;
+      default:
+        assert (uc_term->kind == BTOR_COND_NODE);
+        if ((uc_term->uc & 6) == 6)
+        {
+          res[1] = btor_bv_copy (mm, t);
+          res[2] = btor_bv_copy (mm, t);
+        }
+        else
+        {
+          j      = uc_term->uc & 2 ? 1 : 2;
+          res[0] = j == 1 ? btor_bv_one (mm, 1) : btor_bv_new (mm, 1);
+          res[j] = btor_bv_copy (mm, t);
+        }
+    }
+
+    for (j = 0; j < uc_term->arity; j++)
+    {
+      if (!res[j]) continue;
+      assert (uc_term->uc & (1u << j));
+      set_uc_value (btor, bv_model, uc_terms, uc_term->e[j], res[j]);
+      btor_bv_free (mm, res[j]);
+    }
+  }
+
+  btor_hashint_map_delete (uc_terms);
+}
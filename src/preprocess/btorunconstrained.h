@@ -11,6 +11,15 @@
 
 #include "btortypes.h"
 
+#include "utils/btorhashint.h"
+
 void btor_optimize_unconstrained (Btor* btor);
 
+/* Adjust the values of the unconstrained inputs in the given model such that
+ * the terms that were substituted by fresh variables during unconstrained
+ * optimization evaluate to the values of these variables. */
+void btor_reconstruct_unconstrained (Btor* btor,
+                                     BtorIntHashTable* bv_model,
+                                     BtorIntHashTable* fun_model);
+
 #endif
@@ -0,0 +1,301 @@
+/*  Boolector: Satisfiability Modulo Theories (SMT) solver.
+ *
+ *  Copyright (C) 2017 Mathias Preiner.
+ *  Copyright (C) 2017 Aina Niemetz.
+ *
+ *  This file is part of Boolector.
+ *  See COPYING for more information on using this software.
+ */
+
+#ifdef BTOR_USE_CADICAL
+
+#include "cadical.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+extern "C" {
+
+#include "btorabort.h"
+#include "btoropt.h"
+#include "btorsat.h"
+#include "sat/btorcadical.h"
+
+/*------------------------------------------------------------------------*/
+
+class BtorCaDiCaL : public CaDiCaL::Terminator
+{
+ public:
+  CaDiCaL::Solver* solver;
+
+  /* termination callback, CaDiCaL calls terminate () on a connected
+   * Terminator (unlike, e.g., Lingeling, which takes a function pointer) */
+  int32_t (*term_fun) (void*);
+  void* term_state;
+
+  /* assumptions for the next call to sat, and of the last call */
+  std::vector<int32_t> assumptions, last_assumptions;
+  /* result of the last call to sat, 0 after the formula was modified */
+  int32_t result;
+
+  /* CaDiCaL does not copy the solver state (model, failed assumptions) on
+   * 'copy'.  A clone of a solver in SAT or UNSAT state inherits a copy of
+   * the model (indexed by variable) or the failed assumptions, which are
+   * valid until the clone is modified or called. */
+  bool cloned;
+  std::vector<signed char> cloned_vals;
+  std::vector<int32_t> cloned_failed;
+
+  BtorCaDiCaL ()
+      : solver (new CaDiCaL::Solver ()),
+        term_fun (0),
+        term_state (0),
+        result (0),
+        cloned (false)
+  {
+  }
+
+  ~BtorCaDiCaL () { delete solver; }
+
+  bool terminate () { return term_fun && term_fun (term_state); }
+
+  void modified ()
+  {
+    result = 0;
+    if (!cloned) return;
+    cloned = false;
+    cloned_vals.clear ();
+    cloned_failed.clear ();
+  }
+};
+
+/*------------------------------------------------------------------------*/
+
+static void*
+init (BtorSATMgr* smgr)
+{
+  BtorCaDiCaL* res = new BtorCaDiCaL ();
+  if (smgr->inc_required
+      && btor_opt_get (smgr->btor, BTOR_OPT_SAT_ENGINE_CADICAL_FREEZE))
+  {
+    res->solver->set ("checkfrozen", 1);
+  }
+  return res;
+}
+
+static void
+add (BtorSATMgr* smgr, int32_t lit)
+{
+  BtorCaDiCaL* slv = (BtorCaDiCaL*) smgr->solver;
+  slv->modified ();
+  slv->solver->add (lit);
+}
+
+static void
+assume (BtorSATMgr* smgr, int32_t lit)
+{
+  BtorCaDiCaL* slv = (BtorCaDiCaL*) smgr->solver;
+  slv->modified ();
+  slv->assumptions.push_back (lit);
+  slv->solver->assume (lit);
+}
+
+static int32_t
+deref (BtorSATMgr* smgr, int32_t lit)
+{
+  BtorCaDiCaL* slv = (BtorCaDiCaL*) smgr->solver;
+  int32_t val;
+
+  if (slv->cloned && slv->result == 10)
+  {
+    assert ((size_t) abs (lit) < slv->cloned_vals.size ());
+    val = slv->cloned_vals[abs (lit)];
+    return lit < 0 ? -val : val;
+  }
+  val = slv->solver->val (lit);
+  if (val > 0) return 1;
+  if (val < 0) return -1;
+  return 0;
+}
+
+static void
+enable_verbosity (BtorSATMgr* smgr, int32_t level)
+{
+  BtorCaDiCaL* slv = (BtorCaDiCaL*) smgr->solver;
+  if (level <= 1)
+    slv->solver->set ("quiet", 1);
+  else if (level >= 2)
+    slv->solver->set ("verbose", level - 2);
+}
+
+static int32_t
+failed (BtorSATMgr* smgr, int32_t lit)
+{
+  BtorCaDiCaL* slv = (BtorCaDiCaL*) smgr->solver;
+  if (slv->cloned && slv->result == 20)
+    return std::find (
+               slv->cloned_failed.begin (), slv->cloned_failed.end (), lit)
+           != slv->cloned_failed.end ();
+  return slv->solver->failed (lit);
+}
+
+static void
+reset (BtorSATMgr* smgr)
+{
+  BtorCaDiCaL* slv = (BtorCaDiCaL*) smgr->solver;
+  delete slv;
+  smgr->solver = 0;
+}
+
+/* 'limit' is a conflict limit (< 0: no limit) for this call only. */
+static int32_t
+sat (BtorSATMgr* smgr, int32_t limit)
+{
+  BtorCaDiCaL* slv = (BtorCaDiCaL*) smgr->solver;
+
+  slv->modified ();
+  slv->last_assumptions.swap (slv->assumptions);
+  slv->assumptions.clear ();
+  if (limit >= 0) slv->solver->limit ("conflicts", limit);
+  slv->result = slv->solver->solve ();
+  return slv->result;
+}
+
+static void
+setterm (BtorSATMgr* smgr)
+{
+  BtorCaDiCaL* slv = (BtorCaDiCaL*) smgr->solver;
+  slv->term_fun    = smgr->term.fun;
+  slv->term_state  = smgr->term.state;
+  if (slv->term_fun)
+    slv->solver->connect_terminator (slv);
+  else
+    slv->solver->disconnect_terminator ();
+}
+
+static void
+stats (BtorSATMgr* smgr)
+{
+  BtorCaDiCaL* slv = (BtorCaDiCaL*) smgr->solver;
+  slv->solver->statistics ();
+}
+
+/* CaDiCaL only copies irredundant clauses, units and options, but neither
+ * learned clauses, frozen variables, assumptions nor the result of the last
+ * call. */
+static void*
+clone (Btor* btor, BtorSATMgr* smgr)
+{
+  (void) btor;
+
+  BtorCaDiCaL *slv, *res;
+  int32_t var, maxvar;
+  size_t i;
+
+  slv = (BtorCaDiCaL*) smgr->solver;
+
+  /* not initialized yet */
+  if (!slv) return 0;
+
+  res = new BtorCaDiCaL ();
+  slv->solver->copy (*res->solver);
+
+  maxvar = slv->solver->vars ();
+  for (var = 1; var <= maxvar; var++)
+    if (slv->solver->frozen (var)) res->solver->freeze (var);
+
+  res->assumptions      = slv->assumptions;
+  res->last_assumptions = slv->last_assumptions;
+  for (i = 0; i < res->assumptions.size (); i++)
+    res->solver->assume (res->assumptions[i]);
+
+  res->result = slv->result;
+  if (slv->cloned)
+  {
+    res->cloned_vals   = slv->cloned_vals;
+    res->cloned_failed = slv->cloned_failed;
+  }
+  else if (slv->result == 10)
+  {
+    res->cloned_vals.resize (maxvar + 1, 0);
+    for (var = 1; var <= maxvar; var++)
+      res->cloned_vals[var] = slv->solver->val (var) > 0 ? 1 : -1;
+  }
+  else if (slv->result == 20)
+  {
+    for (i = 0; i < slv->last_assumptions.size (); i++)
+      if (slv->solver->failed (slv->last_assumptions[i]))
+        res->cloned_failed.push_back (slv->last_assumptions[i]);
+  }
+  res->cloned = res->result != 0;
+  return res;
+}
+
+/*------------------------------------------------------------------------*/
+/* incremental API                                                        */
+/*------------------------------------------------------------------------*/
+
+static int32_t
+inc_max_var (BtorSATMgr* smgr)
+{
+  BtorCaDiCaL* slv = (BtorCaDiCaL*) smgr->solver;
+  int32_t var      = smgr->maxvar + 1;
+  if (smgr->inc_required) slv->solver->freeze (var);
+  return var;
+}
+
+static void
+melt (BtorSATMgr* smgr, int32_t lit)
+{
+  BtorCaDiCaL* slv = (BtorCaDiCaL*) smgr->solver;
+  if (smgr->inc_required) slv->solver->melt (lit);
+}
+
+/*------------------------------------------------------------------------*/
+
+bool
+btor_sat_enable_cadical (BtorSATMgr* smgr)
+{
+  assert (smgr != NULL);
+
+  BTOR_ABORT (smgr->initialized,
+              "'btor_sat_init' called before 'btor_sat_enable_cadical'");
+
+  smgr->name = "CaDiCaL";
+
+  BTOR_CLR (&smgr->api);
+  smgr->api.add              = add;
+  smgr->api.assume           = assume;
+  smgr->api.clone            = clone;
+  smgr->api.deref            = deref;
+  smgr->api.enable_verbosity = enable_verbosity;
+  smgr->api.failed           = failed;
+  smgr->api.fixed            = 0;
+  smgr->api.inc_max_var      = 0;
+  smgr->api.init             = init;
+  smgr->api.melt             = 0;
+  smgr->api.repr             = 0;
+  smgr->api.reset            = reset;
+  smgr->api.sat              = sat;
+  smgr->api.set_output       = 0;
+  smgr->api.set_prefix       = 0;
+  smgr->api.stats            = stats;
+  smgr->api.setterm          = setterm;
+
+  if (btor_opt_get (smgr->btor, BTOR_OPT_SAT_ENGINE_CADICAL_FREEZE))
+  {
+    smgr->api.inc_max_var = inc_max_var;
+    smgr->api.melt        = melt;
+  }
+  else
+  {
+    smgr->have_restore = true;
+  }
+
+  return true;
+}
+};
+#endif
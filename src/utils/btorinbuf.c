@@ -0,0 +1,111 @@
+/*  Boolector: Satisfiability Modulo Theories (SMT) solver.
+ *
+ *  Copyright (C) 2020 Aina Niemetz.
+ *  Copyright (C) 2020 Mathias Preiner.
+ *
+ *  This file is part of Boolector.
+ *  See COPYING for more information on using this software.
+ */
+
+#include "utils/btorinbuf.h"
+
+#include <assert.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/*------------------------------------------------------------------------*/
+
+void
+btor_inbuf_init (BtorMemMgr *mm, BtorInBuf *ib, FILE *file)
+{
+  assert (mm);
+  assert (ib);
+  assert (file);
+
+  struct stat st;
+  off_t offset;
+  void *map;
+
+  BTOR_CLR (ib);
+  ib->mm   = mm;
+  ib->file = file;
+  ib->mode = BTOR_INBUF_MODE_GETC;
+
+  if (fstat (fileno (file), &st) || !S_ISREG (st.st_mode)) return;
+  if ((offset = ftello (file)) < 0) return;
+
+  ib->offset = offset;
+  ib->mode   = BTOR_INBUF_MODE_BLOCK;
+
+  if (offset >= st.st_size)
+  {
+    /* nothing left to read */
+    ib->mode = BTOR_INBUF_MODE_MMAP;
+    return;
+  }
+
+  map = mmap (0, st.st_size, PROT_READ, MAP_PRIVATE, fileno (file), 0);
+  if (map == MAP_FAILED) return;
+#ifdef MADV_SEQUENTIAL
+  (void) madvise (map, st.st_size, MADV_SEQUENTIAL);
+#endif
+  ib->mode     = BTOR_INBUF_MODE_MMAP;
+  ib->map      = map;
+  ib->map_size = st.st_size;
+  ib->start    = (const unsigned char *) map + offset;
+  ib->cur      = ib->start;
+  ib->end      = (const unsigned char *) map + st.st_size;
+}
+
+void
+btor_inbuf_release (BtorInBuf *ib)
+{
+  assert (ib);
+
+  if (!ib->file) return;
+  if (ib->mode != BTOR_INBUF_MODE_GETC)
+    (void) fseeko (ib->file, ib->offset + btor_inbuf_bytes (ib), SEEK_SET);
+  if (ib->map) munmap (ib->map, ib->map_size);
+  if (ib->block) BTOR_DELETEN (ib->mm, ib->block, BTOR_INBUF_BLOCK_SIZE);
+  BTOR_CLR (ib);
+}
+
+int32_t
+btor_inbuf_fill (BtorInBuf *ib)
+{
+  assert (ib);
+  assert (ib->cur == ib->end);
+
+  int32_t ch;
+  size_t n;
+
+  switch (ib->mode)
+  {
+    case BTOR_INBUF_MODE_MMAP: return EOF;
+
+    case BTOR_INBUF_MODE_BLOCK:
+      if (!ib->block) BTOR_NEWN (ib->mm, ib->block, BTOR_INBUF_BLOCK_SIZE);
+      ib->bytes += ib->end - ib->start;
+      n = fread (ib->block, 1, BTOR_INBUF_BLOCK_SIZE, ib->file);
+      ib->start = ib->cur = ib->block;
+      ib->end             = ib->block + n;
+      if (!n) return EOF;
+      return *ib->cur++;
+
+    default:
+      assert (ib->mode == BTOR_INBUF_MODE_GETC);
+      /* Note: the unlocked version avoids locking the stream for every
+       *       character, the stream is not shared while parsing */
+      ch = getc_unlocked (ib->file);
+      if (ch != EOF) ib->bytes += 1;
+      return ch;
+  }
+}
+
+uint64_t
+btor_inbuf_bytes (BtorInBuf *ib)
+{
+  assert (ib);
+  return ib->bytes + (ib->cur - ib->start);
+}
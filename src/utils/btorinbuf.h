@@ -0,0 +1,83 @@
+/*  Boolector: Satisfiability Modulo Theories (SMT) solver.
+ *
+ *  Copyright (C) 2020 Aina Niemetz.
+ *  Copyright (C) 2020 Mathias Preiner.
+ *
+ *  This file is part of Boolector.
+ *  See COPYING for more information on using this software.
+ */
+
+#ifndef BTORINBUF_H_INCLUDED
+#define BTORINBUF_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "utils/btormem.h"
+
+/*------------------------------------------------------------------------*/
+
+/* Size of the blocks read if a regular file can not be mapped. */
+#define BTOR_INBUF_BLOCK_SIZE (1 << 20)
+
+enum BtorInBufMode
+{
+  BTOR_INBUF_MODE_MMAP,  /* regular file, mapped into memory */
+  BTOR_INBUF_MODE_BLOCK, /* regular file, read in blocks */
+  BTOR_INBUF_MODE_GETC,  /* pipe, terminal, ... (possibly interactive) */
+};
+typedef enum BtorInBufMode BtorInBufMode;
+
+/**
+ * Input layer of the parsers.
+ *
+ * Regular files are mapped into memory (or read in large blocks if mapping
+ * fails), all other input (pipes, compressed input, interactive stdin) is
+ * read character by character without locking the stream since a parser
+ * must not block on input that is not yet needed.
+ *
+ * Reading starts at the current position of the given stream, characters
+ * that were already read from the stream (e.g., a prefix read to determine
+ * the input format) are not read again.
+ */
+struct BtorInBuf
+{
+  BtorMemMgr *mm;
+  FILE *file;
+  BtorInBufMode mode;
+  const unsigned char *cur, *end; /* unread part of current block */
+  const unsigned char *start;     /* start of current block */
+  uint64_t bytes;                 /* bytes read before current block */
+  int64_t offset;                 /* file offset where reading started */
+  void *map;                      /* mapped file */
+  size_t map_size;
+  unsigned char *block; /* block buffer */
+};
+typedef struct BtorInBuf BtorInBuf;
+
+/* Initialize input buffer for reading from given file. */
+void btor_inbuf_init (BtorMemMgr *mm, BtorInBuf *ib, FILE *file);
+
+/* Release input buffer (if initialized), repositions the file after the last
+ * read character if it is a regular file. */
+void btor_inbuf_release (BtorInBuf *ib);
+
+/* Refill buffer (or read next character in getc mode), returns the next
+ * character or EOF. Use btor_inbuf_getc. */
+int32_t btor_inbuf_fill (BtorInBuf *ib);
+
+/* Return the number of bytes read so far. */
+uint64_t btor_inbuf_bytes (BtorInBuf *ib);
+
+/* Read next character, returns EOF at end of input. */
+static inline int32_t
+btor_inbuf_getc (BtorInBuf *ib)
+{
+  if (ib->cur < ib->end) return *ib->cur++;
+  return btor_inbuf_fill (ib);
+}
+
+/*------------------------------------------------------------------------*/
+
+#endif
@@ -63,6 +63,8 @@ btor_mem_mgr_new (void)
   mm->maxallocated     = 0;
   mm->sat_allocated    = 0;
   mm->sat_maxallocated = 0;
+  mm->slab_allocated   = 0;
+  memset (mm->slabs, 0, sizeof mm->slabs);
   return mm;
 }
 
@@ -158,6 +160,131 @@ btor_mem_sat_free (BtorMemMgr *mm, void *p, size_t freed)
   free (p);
 }
 
+/*------------------------------------------------------------------------*/
+
+/* Chunks start with a pointer to the next chunk, padded such that objects
+ * are aligned to BTOR_MEM_SLAB_ALIGN. */
+#define BTOR_MEM_SLAB_CHUNK_HEADER                                    \
+  ((sizeof (void *) + BTOR_MEM_SLAB_ALIGN - 1) / BTOR_MEM_SLAB_ALIGN \
+   * BTOR_MEM_SLAB_ALIGN)
+
+static size_t
+slab_size (size_t size)
+{
+  return (size + BTOR_MEM_SLAB_ALIGN - 1) / BTOR_MEM_SLAB_ALIGN
+         * BTOR_MEM_SLAB_ALIGN;
+}
+
+static BtorMemSlab *
+get_slab (BtorMemMgr *mm, size_t size)
+{
+  assert (size > 0);
+  assert (size <= BTOR_MEM_SLAB_MAX_SIZE);
+  return &mm->slabs[(size - 1) / BTOR_MEM_SLAB_ALIGN];
+}
+
+static void
+new_slab_chunk (BtorMemMgr *mm, BtorMemSlab *slab, size_t size)
+{
+  char *chunk;
+  size_t nobjs;
+
+  chunk = malloc (BTOR_MEM_SLAB_CHUNK_SIZE);
+  BTOR_ABORT (!chunk, "out of memory in 'btor_mem_slab_malloc'");
+  *(void **) chunk = slab->chunks;
+  slab->chunks     = chunk;
+  nobjs = (BTOR_MEM_SLAB_CHUNK_SIZE - BTOR_MEM_SLAB_CHUNK_HEADER) / size;
+  slab->top = chunk + BTOR_MEM_SLAB_CHUNK_HEADER;
+  slab->end = slab->top + nobjs * size;
+  slab->num_chunks += 1;
+  slab->num_objs += nobjs;
+  mm->slab_allocated += BTOR_MEM_SLAB_CHUNK_SIZE;
+}
+
+void *
+btor_mem_slab_malloc (BtorMemMgr *mm, size_t size)
+{
+  assert (mm);
+
+  void *result;
+  BtorMemSlab *slab;
+
+  if (!size) return 0;
+  if (size > BTOR_MEM_SLAB_MAX_SIZE) return btor_mem_malloc (mm, size);
+
+  slab = get_slab (mm, size);
+  if (slab->free)
+  {
+    result     = slab->free;
+    slab->free = *(void **) result;
+  }
+  else
+  {
+    if (slab->top == slab->end) new_slab_chunk (mm, slab, slab_size (size));
+    result = slab->top;
+    slab->top += slab_size (size);
+    assert (slab->top <= slab->end);
+  }
+  slab->num_used += 1;
+  mm->allocated += size;
+  ADJUST ();
+  BTOR_LOG_MEM ("%p malloc %10ld (slab)\n", result, size);
+  return result;
+}
+
+void *
+btor_mem_slab_calloc (BtorMemMgr *mm, size_t size)
+{
+  void *result = btor_mem_slab_malloc (mm, size);
+  if (result) memset (result, 0, size);
+  return result;
+}
+
+void
+btor_mem_slab_free (BtorMemMgr *mm, void *p, size_t freed)
+{
+  assert (mm);
+  assert (!p == !freed);
+  assert (mm->allocated >= freed);
+
+  BtorMemSlab *slab;
+
+  if (!p) return;
+  if (freed > BTOR_MEM_SLAB_MAX_SIZE)
+  {
+    btor_mem_free (mm, p, freed);
+    return;
+  }
+
+  slab = get_slab (mm, freed);
+  assert (slab->num_used > 0);
+  *(void **) p = slab->free;
+  slab->free   = p;
+  slab->num_used -= 1;
+  mm->allocated -= freed;
+  BTOR_LOG_MEM ("%p free   %10ld (slab)\n", p, freed);
+}
+
+static void
+release_slabs (BtorMemMgr *mm)
+{
+  uint32_t i;
+  void *chunk, *next;
+
+  for (i = 0; i < BTOR_MEM_SLAB_NUM_CLASSES; i++)
+  {
+    for (chunk = mm->slabs[i].chunks; chunk; chunk = next)
+    {
+      next = *(void **) chunk;
+      free (chunk);
+    }
+  }
+  memset (mm->slabs, 0, sizeof mm->slabs);
+  mm->slab_allocated = 0;
+}
+
+/*------------------------------------------------------------------------*/
+
 char *
 btor_mem_strdup (BtorMemMgr *mm, const char *str)
 {
@@ -185,6 +312,7 @@ btor_mem_mgr_delete (BtorMemMgr *mm)
 {
   assert (mm);
   assert (getenv ("BTORLEAK") || getenv ("BTORLEAKMEM") || !mm->allocated);
+  release_slabs (mm);
   free (mm);
 }
 
@@ -65,14 +65,58 @@
     (n) = internaln;                          \
   } while (0)
 
+/* Allocation of small fixed-size objects (nodes, AIGs) from size-class slab
+ * pools.  Objects must be released with the same size they were allocated
+ * with.  The slabs of all pools are released in bulk when the memory manager
+ * is deleted. */
+
+#define BTOR_SLAB_NEW(mm, ptr)                                        \
+  do                                                                  \
+  {                                                                   \
+    (ptr) = (typeof(ptr)) btor_mem_slab_malloc ((mm), sizeof *(ptr)); \
+  } while (0)
+
+#define BTOR_SLAB_CNEW(mm, ptr)                                       \
+  do                                                                  \
+  {                                                                   \
+    (ptr) = (typeof(ptr)) btor_mem_slab_calloc ((mm), sizeof *(ptr)); \
+  } while (0)
+
+#define BTOR_SLAB_DELETE(mm, ptr)                    \
+  do                                                 \
+  {                                                  \
+    btor_mem_slab_free ((mm), (ptr), sizeof *(ptr)); \
+  } while (0)
+
 /*------------------------------------------------------------------------*/
 
+/* Objects are rounded up to a multiple of BTOR_MEM_SLAB_ALIGN bytes, one pool
+ * per size class.  Larger objects are allocated via malloc. */
+#define BTOR_MEM_SLAB_ALIGN 8
+#define BTOR_MEM_SLAB_MAX_SIZE 256
+#define BTOR_MEM_SLAB_NUM_CLASSES (BTOR_MEM_SLAB_MAX_SIZE / BTOR_MEM_SLAB_ALIGN)
+#define BTOR_MEM_SLAB_CHUNK_SIZE (64 * 1024)
+
+struct BtorMemSlab
+{
+  void *free;      /* list of released objects */
+  void *chunks;    /* list of chunks, linked via their first word */
+  char *top, *end; /* unused part of the most recent chunk */
+  size_t num_chunks;
+  size_t num_used; /* objects currently in use */
+  size_t num_objs; /* capacity of all chunks */
+};
+
+typedef struct BtorMemSlab BtorMemSlab;
+
 struct BtorMemMgr
 {
   size_t allocated;
   size_t maxallocated;
   size_t sat_allocated;
   size_t sat_maxallocated;
+  size_t slab_allocated; /* bytes allocated for slab chunks */
+  BtorMemSlab slabs[BTOR_MEM_SLAB_NUM_CLASSES];
 };
 
 typedef struct BtorMemMgr BtorMemMgr;
@@ -97,6 +141,12 @@ void *btor_mem_calloc (BtorMemMgr *mm, size_t nobj, size_t size);
 
 void btor_mem_free (BtorMemMgr *mm, void *p, size_t freed);
 
+void *btor_mem_slab_malloc (BtorMemMgr *mm, size_t size);
+
+void *btor_mem_slab_calloc (BtorMemMgr *mm, size_t size);
+
+void btor_mem_slab_free (BtorMemMgr *mm, void *p, size_t size);
+
 char *btor_mem_strdup (BtorMemMgr *mm, const char *str);
 
 void btor_mem_freestr (BtorMemMgr *mm, char *str);
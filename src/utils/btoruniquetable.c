@@ -0,0 +1,323 @@
+/*  Boolector: Satisfiability Modulo Theories (SMT) solver.
+ *
+ *  Copyright (C) 2020 Aina Niemetz.
+ *  Copyright (C) 2020 Mathias Preiner.
+ *
+ *  This file is part of Boolector.
+ *  See COPYING for more information on using this software.
+ */
+
+#include "utils/btoruniquetable.h"
+
+#include "btorabort.h"
+
+#include <assert.h>
+#include <string.h>
+
+/*------------------------------------------------------------------------*/
+
+#define BTOR_UNIQUE_TABLE_INIT_LOG 4
+
+/* Number of slots of the old table that are moved into the new table per
+ * insertion.  The resize has to be finished before the new table reaches its
+ * load limit, i.e., after (3/4 * 2 * size - 3/4 * size) insertions, which
+ * requires moving at least 4/3 slots per insertion. */
+#define BTOR_UNIQUE_TABLE_MOVE 4
+
+#define BTOR_UNIQUE_TABLE_DELETED -1
+
+/*------------------------------------------------------------------------*/
+
+/* Fibonacci hashing, uses the upper bits of the product to scatter hash
+ * values that only differ in their upper bits. */
+static inline uint32_t
+home_pos (uint32_t hash, uint32_t shift)
+{
+  return (uint32_t) (hash * 2654435769u) >> shift;
+}
+
+static inline bool
+is_full (const BtorUniqueTable *table)
+{
+  return 4 * ((uint64_t) table->num_elements + 1) > 3 * (uint64_t) table->size;
+}
+
+static int32_t
+find_slots (const BtorUniqueTableSlot *slots,
+            uint32_t size,
+            uint32_t shift,
+            uint32_t hash,
+            BtorUniqueTableEqual equal,
+            void *state)
+{
+  int32_t id;
+  uint32_t pos, mask;
+
+  mask = size - 1;
+  pos  = home_pos (hash, shift);
+  while ((id = slots[pos].id))
+  {
+    if (id > 0 && slots[pos].hash == hash && equal (state, id)) return id;
+    pos = (pos + 1) & mask;
+  }
+  return 0;
+}
+
+static void
+insert_slots (BtorUniqueTableSlot *slots,
+              uint32_t size,
+              uint32_t shift,
+              int32_t id,
+              uint32_t hash)
+{
+  uint32_t pos, mask;
+
+  mask = size - 1;
+  pos  = home_pos (hash, shift);
+  while (slots[pos].id)
+  {
+    assert (slots[pos].id != id);
+    pos = (pos + 1) & mask;
+  }
+  slots[pos].id   = id;
+  slots[pos].hash = hash;
+}
+
+/* Move 'n' slots of the old table into the new table and release the old
+ * table if all slots have been moved.  Moved entries are marked as deleted
+ * to keep the probe sequences of the remaining entries intact. */
+static void
+move_slots (BtorUniqueTable *table, uint32_t n)
+{
+  assert (table->old_slots);
+
+  BtorUniqueTableSlot *slot;
+
+  while (n-- > 0 && table->old_pos < table->old_size)
+  {
+    slot = table->old_slots + table->old_pos++;
+    if (slot->id > 0)
+    {
+      insert_slots (
+          table->slots, table->size, table->shift, slot->id, slot->hash);
+      slot->id = BTOR_UNIQUE_TABLE_DELETED;
+    }
+  }
+
+  if (table->old_pos == table->old_size)
+  {
+    BTOR_DELETEN (table->mm, table->old_slots, table->old_size);
+    table->old_slots = 0;
+    table->old_size  = 0;
+    table->old_shift = 0;
+    table->old_pos   = 0;
+  }
+}
+
+static void
+start_resize (BtorUniqueTable *table)
+{
+  assert (!table->old_slots);
+  BTOR_ABORT (table->shift <= 1, "unique table overflow");
+
+  table->old_slots = table->slots;
+  table->old_size  = table->size;
+  table->old_shift = table->shift;
+  table->old_pos   = 0;
+
+  table->size *= 2;
+  table->shift -= 1;
+  BTOR_CNEWN (table->mm, table->slots, table->size);
+}
+
+/*------------------------------------------------------------------------*/
+
+void
+btor_uniquetable_init (BtorMemMgr *mm, BtorUniqueTable *table)
+{
+  assert (mm);
+  assert (table);
+
+  memset (table, 0, sizeof *table);
+  table->mm    = mm;
+  table->size  = 1u << BTOR_UNIQUE_TABLE_INIT_LOG;
+  table->shift = 32 - BTOR_UNIQUE_TABLE_INIT_LOG;
+  BTOR_CNEWN (mm, table->slots, table->size);
+}
+
+void
+btor_uniquetable_release (BtorUniqueTable *table)
+{
+  assert (table);
+
+  BTOR_DELETEN (table->mm, table->slots, table->size);
+  if (table->old_slots)
+    BTOR_DELETEN (table->mm, table->old_slots, table->old_size);
+  memset (table, 0, sizeof *table);
+}
+
+void
+btor_uniquetable_clone (BtorMemMgr *mm,
+                        const BtorUniqueTable *table,
+                        BtorUniqueTable *res)
+{
+  assert (mm);
+  assert (table);
+  assert (res);
+
+  *res    = *table;
+  res->mm = mm;
+  BTOR_NEWN (mm, res->slots, table->size);
+  memcpy (res->slots, table->slots, table->size * sizeof *table->slots);
+  if (table->old_slots)
+  {
+    BTOR_NEWN (mm, res->old_slots, table->old_size);
+    memcpy (res->old_slots,
+            table->old_slots,
+            table->old_size * sizeof *table->old_slots);
+  }
+}
+
+int32_t
+btor_uniquetable_find (const BtorUniqueTable *table,
+                       uint32_t hash,
+                       BtorUniqueTableEqual equal,
+                       void *state)
+{
+  assert (table);
+  assert (equal);
+
+  int32_t id;
+
+  id = find_slots (table->slots, table->size, table->shift, hash, equal, state);
+  if (!id && table->old_slots)
+    id = find_slots (table->old_slots,
+                     table->old_size,
+                     table->old_shift,
+                     hash,
+                     equal,
+                     state);
+  return id;
+}
+
+void
+btor_uniquetable_insert (BtorUniqueTable *table, int32_t id, uint32_t hash)
+{
+  assert (table);
+  assert (id > 0);
+  assert (table->num_elements < INT32_MAX);
+
+  if (table->old_slots) move_slots (table, BTOR_UNIQUE_TABLE_MOVE);
+  if (is_full (table))
+  {
+    if (table->old_slots) move_slots (table, table->old_size);
+    start_resize (table);
+  }
+  insert_slots (table->slots, table->size, table->shift, id, hash);
+  table->num_elements += 1;
+}
+
+void
+btor_uniquetable_remove (BtorUniqueTable *table, int32_t id, uint32_t hash)
+{
+  assert (table);
+  assert (id > 0);
+  assert (table->num_elements > 0);
+
+  uint32_t i, j, k, mask;
+  BtorUniqueTableSlot *slots;
+
+  table->num_elements -= 1;
+
+  if (table->old_slots)
+  {
+    slots = table->old_slots;
+    mask  = table->old_size - 1;
+    for (i = home_pos (hash, table->old_shift); slots[i].id; i = (i + 1) & mask)
+    {
+      if (slots[i].id == id)
+      {
+        slots[i].id = BTOR_UNIQUE_TABLE_DELETED;
+        return;
+      }
+    }
+  }
+
+  slots = table->slots;
+  mask  = table->size - 1;
+  for (i = home_pos (hash, table->shift); slots[i].id != id; i = (i + 1) & mask)
+    assert (slots[i].id);
+
+  /* Backward shift deletion: move entries of the probe sequence after 'i'
+   * into the gap if the gap is between their home position and their
+   * current position. */
+  slots[i].id = 0;
+  for (j = (i + 1) & mask; slots[j].id; j = (j + 1) & mask)
+  {
+    k = home_pos (slots[j].hash, table->shift);
+    if ((i < j && (k <= i || k > j)) || (i > j && k <= i && k > j))
+    {
+      slots[i]    = slots[j];
+      slots[j].id = 0;
+      i           = j;
+    }
+  }
+}
+
+size_t
+btor_uniquetable_bytes (const BtorUniqueTable *table)
+{
+  assert (table);
+  return ((size_t) table->size + table->old_size) * sizeof *table->slots;
+}
+
+/*------------------------------------------------------------------------*/
+
+static void
+find_next_slot (BtorUniqueTableIterator *it)
+{
+  for (;;)
+  {
+    while (it->pos < it->size && it->slots[it->pos].id <= 0) it->pos++;
+    if (it->pos < it->size || it->slots != it->table->slots) break;
+    /* continue with the old table if resizing is in progress */
+    if (!it->table->old_slots) break;
+    it->slots = it->table->old_slots;
+    it->size  = it->table->old_size;
+    it->pos   = it->table->old_pos;
+  }
+}
+
+void
+btor_iter_uniquetable_init (BtorUniqueTableIterator *it,
+                            const BtorUniqueTable *table)
+{
+  assert (it);
+  assert (table);
+
+  it->table = table;
+  it->slots = table->slots;
+  it->size  = table->size;
+  it->pos   = 0;
+  find_next_slot (it);
+}
+
+bool
+btor_iter_uniquetable_has_next (const BtorUniqueTableIterator *it)
+{
+  assert (it);
+  return it->pos < it->size;
+}
+
+int32_t
+btor_iter_uniquetable_next (BtorUniqueTableIterator *it)
+{
+  assert (it);
+  assert (btor_iter_uniquetable_has_next (it));
+
+  int32_t res;
+
+  res = it->slots[it->pos++].id;
+  find_next_slot (it);
+  return res;
+}
@@ -0,0 +1,112 @@
+/*  Boolector: Satisfiability Modulo Theories (SMT) solver.
+ *
+ *  Copyright (C) 2020 Aina Niemetz.
+ *  Copyright (C) 2020 Mathias Preiner.
+ *
+ *  This file is part of Boolector.
+ *  See COPYING for more information on using this software.
+ */
+
+#ifndef BTORUNIQUETABLE_H_INCLUDED
+#define BTORUNIQUETABLE_H_INCLUDED
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "utils/btormem.h"
+
+/*------------------------------------------------------------------------*/
+
+/* Hash-consing table for nodes and AIGs.
+ *
+ * The table stores positive ids together with their (cached) hash value in
+ * one array with open addressing and linear probing.  Equality of entries is
+ * determined by the user via a callback, which is only called for entries
+ * with a matching cached hash value.
+ *
+ * The table is resized incrementally: if the load factor exceeds 3/4, a table
+ * of twice the size is allocated and subsequent insertions move a constant
+ * number of slots of the old table into the new one, until the old table is
+ * empty.  Lookups and removals consider both tables while resizing. */
+
+struct BtorUniqueTableSlot
+{
+  int32_t id; /* 0 if empty, < 0 if deleted (only in old table) */
+  uint32_t hash;
+};
+
+typedef struct BtorUniqueTableSlot BtorUniqueTableSlot;
+
+struct BtorUniqueTable
+{
+  BtorMemMgr *mm;
+  uint32_t size;         /* number of slots, power of 2 */
+  uint32_t shift;        /* 32 - log2 (size) */
+  uint32_t num_elements; /* number of ids in both tables */
+  BtorUniqueTableSlot *slots;
+
+  /* table that is moved into 'slots' during resizing */
+  uint32_t old_size;
+  uint32_t old_shift;
+  uint32_t old_pos; /* next slot to move */
+  BtorUniqueTableSlot *old_slots;
+};
+
+typedef struct BtorUniqueTable BtorUniqueTable;
+
+typedef bool (*BtorUniqueTableEqual) (void *state, int32_t id);
+
+/*------------------------------------------------------------------------*/
+
+void btor_uniquetable_init (BtorMemMgr *mm, BtorUniqueTable *table);
+
+void btor_uniquetable_release (BtorUniqueTable *table);
+
+/* Initialize 'res' as a copy of 'table'. */
+void btor_uniquetable_clone (BtorMemMgr *mm,
+                             const BtorUniqueTable *table,
+                             BtorUniqueTable *res);
+
+/* Returns the id of an entry with given hash value for which 'equal' returns
+ * true, and 0 if there is no such entry. */
+int32_t btor_uniquetable_find (const BtorUniqueTable *table,
+                               uint32_t hash,
+                               BtorUniqueTableEqual equal,
+                               void *state);
+
+/* Insert 'id' with given hash value, 'id' must not be in the table. */
+void btor_uniquetable_insert (BtorUniqueTable *table,
+                              int32_t id,
+                              uint32_t hash);
+
+/* Remove 'id', which has to be in the table with given hash value. */
+void btor_uniquetable_remove (BtorUniqueTable *table,
+                              int32_t id,
+                              uint32_t hash);
+
+/* Returns the size of the table in bytes. */
+size_t btor_uniquetable_bytes (const BtorUniqueTable *table);
+
+/*------------------------------------------------------------------------*/
+/* iterators                                                              */
+/*------------------------------------------------------------------------*/
+
+struct BtorUniqueTableIterator
+{
+  const BtorUniqueTable *table;
+  const BtorUniqueTableSlot *slots;
+  uint32_t size;
+  uint32_t pos;
+};
+
+typedef struct BtorUniqueTableIterator BtorUniqueTableIterator;
+
+void btor_iter_uniquetable_init (BtorUniqueTableIterator *it,
+                                 const BtorUniqueTable *table);
+
+bool btor_iter_uniquetable_has_next (const BtorUniqueTableIterator *it);
+
+int32_t btor_iter_uniquetable_next (BtorUniqueTableIterator *it);
+
+#endif
@@ -607,9 +607,6 @@ btor_util_file_has_suffix (const char *path, const char *suffix)
     return "buffer exceeded";               \
   }
 
-char g_strbuf[BUFFER_SIZE];
-int32_t g_strbufpos = 0;
-
 char *
 btor_util_node2string (BtorNode *exp)
 {
@@ -670,11 +667,12 @@ btor_util_node2string (BtorNode *exp)
   }
 
   assert (cur_len == strlen (strbuf));
-  if (g_strbufpos + cur_len + 1 > BUFFER_SIZE - 1) g_strbufpos = 0;
+  if (btor->node2string.pos + cur_len + 1 > BTOR_NODE2STRING_BUF_SIZE - 1)
+    btor->node2string.pos = 0;
 
-  bufstart = g_strbuf + g_strbufpos;
+  bufstart = btor->node2string.buf + btor->node2string.pos;
   sprintf (bufstart, "%s", strbuf);
-  g_strbufpos += cur_len + 1;
+  btor->node2string.pos += cur_len + 1;
 
   return bufstart;
 }
@@ -11,7 +11,11 @@
 
 extern "C" {
 #include "btoraig.h"
+#include "btoraigrewrite.h"
+#include "btoraigsweep.h"
+#include "btoropt.h"
 #include "dumper/btordumpaig.h"
+#include "utils/btorhashint.h"
 }
 
 class TestAig : public TestBtor
@@ -145,3 +149,200 @@ TEST_F (TestAig, aig_to_sat)
   btor_aig_release (amgr, and3);
   btor_aig_mgr_delete (amgr);
 }
+
+TEST_F (TestAig, aig_to_sat_pg)
+{
+  btor_opt_set (d_btor, BTOR_OPT_CNF_ENC, BTOR_CNF_ENC_PG);
+  BtorAIGMgr *amgr = btor_aig_mgr_new (d_btor);
+  BtorSATMgr *smgr = btor_aig_get_sat_mgr (amgr);
+  BtorAIG *var1    = btor_aig_var (amgr);
+  BtorAIG *var2    = btor_aig_var (amgr);
+  BtorAIG *var3    = btor_aig_var (amgr);
+  BtorAIG *var4    = btor_aig_var (amgr);
+  BtorAIG *and1    = btor_aig_and (amgr, var1, var2);
+  BtorAIG *and2    = btor_aig_and (amgr, var3, var4);
+  BtorAIG *and3    = btor_aig_or (amgr, and1, and2);
+  btor_sat_enable_solver (smgr);
+  btor_sat_init (smgr);
+  /* the OR gate only needs (and1 | and2), and1 and and2 only need the
+   * clauses and1 -> var1 & var2, and2 -> var3 & var4 */
+  btor_aig_add_toplevel_to_sat (amgr, and3);
+  ASSERT_EQ (amgr->num_cnf_clauses, 5u);
+  ASSERT_FALSE (btor_aig_is_encoded (amgr, and3));
+  ASSERT_FALSE (btor_aig_is_encoded (amgr, and1));
+  ASSERT_TRUE (btor_aig_is_encoded (amgr, var1));
+  ASSERT_EQ (btor_sat_check_sat (smgr, -1), BTOR_RESULT_SAT);
+  ASSERT_EQ (btor_aig_get_assignment (amgr, and3), 1);
+  ASSERT_EQ (btor_aig_get_assignment (amgr, and1),
+             btor_aig_get_assignment (amgr, var1) > 0
+                     && btor_aig_get_assignment (amgr, var2) > 0
+                 ? 1
+                 : -1);
+  ASSERT_EQ (btor_aig_get_assignment (amgr, and2),
+             btor_aig_get_assignment (amgr, var3) > 0
+                     && btor_aig_get_assignment (amgr, var4) > 0
+                 ? 1
+                 : -1);
+  /* add the clauses of the missing polarities */
+  btor_aig_to_sat (amgr, and3);
+  ASSERT_EQ (amgr->num_cnf_clauses, 9u);
+  ASSERT_TRUE (btor_aig_is_encoded (amgr, and3));
+  ASSERT_TRUE (btor_aig_is_encoded (amgr, and1));
+  ASSERT_TRUE (btor_aig_is_encoded (amgr, and2));
+  btor_sat_reset (smgr);
+  btor_aig_release (amgr, var1);
+  btor_aig_release (amgr, var2);
+  btor_aig_release (amgr, var3);
+  btor_aig_release (amgr, var4);
+  btor_aig_release (amgr, and1);
+  btor_aig_release (amgr, and2);
+  btor_aig_release (amgr, and3);
+  btor_aig_mgr_delete (amgr);
+}
+
+TEST_F (TestAig, aig_to_sat_xor)
+{
+  uint32_t xor_ite;
+
+  for (xor_ite = 0; xor_ite <= 1; xor_ite++)
+  {
+    btor_opt_set (d_btor, BTOR_OPT_CNF_XOR_ITE, xor_ite);
+    BtorAIGMgr *amgr = btor_aig_mgr_new (d_btor);
+    BtorSATMgr *smgr = btor_aig_get_sat_mgr (amgr);
+    BtorAIG *var1    = btor_aig_var (amgr);
+    BtorAIG *var2    = btor_aig_var (amgr);
+    BtorAIG *eq      = btor_aig_eq (amgr, var1, var2);
+    btor_sat_enable_solver (smgr);
+    btor_sat_init (smgr);
+    btor_aig_to_sat (amgr, eq);
+    /* 4 ternary clauses for an XOR gate, 3 clauses per AND gate otherwise */
+    ASSERT_EQ (amgr->num_cnf_clauses, xor_ite ? 4u : 9u);
+    btor_sat_reset (smgr);
+    btor_aig_release (amgr, var1);
+    btor_aig_release (amgr, var2);
+    btor_aig_release (amgr, eq);
+    btor_aig_mgr_delete (amgr);
+  }
+}
+
+TEST_F (TestAig, sat_sweep)
+{
+  BtorAIGMgr *amgr = btor_aig_mgr_new (d_btor);
+  BtorAIG *a       = btor_aig_var (amgr);
+  BtorAIG *b       = btor_aig_var (amgr);
+  BtorAIG *c       = btor_aig_var (amgr);
+  /* two structurally different XOR gates (a ^ b) ^ c and a ^ (b ^ c) */
+  BtorAIG *eq1  = btor_aig_eq (amgr, a, b);
+  BtorAIG *xor1 = btor_aig_eq (amgr, eq1, c);
+  BtorAIG *eq2  = btor_aig_eq (amgr, b, c);
+  BtorAIG *xor2 = btor_aig_eq (amgr, a, eq2);
+  BtorAIG *neq  = btor_aig_and (amgr, xor1, BTOR_INVERT_AIG (xor2));
+  BtorAIG *and1 = btor_aig_and (amgr, xor1, c);
+  BtorAIG *and2 = btor_aig_and (amgr, xor2, c);
+  BtorAIG *or1  = btor_aig_or (amgr, and1, and2);
+  BtorAIGPtrStack roots;
+
+  ASSERT_NE (xor1, xor2);
+  ASSERT_NE (neq, BTOR_AIG_FALSE);
+  ASSERT_NE (or1, and1);
+  BTOR_INIT_STACK (d_btor->mm, roots);
+  BTOR_PUSH_STACK (roots, btor_aig_copy (amgr, neq));
+  BTOR_PUSH_STACK (roots, btor_aig_copy (amgr, or1));
+  btor_aig_sweep (amgr, &roots);
+  ASSERT_GT (amgr->num_sweep_merged, 0u);
+  /* 'xor1' and 'xor2' are equal */
+  ASSERT_EQ (BTOR_PEEK_STACK (roots, 0), BTOR_AIG_FALSE);
+  /* one of 'xor1' and 'xor2' is merged into the other */
+  ASSERT_TRUE (BTOR_PEEK_STACK (roots, 1) == and1
+               || BTOR_PEEK_STACK (roots, 1) == and2);
+
+  while (!BTOR_EMPTY_STACK (roots))
+    btor_aig_release (amgr, BTOR_POP_STACK (roots));
+  BTOR_RELEASE_STACK (roots);
+  btor_aig_release (amgr, a);
+  btor_aig_release (amgr, b);
+  btor_aig_release (amgr, c);
+  btor_aig_release (amgr, eq1);
+  btor_aig_release (amgr, xor1);
+  btor_aig_release (amgr, eq2);
+  btor_aig_release (amgr, xor2);
+  btor_aig_release (amgr, neq);
+  btor_aig_release (amgr, and1);
+  btor_aig_release (amgr, and2);
+  btor_aig_release (amgr, or1);
+  btor_aig_mgr_delete (amgr);
+}
+
+TEST_F (TestAig, aig_rewrite)
+{
+  BtorAIGMgr *amgr = btor_aig_mgr_new (d_btor);
+  BtorAIG *a       = btor_aig_var (amgr);
+  BtorAIG *b       = btor_aig_var (amgr);
+  BtorAIG *c       = btor_aig_var (amgr);
+  /* (a & b) | (a & c) requires 3 ANDs, a & (b | c) only 2 */
+  BtorAIG *and1 = btor_aig_and (amgr, a, b);
+  BtorAIG *and2 = btor_aig_and (amgr, a, c);
+  BtorAIG *or1  = btor_aig_or (amgr, and1, and2);
+  BtorAIGPtrStack roots, nodes;
+  BtorIntHashTable *idx;
+  size_t i, num_ands;
+
+  BTOR_INIT_STACK (d_btor->mm, roots);
+  BTOR_PUSH_STACK (roots, or1);
+  btor_aig_release (amgr, and1);
+  btor_aig_release (amgr, and2);
+  btor_aig_rewrite (amgr, &roots);
+  ASSERT_GT (amgr->num_cut_removed, 0u);
+
+  BTOR_INIT_STACK (d_btor->mm, nodes);
+  idx = btor_hashint_map_new (d_btor->mm);
+  btor_aig_collect_cone (amgr, &roots, &nodes, idx);
+  for (i = 0, num_ands = 0; i < BTOR_COUNT_STACK (nodes); i++)
+    if (btor_aig_is_and (BTOR_PEEK_STACK (nodes, i))) num_ands++;
+  ASSERT_EQ (num_ands, 2u);
+  BTOR_RELEASE_STACK (nodes);
+  btor_hashint_map_delete (idx);
+
+  while (!BTOR_EMPTY_STACK (roots))
+    btor_aig_release (amgr, BTOR_POP_STACK (roots));
+  BTOR_RELEASE_STACK (roots);
+  btor_aig_release (amgr, a);
+  btor_aig_release (amgr, b);
+  btor_aig_release (amgr, c);
+  btor_aig_mgr_delete (amgr);
+}
+
+TEST_F (TestAig, unique_table_enlarge)
+{
+  uint32_t i, n = 1000;
+  BtorAIGMgr *amgr = btor_aig_mgr_new (d_btor);
+  BtorAIG *var     = btor_aig_var (amgr);
+  BtorAIG **vars, **ands;
+
+  BTOR_NEWN (d_btor->mm, vars, n);
+  BTOR_NEWN (d_btor->mm, ands, n);
+  for (i = 0; i < n; i++)
+  {
+    vars[i] = btor_aig_var (amgr);
+    ands[i] = btor_aig_and (amgr, var, vars[i]);
+  }
+  ASSERT_GT (amgr->table.size, n / 2);
+  for (i = 0; i < n; i++)
+  {
+    BtorAIG *aig = btor_aig_and (amgr, vars[i], var);
+    ASSERT_EQ (aig, ands[i]);
+    ASSERT_EQ (btor_aig_get_left_child (amgr, aig), var);
+    ASSERT_EQ (btor_aig_get_right_child (amgr, aig), vars[i]);
+    btor_aig_release (amgr, aig);
+  }
+  for (i = 0; i < n; i++)
+  {
+    btor_aig_release (amgr, ands[i]);
+    btor_aig_release (amgr, vars[i]);
+  }
+  ASSERT_EQ (amgr->table.num_elements, 0u);
+  BTOR_DELETEN (d_btor->mm, vars, n);
+  BTOR_DELETEN (d_btor->mm, ands, n);
+  btor_aig_release (amgr, var);
+  btor_aig_mgr_delete (amgr);
+}
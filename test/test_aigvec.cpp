@@ -240,6 +240,37 @@ TEST_F (TestAigvec, mul)
   btor_aigvec_mgr_delete (avmgr);
 }
 
+TEST_F (TestAigvec, mul_enc)
+{
+  BtorOptMulEnc enc;
+  BtorAIGVecMgr *avmgr;
+  BtorAIGVec *av1, *av2, *av3;
+  BtorBitVector *bits;
+
+  for (enc = BTOR_MUL_ENC_MIN; enc <= BTOR_MUL_ENC_MAX;
+       enc = (BtorOptMulEnc) (enc + 1))
+  {
+    btor_opt_set (d_btor, BTOR_OPT_MUL_ENC, enc);
+    avmgr = btor_aigvec_mgr_new (d_btor);
+    bits  = btor_bv_uint64_to_bv (d_btor->mm, 0x0f0f0f0f, 32);
+    av1   = btor_aigvec_var (avmgr, 32);
+    av2   = btor_aigvec_const (avmgr, bits);
+    av3   = btor_aigvec_mul (avmgr, av1, av2);
+    ASSERT_EQ (av3->width, 32u);
+    ASSERT_EQ (avmgr->stats.muls[enc], 1u);
+    ASSERT_GT (avmgr->stats.mul_full_adders, 0u);
+    if (enc == BTOR_MUL_ENC_SPARSE)
+      ASSERT_GT (avmgr->stats.mul_pps_dropped, 0u);
+    else
+      ASSERT_EQ (avmgr->stats.mul_pps_dropped, 0u);
+    btor_aigvec_release_delete (avmgr, av1);
+    btor_aigvec_release_delete (avmgr, av2);
+    btor_aigvec_release_delete (avmgr, av3);
+    btor_aigvec_mgr_delete (avmgr);
+    btor_bv_free (d_btor->mm, bits);
+  }
+}
+
 TEST_F (TestAigvec, udiv)
 {
   BtorAIGVecMgr *avmgr = btor_aigvec_mgr_new (d_btor);
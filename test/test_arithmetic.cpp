@@ -11,6 +11,7 @@
 #include "test.h"
 
 extern "C" {
+#include "btoropt.h"
 #include "utils/btorutil.h"
 }
 
@@ -138,6 +139,65 @@ class TestArith : public TestBoolector
 
   static int32_t add (int32_t x, int32_t y) { return x + y; }
 
+  /* Check x * y against a shift-and-add formulation of the product for all
+   * widths from 'low' to 'high' with given multiplier encoding.  If
+   * 'const_rhs' is true, y is the constant 0b...0101. */
+  void mul_enc_test (BtorOptMulEnc enc,
+                     uint32_t low,
+                     uint32_t high,
+                     bool const_rhs)
+  {
+    for (uint32_t num_bits = low; num_bits <= high; num_bits++)
+    {
+      if (d_btor) boolector_delete (d_btor);
+      d_btor = boolector_new ();
+      boolector_set_opt (d_btor, BTOR_OPT_REWRITE_LEVEL, 0);
+      boolector_set_opt (d_btor, BTOR_OPT_MUL_ENC, enc);
+
+      BoolectorSort sort = boolector_bitvec_sort (d_btor, num_bits);
+      BoolectorNode *x, *y, *mul, *sum, *zero, *shift, *bit, *ite, *tmp, *ne;
+
+      x = boolector_var (d_btor, sort, "x");
+      if (const_rhs)
+      {
+        uint64_t val = 0x5555555555555555ull & ((1ull << num_bits) - 1);
+        y            = boolector_unsigned_int (d_btor, val, sort);
+      }
+      else
+        y = boolector_var (d_btor, sort, "y");
+      mul  = boolector_mul (d_btor, x, y);
+      zero = boolector_zero (d_btor, sort);
+      sum  = boolector_copy (d_btor, zero);
+      for (uint32_t i = 0; i < num_bits; i++)
+      {
+        tmp   = boolector_unsigned_int (d_btor, i, sort);
+        shift = boolector_sll (d_btor, x, tmp);
+        boolector_release (d_btor, tmp);
+        bit = boolector_slice (d_btor, y, i, i);
+        ite = boolector_cond (d_btor, bit, shift, zero);
+        tmp = boolector_add (d_btor, sum, ite);
+        boolector_release (d_btor, sum);
+        boolector_release (d_btor, ite);
+        boolector_release (d_btor, bit);
+        boolector_release (d_btor, shift);
+        sum = tmp;
+      }
+      ne = boolector_ne (d_btor, mul, sum);
+      boolector_assert (d_btor, ne);
+      ASSERT_EQ (boolector_sat (d_btor), BOOLECTOR_UNSAT);
+
+      boolector_release (d_btor, ne);
+      boolector_release (d_btor, sum);
+      boolector_release (d_btor, zero);
+      boolector_release (d_btor, mul);
+      boolector_release (d_btor, y);
+      boolector_release (d_btor, x);
+      boolector_release_sort (d_btor, sort);
+      boolector_delete (d_btor);
+      d_btor = nullptr;
+    }
+  }
+
   static int32_t sub (int32_t x, int32_t y) { return x - y; }
 
   static int32_t mul (int32_t x, int32_t y) { return x * y; }
@@ -202,6 +262,24 @@ TEST_F (TestArith, mul_u)
                      0);
 }
 
+TEST_F (TestArith, mul_enc_wallace)
+{
+  mul_enc_test (BTOR_MUL_ENC_WALLACE, 1, 8, false);
+  mul_enc_test (BTOR_MUL_ENC_WALLACE, 1, 8, true);
+}
+
+TEST_F (TestArith, mul_enc_dadda)
+{
+  mul_enc_test (BTOR_MUL_ENC_DADDA, 1, 8, false);
+  mul_enc_test (BTOR_MUL_ENC_DADDA, 1, 8, true);
+}
+
+TEST_F (TestArith, mul_enc_sparse)
+{
+  mul_enc_test (BTOR_MUL_ENC_SPARSE, 1, 8, false);
+  mul_enc_test (BTOR_MUL_ENC_SPARSE, 1, 8, true);
+}
+
 TEST_F (TestArith, udiv_u)
 {
   u_arithmetic_test (divide,
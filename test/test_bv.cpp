@@ -1365,6 +1365,43 @@ TEST_F (TestBv, bv_to_dec_char)
                          "00000000");
 }
 
+TEST_F (TestBv, bv_to_words)
+{
+  BtorBitVector *bv;
+  uint64_t words[3];
+
+  bv = btor_bv_uint64_to_bv (d_mm, 5, 3);
+  btor_bv_to_words (bv, words);
+  ASSERT_EQ (words[0], 5u);
+  btor_bv_free (d_mm, bv);
+
+  bv = btor_bv_uint64_to_bv (d_mm, UINT64_MAX, 64);
+  btor_bv_to_words (bv, words);
+  ASSERT_EQ (words[0], UINT64_MAX);
+  btor_bv_free (d_mm, bv);
+
+  /* 2^128 + 2^64 * 0xdeadbeef + 2^33 + 1 */
+  bv = btor_bv_char_to_bv (d_mm,
+                           "1"
+                           "00000000000000000000000000000000"
+                           "11011110101011011011111011101111"
+                           "00000000000000000000000000000010"
+                           "00000000000000000000000000000001");
+  words[2] = 42;
+  btor_bv_to_words (bv, words);
+  ASSERT_EQ (words[0], ((uint64_t) 1 << 33) + 1);
+  ASSERT_EQ (words[1], 0xdeadbeefu);
+  ASSERT_EQ (words[2], 1u);
+  btor_bv_free (d_mm, bv);
+
+  bv = btor_bv_new (d_mm, 100);
+  words[0] = words[1] = 42;
+  btor_bv_to_words (bv, words);
+  ASSERT_EQ (words[0], 0u);
+  ASSERT_EQ (words[1], 0u);
+  btor_bv_free (d_mm, bv);
+}
+
 /*------------------------------------------------------------------------*/
 
 TEST_F (TestBv, const)
@@ -4016,4 +4053,68 @@ TEST_F (TestBv, test_get_num_leading_ones)
   test_get_num (176, btor_bv_get_num_leading_ones, true, false);
 }
 
+TEST_F (TestBv, word_vs_chunks)
+{
+  /* Results of operations on bit-vectors of width <= 64 (computed on a
+   * single word) must match the results of the same operations computed on
+   * zero-extended bit-vectors of width > 64 (computed in 32 bit chunks). */
+  uint32_t i, bw, ext;
+  BtorBitVector *a, *b, *ea, *eb, *r, *er, *sr;
+
+  for (bw = 1; bw <= 64; bw++)
+  {
+    ext = 96 - bw;
+    for (i = 0; i < 50; i++)
+    {
+      a  = btor_bv_new_random (d_mm, d_rng, bw);
+      b  = btor_bv_new_random (d_mm, d_rng, bw);
+      ea = btor_bv_uext (d_mm, a, ext);
+      eb = btor_bv_uext (d_mm, b, ext);
+
+      r  = btor_bv_mul (d_mm, a, b);
+      er = btor_bv_mul (d_mm, ea, eb);
+      sr = btor_bv_slice (d_mm, er, bw - 1, 0);
+      ASSERT_EQ (btor_bv_compare (r, sr), 0);
+      btor_bv_free (d_mm, r);
+      btor_bv_free (d_mm, er);
+      btor_bv_free (d_mm, sr);
+
+      r  = btor_bv_sub (d_mm, a, b);
+      er = btor_bv_sub (d_mm, ea, eb);
+      sr = btor_bv_slice (d_mm, er, bw - 1, 0);
+      ASSERT_EQ (btor_bv_compare (r, sr), 0);
+      btor_bv_free (d_mm, r);
+      btor_bv_free (d_mm, er);
+      btor_bv_free (d_mm, sr);
+
+      r  = btor_bv_ult (d_mm, a, b);
+      er = btor_bv_ult (d_mm, ea, eb);
+      ASSERT_EQ (btor_bv_compare (r, er), 0);
+      btor_bv_free (d_mm, r);
+      btor_bv_free (d_mm, er);
+
+      r  = btor_bv_concat (d_mm, a, b);
+      er = btor_bv_concat (d_mm, ea, b);
+      sr = btor_bv_slice (d_mm, er, 2 * bw - 1, 0);
+      ASSERT_EQ (btor_bv_compare (r, sr), 0);
+      btor_bv_free (d_mm, r);
+      btor_bv_free (d_mm, er);
+      btor_bv_free (d_mm, sr);
+
+      r  = btor_bv_sext (d_mm, a, 64 - bw);
+      er = btor_bv_sext (d_mm, a, 96 - bw);
+      sr = btor_bv_slice (d_mm, er, 63, 0);
+      ASSERT_EQ (btor_bv_compare (r, sr), 0);
+      btor_bv_free (d_mm, r);
+      btor_bv_free (d_mm, er);
+      btor_bv_free (d_mm, sr);
+
+      btor_bv_free (d_mm, a);
+      btor_bv_free (d_mm, b);
+      btor_bv_free (d_mm, ea);
+      btor_bv_free (d_mm, eb);
+    }
+  }
+}
+
 // TODO btor_bv_get_assignment
@@ -0,0 +1,143 @@
+/*  Boolector: Satisfiability Modulo Theories (SMT) solver.
+ *
+ *  Copyright (C) 2020 Aina Niemetz.
+ *  Copyright (C) 2020 Mathias Preiner.
+ *
+ *  This file is part of Boolector.
+ *  See COPYING for more information on using this software.
+ */
+
+#include "test.h"
+
+extern "C" {
+#include "btoropt.h"
+}
+
+class TestFunCube : public TestBoolector
+{
+ protected:
+  void SetUp () override
+  {
+    TestBoolector::SetUp ();
+    boolector_set_opt (d_btor, BTOR_OPT_FUN_CUBE, 4);
+    boolector_set_opt (d_btor, BTOR_OPT_FUN_CUBE_THREADS, 4);
+    boolector_set_opt (d_btor, BTOR_OPT_MODEL_GEN, 1);
+    boolector_set_opt (d_btor, BTOR_OPT_REWRITE_LEVEL, 0);
+
+    d_bv_sort    = boolector_bitvec_sort (d_btor, 8);
+    d_array_sort = boolector_array_sort (d_btor, d_bv_sort, d_bv_sort);
+    d_a          = boolector_array (d_btor, d_array_sort, "a");
+    d_i          = boolector_var (d_btor, d_bv_sort, "i");
+    d_j          = boolector_var (d_btor, d_bv_sort, "j");
+    d_ai         = boolector_read (d_btor, d_a, d_i);
+    d_aj         = boolector_read (d_btor, d_a, d_j);
+  }
+
+  void TearDown () override
+  {
+    boolector_release (d_btor, d_a);
+    boolector_release (d_btor, d_i);
+    boolector_release (d_btor, d_j);
+    boolector_release (d_btor, d_ai);
+    boolector_release (d_btor, d_aj);
+    boolector_release_sort (d_btor, d_array_sort);
+    boolector_release_sort (d_btor, d_bv_sort);
+    TestBoolector::TearDown ();
+  }
+
+  /* a[i] + a[j] = 'sum' with a[i] != a[j] */
+  void test_funcube_sum (uint32_t sum)
+  {
+    BoolectorNode *add, *c, *eq, *ne;
+    const char *ival, *jval, *aival, *ajval;
+
+    add = boolector_add (d_btor, d_ai, d_aj);
+    c   = boolector_unsigned_int (d_btor, sum, d_bv_sort);
+    eq  = boolector_eq (d_btor, add, c);
+    ne  = boolector_ne (d_btor, d_ai, d_aj);
+    boolector_assert (d_btor, eq);
+    boolector_assert (d_btor, ne);
+
+    ASSERT_EQ (boolector_sat (d_btor), BOOLECTOR_SAT);
+    ival  = boolector_bv_assignment (d_btor, d_i);
+    jval  = boolector_bv_assignment (d_btor, d_j);
+    aival = boolector_bv_assignment (d_btor, d_ai);
+    ajval = boolector_bv_assignment (d_btor, d_aj);
+    ASSERT_STRNE (ival, jval);
+    ASSERT_STRNE (aival, ajval);
+    ASSERT_EQ ((strtoul (aival, 0, 2) + strtoul (ajval, 0, 2)) % 256, sum);
+    boolector_free_bv_assignment (d_btor, ival);
+    boolector_free_bv_assignment (d_btor, jval);
+    boolector_free_bv_assignment (d_btor, aival);
+    boolector_free_bv_assignment (d_btor, ajval);
+
+    boolector_release (d_btor, add);
+    boolector_release (d_btor, c);
+    boolector_release (d_btor, eq);
+    boolector_release (d_btor, ne);
+  }
+
+  BoolectorSort d_bv_sort, d_array_sort;
+  BoolectorNode *d_a, *d_i, *d_j, *d_ai, *d_aj;
+};
+
+TEST_F (TestFunCube, sat)
+{
+  test_funcube_sum (100);
+}
+
+TEST_F (TestFunCube, sat_one_thread)
+{
+  boolector_set_opt (d_btor, BTOR_OPT_FUN_CUBE_THREADS, 1);
+  test_funcube_sum (7);
+}
+
+TEST_F (TestFunCube, unsat)
+{
+  BoolectorNode *ult, *add, *eq, *ne;
+
+  /* i < j and j = i + 1 and a[i] != a[j - 1] */
+  ult = boolector_ult (d_btor, d_i, d_j);
+  add = boolector_inc (d_btor, d_i);
+  eq  = boolector_eq (d_btor, d_j, add);
+  boolector_release (d_btor, add);
+  add = boolector_dec (d_btor, d_j);
+  ne  = boolector_read (d_btor, d_a, add);
+  boolector_release (d_btor, add);
+  add = ne;
+  ne  = boolector_ne (d_btor, d_ai, add);
+  boolector_assert (d_btor, ult);
+  boolector_assert (d_btor, eq);
+  boolector_assert (d_btor, ne);
+
+  ASSERT_EQ (boolector_sat (d_btor), BOOLECTOR_UNSAT);
+
+  boolector_release (d_btor, ult);
+  boolector_release (d_btor, add);
+  boolector_release (d_btor, eq);
+  boolector_release (d_btor, ne);
+}
+
+TEST_F (TestFunCube, inc)
+{
+  BoolectorNode *eq, *ne;
+
+  boolector_set_opt (d_btor, BTOR_OPT_INCREMENTAL, 1);
+
+  ne = boolector_ne (d_btor, d_ai, d_aj);
+  boolector_assert (d_btor, ne);
+  ASSERT_EQ (boolector_sat (d_btor), BOOLECTOR_SAT);
+
+  /* cube-and-conquer mode is not used with assumptions */
+  eq = boolector_eq (d_btor, d_i, d_j);
+  boolector_assume (d_btor, eq);
+  ASSERT_EQ (boolector_sat (d_btor), BOOLECTOR_UNSAT);
+  ASSERT_TRUE (boolector_failed (d_btor, eq));
+
+  ASSERT_EQ (boolector_sat (d_btor), BOOLECTOR_SAT);
+  boolector_assert (d_btor, eq);
+  ASSERT_EQ (boolector_sat (d_btor), BOOLECTOR_UNSAT);
+
+  boolector_release (d_btor, eq);
+  boolector_release (d_btor, ne);
+}
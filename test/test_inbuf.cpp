@@ -0,0 +1,106 @@
+/*  Boolector: Satisfiability Modulo Theories (SMT) solver.
+ *
+ *  Copyright (C) 2020 Aina Niemetz.
+ *  Copyright (C) 2020 Mathias Preiner.
+ *
+ *  This file is part of Boolector.
+ *  See COPYING for more information on using this software.
+ */
+
+#include "test.h"
+
+extern "C" {
+#include "utils/btorinbuf.h"
+}
+
+#include <string>
+
+class TestInBuf : public TestMm
+{
+ protected:
+  /* Read 'skip' characters via the stream, then the rest via the input
+   * buffer and check that the result matches 'content'. */
+  void test_inbuf (FILE *file, const std::string &content, size_t skip)
+  {
+    BtorInBuf ib;
+    std::string read;
+    size_t i;
+    int32_t ch;
+
+    for (i = 0; i < skip; i++) ASSERT_EQ (getc (file), content[i]);
+
+    btor_inbuf_init (d_mm, &ib, file);
+    while ((ch = btor_inbuf_getc (&ib)) != EOF) read.push_back (ch);
+    ASSERT_EQ (btor_inbuf_getc (&ib), EOF);
+    ASSERT_EQ (read, content.substr (skip));
+    ASSERT_EQ (btor_inbuf_bytes (&ib), content.size () - skip);
+    btor_inbuf_release (&ib);
+  }
+
+  std::string create_content (size_t size)
+  {
+    std::string res;
+    size_t i;
+    for (i = 0; i < size; i++) res.push_back (i % 61 ? 'a' + i % 26 : '\n');
+    return res;
+  }
+};
+
+TEST_F (TestInBuf, init_release)
+{
+  BtorInBuf ib;
+  FILE *file = tmpfile ();
+
+  btor_inbuf_init (d_mm, &ib, file);
+  ASSERT_EQ (ib.mode, BTOR_INBUF_MODE_MMAP);
+  ASSERT_EQ (btor_inbuf_getc (&ib), EOF);
+  ASSERT_EQ (btor_inbuf_bytes (&ib), 0u);
+  btor_inbuf_release (&ib);
+  fclose (file);
+}
+
+TEST_F (TestInBuf, mmap)
+{
+  std::string content = create_content (3 * BTOR_INBUF_BLOCK_SIZE + 17);
+  FILE *file          = tmpfile ();
+
+  fwrite (content.c_str (), 1, content.size (), file);
+  rewind (file);
+  test_inbuf (file, content, 0);
+  rewind (file);
+  test_inbuf (file, content, 123);
+  fclose (file);
+}
+
+TEST_F (TestInBuf, release_position)
+{
+  std::string content = create_content (1000);
+  FILE *file          = tmpfile ();
+  BtorInBuf ib;
+  size_t i;
+
+  fwrite (content.c_str (), 1, content.size (), file);
+  rewind (file);
+  ASSERT_EQ (getc (file), content[0]);
+  btor_inbuf_init (d_mm, &ib, file);
+  for (i = 1; i < 100; i++) ASSERT_EQ (btor_inbuf_getc (&ib), content[i]);
+  btor_inbuf_release (&ib);
+  /* stream continues after the last character read via the input buffer */
+  ASSERT_EQ (getc (file), content[100]);
+  fclose (file);
+}
+
+TEST_F (TestInBuf, pipe)
+{
+  std::string content = create_content (5000);
+  std::string cmd     = "printf '%s' '" + content + "'";
+  FILE *file          = popen (cmd.c_str (), "r");
+  BtorInBuf ib;
+
+  ASSERT_NE (file, nullptr);
+  btor_inbuf_init (d_mm, &ib, file);
+  ASSERT_EQ (ib.mode, BTOR_INBUF_MODE_GETC);
+  btor_inbuf_release (&ib);
+  test_inbuf (file, content, 10);
+  pclose (file);
+}
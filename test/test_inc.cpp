@@ -12,6 +12,7 @@
 #include "test.h"
 
 extern "C" {
+#include "btorcore.h"
 #include "btoropt.h"
 }
 
@@ -133,6 +134,17 @@ class TestInc : public TestBoolector
 
     boolector_release (d_btor, prev);
   }
+
+  uint64_t bv_assignment (BoolectorNode *node)
+  {
+    const char *bits;
+    uint64_t res;
+
+    bits = boolector_bv_assignment (d_btor, node);
+    res  = strtoull (bits, 0, 2);
+    boolector_free_bv_assignment (d_btor, bits);
+    return res;
+  }
 };
 
 TEST_F (TestInc, true_false)
@@ -258,3 +270,112 @@ TEST_F (TestInc, lemmas_on_demand1)
   boolector_release_sort (d_btor, s);
   boolector_release_sort (d_btor, as);
 }
+
+TEST_F (TestInc, ucopt_push_pop)
+{
+  BoolectorNode *x, *y, *z, *mul, *t, *eq, *ne, *c;
+  BoolectorSort s;
+
+  boolector_set_opt (d_btor, BTOR_OPT_INCREMENTAL, 1);
+  boolector_set_opt (d_btor, BTOR_OPT_MODEL_GEN, 1);
+  boolector_set_opt (d_btor, BTOR_OPT_UCOPT, 1);
+
+  s   = boolector_bitvec_sort (d_btor, 8);
+  x   = boolector_var (d_btor, s, 0);
+  y   = boolector_var (d_btor, s, 0);
+  z   = boolector_var (d_btor, s, "z");
+  mul = boolector_mul (d_btor, x, y);
+  t   = boolector_add (d_btor, mul, z);
+  /* x, y and x * y can not be referred to anymore, thus x * y is
+   * unconstrained in every later context */
+  boolector_release (d_btor, x);
+  boolector_release (d_btor, y);
+  boolector_release (d_btor, mul);
+
+  for (uint32_t i = 0; i < 3; i++)
+  {
+    boolector_push (d_btor, 1);
+    c  = boolector_unsigned_int (d_btor, 10 + i, s);
+    eq = boolector_eq (d_btor, t, c);
+    boolector_assert (d_btor, eq);
+    boolector_release (d_btor, eq);
+    boolector_release (d_btor, c);
+    c  = boolector_unsigned_int (d_btor, i, s);
+    eq = boolector_eq (d_btor, z, c);
+    boolector_assert (d_btor, eq);
+    boolector_release (d_btor, eq);
+    boolector_release (d_btor, c);
+
+    ASSERT_EQ (boolector_sat (d_btor), BOOLECTOR_SAT);
+    ASSERT_EQ (bv_assignment (t), 10u + i);
+    ASSERT_EQ (bv_assignment (z), i);
+    boolector_pop (d_btor, 1);
+  }
+  ASSERT_GT (d_btor->stats.bv_uc_props, 0u);
+
+  c  = boolector_unsigned_int (d_btor, 11, s);
+  eq = boolector_eq (d_btor, t, c);
+  boolector_assert (d_btor, eq);
+  ASSERT_EQ (boolector_sat (d_btor), BOOLECTOR_SAT);
+  boolector_push (d_btor, 1);
+  ne = boolector_not (d_btor, eq);
+  boolector_assert (d_btor, ne);
+  boolector_release (d_btor, ne);
+  ASSERT_EQ (boolector_sat (d_btor), BOOLECTOR_UNSAT);
+  boolector_pop (d_btor, 1);
+  ASSERT_EQ (boolector_sat (d_btor), BOOLECTOR_SAT);
+  ASSERT_EQ (bv_assignment (t), 11u);
+  boolector_release (d_btor, eq);
+  boolector_release (d_btor, c);
+
+  boolector_release (d_btor, z);
+  boolector_release (d_btor, t);
+  boolector_release_sort (d_btor, s);
+}
+
+TEST_F (TestInc, slices_push_pop)
+{
+  BoolectorNode *x, *slice, *eq, *c;
+  BoolectorSort s, s4, s6;
+
+  boolector_set_opt (d_btor, BTOR_OPT_INCREMENTAL, 1);
+  boolector_set_opt (d_btor, BTOR_OPT_MODEL_GEN, 1);
+
+  s  = boolector_bitvec_sort (d_btor, 8);
+  s4 = boolector_bitvec_sort (d_btor, 4);
+  s6 = boolector_bitvec_sort (d_btor, 6);
+  x  = boolector_var (d_btor, s, "x");
+
+  boolector_push (d_btor, 1);
+  slice = boolector_slice (d_btor, x, 3, 0);
+  c     = boolector_unsigned_int (d_btor, 5, s4);
+  eq    = boolector_eq (d_btor, slice, c);
+  boolector_assert (d_btor, eq);
+  boolector_release (d_btor, eq);
+  boolector_release (d_btor, c);
+  ASSERT_EQ (boolector_sat (d_btor), BOOLECTOR_SAT);
+  ASSERT_EQ (bv_assignment (x) & 15, 5u);
+  ASSERT_GT (d_btor->stats.eliminated_slices, 0u);
+  boolector_pop (d_btor, 1);
+
+  c  = boolector_unsigned_int (d_btor, 9, s4);
+  eq = boolector_eq (d_btor, slice, c);
+  boolector_assert (d_btor, eq);
+  boolector_release (d_btor, eq);
+  boolector_release (d_btor, c);
+  boolector_release (d_btor, slice);
+  slice = boolector_slice (d_btor, x, 7, 2);
+  c     = boolector_unsigned_int (d_btor, 42, s6);
+  eq    = boolector_eq (d_btor, slice, c);
+  boolector_assert (d_btor, eq);
+  boolector_release (d_btor, eq);
+  boolector_release (d_btor, c);
+  ASSERT_EQ (boolector_sat (d_btor), BOOLECTOR_SAT);
+  ASSERT_EQ (bv_assignment (x), 169u);
+
+  boolector_release (d_btor, slice);
+  boolector_release (d_btor, x);
+  boolector_release_sort (d_btor, s);
+  boolector_release_sort (d_btor, s4);
+  boolector_release_sort (d_btor, s6);
+}
@@ -448,3 +448,267 @@ TEST_F (TestMc, count2multi)
   ASSERT_EQ (boolector_mc_reached_bad_at_bound (d_mc, 3), 3);
   boolector_release (d_btor, count);
 }
+
+TEST_F (TestMc, kind_simple_path)
+{
+  int32_t mode, k;
+  BoolectorSort s, s1;
+
+  for (mode = 0; mode < 2; mode++)
+  {
+    set_up_iteration ();
+
+    // boolector_mc_set_opt (d_mc, BTOR_MC_OPT_VERBOSITY, 3);
+    boolector_mc_set_opt (d_mc, BTOR_MC_OPT_KINDUCTION, 1);
+    if (mode) boolector_mc_set_opt (d_mc, BTOR_MC_OPT_SIMPLE_PATH, 1);
+
+    /* 0 -> 0, 1 -> 2, 2 -> (in ? 3 : 1), 3 -> 3, with 'count' initialized
+     * to 0, i.e., 3 is unreachable but not k-inductive for any k */
+    BoolectorNode *count, *in, *zero, *one, *two, *three, *next;
+    BoolectorNode *eqzero, *eqone, *eqtwo, *eqthree, *ite0, *ite1, *ite2;
+    s     = boolector_bitvec_sort (d_btor, 2);
+    s1    = boolector_bitvec_sort (d_btor, 1);
+    count = boolector_mc_state (d_mc, s, "count");
+    in    = boolector_mc_input (d_mc, s1, "in");
+    zero  = boolector_zero (d_btor, s);
+    one   = boolector_one (d_btor, s);
+    boolector_release_sort (d_btor, s);
+    boolector_release_sort (d_btor, s1);
+    two     = boolector_const (d_btor, "10");
+    three   = boolector_const (d_btor, "11");
+    eqzero  = boolector_eq (d_btor, count, zero);
+    eqone   = boolector_eq (d_btor, count, one);
+    eqtwo   = boolector_eq (d_btor, count, two);
+    eqthree = boolector_eq (d_btor, count, three);
+    ite0    = boolector_cond (d_btor, in, three, one);
+    ite1    = boolector_cond (d_btor, eqtwo, ite0, three);
+    ite2    = boolector_cond (d_btor, eqone, two, ite1);
+    next    = boolector_cond (d_btor, eqzero, zero, ite2);
+    boolector_mc_init (d_mc, count, zero);
+    boolector_mc_next (d_mc, count, next);
+    ASSERT_EQ (boolector_mc_bad (d_mc, eqthree), 0u);
+
+    k = boolector_mc_kind (d_mc, 0, 10);
+    ASSERT_LT (k, 0);
+    if (mode)
+      ASSERT_EQ (boolector_mc_proved_bad_at_bound (d_mc, 0), 3);
+    else
+      ASSERT_LT (boolector_mc_proved_bad_at_bound (d_mc, 0), 0);
+
+    boolector_release (d_btor, count);
+    boolector_release (d_btor, in);
+    boolector_release (d_btor, zero);
+    boolector_release (d_btor, one);
+    boolector_release (d_btor, two);
+    boolector_release (d_btor, three);
+    boolector_release (d_btor, eqzero);
+    boolector_release (d_btor, eqone);
+    boolector_release (d_btor, eqtwo);
+    boolector_release (d_btor, eqthree);
+    boolector_release (d_btor, ite0);
+    boolector_release (d_btor, ite1);
+    boolector_release (d_btor, ite2);
+    boolector_release (d_btor, next);
+  }
+}
+
+TEST_F (TestMc, kind_count2)
+{
+  int32_t k;
+  BoolectorSort s;
+
+  boolector_mc_set_opt (d_mc, BTOR_MC_OPT_KINDUCTION, 1);
+  boolector_mc_set_opt (d_mc, BTOR_MC_OPT_STOP_FIRST, 0);
+
+  /* 'count' is incremented by 2 starting from 0, i.e., 'count == 2' is
+   * reached at bound 1 and 'count == 1' is 2-inductive */
+  BoolectorNode *count, *zero, *one, *two, *next, *eqone, *eqtwo;
+  s     = boolector_bitvec_sort (d_btor, 2);
+  count = boolector_mc_state (d_mc, s, "count");
+  zero  = boolector_zero (d_btor, s);
+  one   = boolector_one (d_btor, s);
+  boolector_release_sort (d_btor, s);
+  two   = boolector_const (d_btor, "10");
+  next  = boolector_add (d_btor, count, two);
+  eqone = boolector_eq (d_btor, count, one);
+  eqtwo = boolector_eq (d_btor, count, two);
+  boolector_mc_init (d_mc, count, zero);
+  boolector_mc_next (d_mc, count, next);
+  ASSERT_EQ (boolector_mc_bad (d_mc, eqone), 0u);
+  ASSERT_EQ (boolector_mc_bad (d_mc, eqtwo), 1u);
+
+  k = boolector_mc_kind (d_mc, 0, 10);
+  ASSERT_EQ (k, 2);
+  ASSERT_LT (boolector_mc_reached_bad_at_bound (d_mc, 0), 0);
+  ASSERT_EQ (boolector_mc_reached_bad_at_bound (d_mc, 1), 1);
+  ASSERT_EQ (boolector_mc_proved_bad_at_bound (d_mc, 0), 2);
+  ASSERT_LT (boolector_mc_proved_bad_at_bound (d_mc, 1), 0);
+
+  boolector_release (d_btor, count);
+  boolector_release (d_btor, zero);
+  boolector_release (d_btor, one);
+  boolector_release (d_btor, two);
+  boolector_release (d_btor, next);
+  boolector_release (d_btor, eqone);
+  boolector_release (d_btor, eqtwo);
+}
+
+TEST_F (TestMc, ic3_not_kinductive)
+{
+  int32_t k;
+  BoolectorSort s, s1;
+
+  boolector_mc_set_opt (d_mc, BTOR_MC_OPT_IC3, 1);
+
+  /* 0 -> 0, 1 -> 2, 2 -> (in ? 3 : 1), 3 -> 3, with 'count' initialized
+   * to 0, i.e., 3 is unreachable but not k-inductive for any k */
+  BoolectorNode *count, *in, *zero, *one, *two, *three, *next;
+  BoolectorNode *eqzero, *eqone, *eqtwo, *eqthree, *ite0, *ite1, *ite2;
+  s     = boolector_bitvec_sort (d_btor, 2);
+  s1    = boolector_bitvec_sort (d_btor, 1);
+  count = boolector_mc_state (d_mc, s, "count");
+  in    = boolector_mc_input (d_mc, s1, "in");
+  zero  = boolector_zero (d_btor, s);
+  one   = boolector_one (d_btor, s);
+  boolector_release_sort (d_btor, s);
+  boolector_release_sort (d_btor, s1);
+  two     = boolector_const (d_btor, "10");
+  three   = boolector_const (d_btor, "11");
+  eqzero  = boolector_eq (d_btor, count, zero);
+  eqone   = boolector_eq (d_btor, count, one);
+  eqtwo   = boolector_eq (d_btor, count, two);
+  eqthree = boolector_eq (d_btor, count, three);
+  ite0    = boolector_cond (d_btor, in, three, one);
+  ite1    = boolector_cond (d_btor, eqtwo, ite0, three);
+  ite2    = boolector_cond (d_btor, eqone, two, ite1);
+  next    = boolector_cond (d_btor, eqzero, zero, ite2);
+  boolector_mc_init (d_mc, count, zero);
+  boolector_mc_next (d_mc, count, next);
+  ASSERT_EQ (boolector_mc_bad (d_mc, eqthree), 0u);
+
+  k = boolector_mc_ic3 (d_mc, 10);
+  ASSERT_LT (k, 0);
+  ASSERT_GE (boolector_mc_proved_bad_at_bound (d_mc, 0), 0);
+  ASSERT_TRUE (boolector_mc_has_invariant (d_mc, 0));
+
+  boolector_release (d_btor, count);
+  boolector_release (d_btor, in);
+  boolector_release (d_btor, zero);
+  boolector_release (d_btor, one);
+  boolector_release (d_btor, two);
+  boolector_release (d_btor, three);
+  boolector_release (d_btor, eqzero);
+  boolector_release (d_btor, eqone);
+  boolector_release (d_btor, eqtwo);
+  boolector_release (d_btor, eqthree);
+  boolector_release (d_btor, ite0);
+  boolector_release (d_btor, ite1);
+  boolector_release (d_btor, ite2);
+  boolector_release (d_btor, next);
+}
+
+TEST_F (TestMc, ic3_count2)
+{
+  int32_t k;
+  BoolectorSort s;
+
+  boolector_mc_set_opt (d_mc, BTOR_MC_OPT_IC3, 1);
+  boolector_mc_set_opt (d_mc, BTOR_MC_OPT_STOP_FIRST, 0);
+
+  /* 'count' is incremented by 2 starting from 0, i.e., 'count == 2' is
+   * reached at bound 1 and 'count == 1' is unreachable */
+  BoolectorNode *count, *zero, *one, *two, *next, *eqone, *eqtwo;
+  s     = boolector_bitvec_sort (d_btor, 2);
+  count = boolector_mc_state (d_mc, s, "count");
+  zero  = boolector_zero (d_btor, s);
+  one   = boolector_one (d_btor, s);
+  boolector_release_sort (d_btor, s);
+  two   = boolector_const (d_btor, "10");
+  next  = boolector_add (d_btor, count, two);
+  eqone = boolector_eq (d_btor, count, one);
+  eqtwo = boolector_eq (d_btor, count, two);
+  boolector_mc_init (d_mc, count, zero);
+  boolector_mc_next (d_mc, count, next);
+  ASSERT_EQ (boolector_mc_bad (d_mc, eqone), 0u);
+  ASSERT_EQ (boolector_mc_bad (d_mc, eqtwo), 1u);
+
+  k = boolector_mc_ic3 (d_mc, 10);
+  ASSERT_EQ (k, 1);
+  ASSERT_LT (boolector_mc_reached_bad_at_bound (d_mc, 0), 0);
+  ASSERT_EQ (boolector_mc_reached_bad_at_bound (d_mc, 1), 1);
+  ASSERT_GE (boolector_mc_proved_bad_at_bound (d_mc, 0), 0);
+  ASSERT_LT (boolector_mc_proved_bad_at_bound (d_mc, 1), 0);
+  ASSERT_TRUE (boolector_mc_has_invariant (d_mc, 0));
+  ASSERT_FALSE (boolector_mc_has_invariant (d_mc, 1));
+
+  boolector_release (d_btor, count);
+  boolector_release (d_btor, zero);
+  boolector_release (d_btor, one);
+  boolector_release (d_btor, two);
+  boolector_release (d_btor, next);
+  boolector_release (d_btor, eqone);
+  boolector_release (d_btor, eqtwo);
+}
+
+static int32_t
+test_mc_terminate (void *state)
+{
+  (void) state;
+  return 1;
+}
+
+TEST_F (TestMc, clone_count2)
+{
+  int32_t k;
+  uint32_t bad;
+  BoolectorSort s;
+  BtorMC *clone;
+
+  boolector_mc_set_opt (d_mc, BTOR_MC_OPT_STOP_FIRST, 0);
+  boolector_mc_set_opt (d_mc, BTOR_MC_OPT_TRACE_GEN, 0);
+
+  /* 'count' is incremented by 2 starting from 0 */
+  BoolectorNode *count, *zero, *one, *two, *next, *eqone, *eqtwo;
+  s     = boolector_bitvec_sort (d_btor, 2);
+  count = boolector_mc_state (d_mc, s, "count");
+  zero  = boolector_zero (d_btor, s);
+  one   = boolector_one (d_btor, s);
+  boolector_release_sort (d_btor, s);
+  two   = boolector_const (d_btor, "10");
+  next  = boolector_add (d_btor, count, two);
+  eqone = boolector_eq (d_btor, count, one);
+  eqtwo = boolector_eq (d_btor, count, two);
+  boolector_mc_init (d_mc, count, zero);
+  boolector_mc_next (d_mc, count, next);
+  ASSERT_EQ (boolector_mc_bad (d_mc, eqone), 0u);
+  ASSERT_EQ (boolector_mc_bad (d_mc, eqtwo), 1u);
+
+  /* clone with bad state property 1 only */
+  bad   = 1;
+  clone = boolector_mc_clone (d_mc, 1, &bad);
+  k     = boolector_mc_bmc (clone, 0, 10);
+  ASSERT_EQ (k, 1);
+  ASSERT_EQ (boolector_mc_reached_bad_at_bound (clone, 0), 1);
+  boolector_mc_delete (clone);
+
+  /* terminated clone */
+  clone = boolector_mc_clone (d_mc, 0, 0);
+  boolector_mc_set_term (clone, 0, test_mc_terminate);
+  k = boolector_mc_bmc (clone, 0, 10);
+  ASSERT_LT (k, 0);
+  boolector_mc_delete (clone);
+
+  /* the original is not affected by checking its clones */
+  k = boolector_mc_bmc (d_mc, 0, 10);
+  ASSERT_LT (k, 0);
+  ASSERT_LT (boolector_mc_reached_bad_at_bound (d_mc, 0), 0);
+  ASSERT_EQ (boolector_mc_reached_bad_at_bound (d_mc, 1), 1);
+
+  boolector_release (d_btor, count);
+  boolector_release (d_btor, zero);
+  boolector_release (d_btor, one);
+  boolector_release (d_btor, two);
+  boolector_release (d_btor, next);
+  boolector_release (d_btor, eqone);
+  boolector_release (d_btor, eqtwo);
+}
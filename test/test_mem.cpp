@@ -63,3 +63,45 @@ TEST_F (TestMem, strdup)
   ASSERT_EQ (strcmp (test, "test"), 0);
   btor_mem_freestr (d_mm, test);
 }
+
+TEST_F (TestMem, slab)
+{
+  int32_t i;
+  int32_t *test[100];
+  size_t allocated = d_mm->allocated;
+
+  for (i = 0; i < 100; i++)
+  {
+    test[i] = (int32_t *) btor_mem_slab_calloc (d_mm, 3 * sizeof (int32_t));
+    ASSERT_NE (test[i], nullptr);
+    ASSERT_EQ (test[i][0], 0);
+    ASSERT_EQ (test[i][2], 0);
+    test[i][0] = i;
+    test[i][2] = i;
+  }
+  ASSERT_EQ (d_mm->allocated, allocated + 100 * 3 * sizeof (int32_t));
+  ASSERT_EQ (d_mm->slabs[1].num_used, 100u);
+  for (i = 0; i < 100; i++) ASSERT_EQ (test[i][0] + test[i][2], 2 * i);
+
+  /* released objects are reused */
+  btor_mem_slab_free (d_mm, test[42], 3 * sizeof (int32_t));
+  ASSERT_EQ (btor_mem_slab_malloc (d_mm, 3 * sizeof (int32_t)), test[42]);
+
+  for (i = 0; i < 100; i++)
+    btor_mem_slab_free (d_mm, test[i], 3 * sizeof (int32_t));
+  ASSERT_EQ (d_mm->allocated, allocated);
+  ASSERT_EQ (d_mm->slabs[1].num_used, 0u);
+  ASSERT_EQ (d_mm->slabs[1].num_chunks, 1u);
+}
+
+TEST_F (TestMem, slab_large)
+{
+  char *test;
+  size_t size = BTOR_MEM_SLAB_MAX_SIZE + 1;
+
+  test = (char *) btor_mem_slab_calloc (d_mm, size);
+  ASSERT_NE (test, nullptr);
+  ASSERT_EQ (test[size - 1], 0);
+  ASSERT_EQ (d_mm->slab_allocated, 0u);
+  btor_mem_slab_free (d_mm, test, size);
+}
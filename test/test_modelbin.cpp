@@ -0,0 +1,383 @@
+/*  Boolector: Satisfiability Modulo Theories (SMT) solver.
+ *
+ *  Copyright (C) 2020 Aina Niemetz.
+ *  Copyright (C) 2020 Mathias Preiner.
+ *
+ *  This file is part of Boolector.
+ *  See COPYING for more information on using this software.
+ */
+
+#include "test.h"
+
+extern "C" {
+#include "boolector.h"
+}
+
+#ifdef BTOR_HAVE_PTHREADS
+#include <pthread.h>
+#endif
+
+class TestModelBin : public TestBoolector
+{
+ protected:
+  void SetUp () override
+  {
+    TestBoolector::SetUp ();
+    boolector_set_opt (d_btor, BTOR_OPT_MODEL_GEN, 1);
+  }
+};
+
+TEST_F (TestModelBin, bv_words)
+{
+  BoolectorSort s8, s64, s100;
+  BoolectorNode *x, *y, *z, *eq, *nodes[3];
+  uint64_t words[4];
+  size_t size;
+
+  s8   = boolector_bitvec_sort (d_btor, 8);
+  s64  = boolector_bitvec_sort (d_btor, 64);
+  s100 = boolector_bitvec_sort (d_btor, 100);
+  x    = boolector_var (d_btor, s8, "x");
+  y    = boolector_constd (d_btor, s64, "18446744073709551615");
+  z    = boolector_constd (d_btor, s100, "1267650600228229401496703205375");
+  eq   = boolector_eq (d_btor, x, boolector_constd (d_btor, s8, "200"));
+  boolector_assert (d_btor, eq);
+  ASSERT_EQ (boolector_sat (d_btor), BOOLECTOR_SAT);
+
+  nodes[0] = x;
+  nodes[1] = y;
+  nodes[2] = z;
+
+  /* query size, buffer too small */
+  size = boolector_bv_assignments_words (d_btor, 3, nodes, 0, 0);
+  ASSERT_EQ (size, 4u);
+  words[0] = 42;
+  size     = boolector_bv_assignments_words (d_btor, 3, nodes, words, 3);
+  ASSERT_EQ (size, 4u);
+  ASSERT_EQ (words[0], 42u);
+
+  size = boolector_bv_assignments_words (d_btor, 3, nodes, words, 4);
+  ASSERT_EQ (size, 4u);
+  ASSERT_EQ (words[0], 200u);
+  ASSERT_EQ (words[1], UINT64_MAX);
+  /* 2^100 - 1 */
+  ASSERT_EQ (words[2], UINT64_MAX);
+  ASSERT_EQ (words[3], ((uint64_t) 1 << 36) - 1);
+
+  boolector_release_all (d_btor);
+}
+
+TEST_F (TestModelBin, bv_uint64)
+{
+  BoolectorSort s1, s32, s64;
+  BoolectorNode *a, *b, *c, *nodes[3];
+  uint64_t values[3];
+
+  s1  = boolector_bitvec_sort (d_btor, 1);
+  s32 = boolector_bitvec_sort (d_btor, 32);
+  s64 = boolector_bitvec_sort (d_btor, 64);
+  a   = boolector_var (d_btor, s1, "a");
+  b   = boolector_var (d_btor, s32, "b");
+  c   = boolector_var (d_btor, s64, "c");
+  boolector_assert (d_btor, a);
+  boolector_assert (
+      d_btor,
+      boolector_eq (d_btor, b, boolector_unsigned_int (d_btor, 7, s32)));
+  boolector_assert (
+      d_btor,
+      boolector_eq (
+          d_btor, c, boolector_consth (d_btor, s64, "fedcba9876543210")));
+  ASSERT_EQ (boolector_sat (d_btor), BOOLECTOR_SAT);
+
+  nodes[0] = a;
+  nodes[1] = b;
+  nodes[2] = c;
+  boolector_bv_assignments_uint64 (d_btor, 3, nodes, values);
+  ASSERT_EQ (values[0], 1u);
+  ASSERT_EQ (values[1], 7u);
+  ASSERT_EQ (values[2], 0xfedcba9876543210u);
+
+  boolector_release_all (d_btor);
+}
+
+TEST_F (TestModelBin, array_words)
+{
+  BoolectorSort s8, s70, as;
+  BoolectorNode *arr, *i, *v;
+  uint64_t table[5];
+  uint32_t num_entries;
+  bool has_default;
+  size_t size;
+
+  s8  = boolector_bitvec_sort (d_btor, 8);
+  s70 = boolector_bitvec_sort (d_btor, 70);
+  as  = boolector_array_sort (d_btor, s8, s70);
+  arr = boolector_array (d_btor, as, "a");
+  i   = boolector_unsigned_int (d_btor, 3, s8);
+  v   = boolector_consth (d_btor, s70, "20000000000000001");
+  boolector_assert (
+      d_btor, boolector_eq (d_btor, boolector_read (d_btor, arr, i), v));
+  ASSERT_EQ (boolector_sat (d_btor), BOOLECTOR_SAT);
+
+  size = boolector_fun_assignment_words (
+      d_btor, arr, 0, 0, &num_entries, &has_default);
+  ASSERT_EQ (size, 3u);
+  ASSERT_EQ (num_entries, 1u);
+  ASSERT_FALSE (has_default);
+
+  size = boolector_fun_assignment_words (
+      d_btor, arr, table, 5, &num_entries, &has_default);
+  ASSERT_EQ (size, 3u);
+  ASSERT_EQ (table[0], 3u);
+  ASSERT_EQ (table[1], 1u);
+  ASSERT_EQ (table[2], 2u);
+
+  boolector_release_all (d_btor);
+}
+
+TEST_F (TestModelBin, const_array_words)
+{
+  BoolectorSort s8, as;
+  BoolectorNode *arr, *w;
+  uint64_t table[3];
+  uint32_t num_entries;
+  bool has_default;
+  size_t size;
+
+  s8  = boolector_bitvec_sort (d_btor, 8);
+  as  = boolector_array_sort (d_btor, s8, s8);
+  arr = boolector_const_array (
+      d_btor, as, boolector_unsigned_int (d_btor, 9, s8));
+  w = boolector_write (d_btor,
+                       arr,
+                       boolector_unsigned_int (d_btor, 1, s8),
+                       boolector_unsigned_int (d_btor, 2, s8));
+  boolector_assert (
+      d_btor,
+      boolector_eq (d_btor,
+                    boolector_read (d_btor, w, boolector_var (d_btor, s8, 0)),
+                    boolector_unsigned_int (d_btor, 2, s8)));
+  ASSERT_EQ (boolector_sat (d_btor), BOOLECTOR_SAT);
+
+  size = boolector_fun_assignment_words (
+      d_btor, arr, table, 3, &num_entries, &has_default);
+  ASSERT_EQ (size, 1u);
+  ASSERT_EQ (num_entries, 0u);
+  ASSERT_TRUE (has_default);
+  ASSERT_EQ (table[0], 9u);
+
+  size = boolector_fun_assignment_words (
+      d_btor, w, table, 3, &num_entries, &has_default);
+  ASSERT_EQ (size, 2u);
+  ASSERT_EQ (num_entries, 1u);
+  ASSERT_FALSE (has_default);
+  ASSERT_EQ (table[0], 1u);
+  ASSERT_EQ (table[1], 2u);
+
+  boolector_release_all (d_btor);
+}
+
+TEST_F (TestModelBin, uf_words)
+{
+  BoolectorSort s8, s16, fs, dom[2];
+  BoolectorNode *f, *args[2];
+  uint64_t table[3];
+  uint32_t num_entries;
+  bool has_default;
+  size_t size;
+
+  s8      = boolector_bitvec_sort (d_btor, 8);
+  s16     = boolector_bitvec_sort (d_btor, 16);
+  dom[0]  = s8;
+  dom[1]  = s16;
+  fs      = boolector_fun_sort (d_btor, dom, 2, s8);
+  f       = boolector_uf (d_btor, fs, "f");
+  args[0] = boolector_unsigned_int (d_btor, 4, s8);
+  args[1] = boolector_unsigned_int (d_btor, 1000, s16);
+  boolector_assert (d_btor,
+                    boolector_eq (d_btor,
+                                  boolector_apply (d_btor, args, 2, f),
+                                  boolector_unsigned_int (d_btor, 77, s8)));
+  ASSERT_EQ (boolector_sat (d_btor), BOOLECTOR_SAT);
+
+  size = boolector_fun_assignment_words (
+      d_btor, f, table, 3, &num_entries, &has_default);
+  ASSERT_EQ (size, 3u);
+  ASSERT_EQ (num_entries, 1u);
+  ASSERT_FALSE (has_default);
+  ASSERT_EQ (table[0], 4u);
+  ASSERT_EQ (table[1], 1000u);
+  ASSERT_EQ (table[2], 77u);
+
+  boolector_release_all (d_btor);
+}
+
+TEST_F (TestModelBin, snapshot)
+{
+  BoolectorSort s8, s100, as;
+  BoolectorNode *x, *y, *arr, *nodes[3];
+  BoolectorModel *model;
+  uint64_t words[5], table[3];
+  uint32_t num_entries;
+  bool has_default;
+
+  boolector_set_opt (d_btor, BTOR_OPT_INCREMENTAL, 1);
+  s8   = boolector_bitvec_sort (d_btor, 8);
+  s100 = boolector_bitvec_sort (d_btor, 100);
+  as   = boolector_array_sort (d_btor, s8, s8);
+  x    = boolector_var (d_btor, s8, "x");
+  y    = boolector_var (d_btor, s100, "y");
+  arr  = boolector_array (d_btor, as, "a");
+  boolector_assert (
+      d_btor, boolector_eq (d_btor, x, boolector_unsigned_int (d_btor, 5, s8)));
+  boolector_assert (
+      d_btor,
+      boolector_eq (d_btor, y, boolector_unsigned_int (d_btor, 1, s100)));
+  boolector_assert (
+      d_btor,
+      boolector_eq (d_btor,
+                    boolector_read (d_btor, arr, x),
+                    boolector_unsigned_int (d_btor, 7, s8)));
+  ASSERT_EQ (boolector_sat (d_btor), BOOLECTOR_SAT);
+  model = boolector_model_snapshot (d_btor);
+
+  /* inverted nodes share the assignment of the original node */
+  nodes[0] = x;
+  nodes[1] = boolector_not (d_btor, y);
+  nodes[2] = boolector_not (d_btor, x);
+  ASSERT_EQ (boolector_model_bv_words (model, 3, nodes, 0, 0), 4u);
+  ASSERT_EQ (boolector_model_bv_words (model, 3, nodes, words, 5), 4u);
+  ASSERT_EQ (words[0], 5u);
+  ASSERT_EQ (words[1], UINT64_MAX - 1);
+  ASSERT_EQ (words[2], ((uint64_t) 1 << 36) - 1);
+  ASSERT_EQ (words[3], 250u);
+
+  /* the snapshot is independent of the instance */
+  boolector_assert (
+      d_btor,
+      boolector_ne (d_btor, x, boolector_unsigned_int (d_btor, 5, s8)));
+  ASSERT_EQ (boolector_sat (d_btor), BOOLECTOR_UNSAT);
+  ASSERT_EQ (boolector_model_fun_words (
+                 model, arr, table, 3, &num_entries, &has_default),
+             2u);
+  ASSERT_EQ (num_entries, 1u);
+  ASSERT_FALSE (has_default);
+  ASSERT_EQ (table[0], 5u);
+  ASSERT_EQ (table[1], 7u);
+
+  boolector_model_bv_uint64 (model, 1, &x, words);
+  ASSERT_EQ (words[0], 5u);
+
+  boolector_release_all (d_btor);
+  boolector_delete (d_btor);
+  d_btor = nullptr;
+  boolector_model_delete (model);
+}
+
+#ifdef BTOR_HAVE_PTHREADS
+struct QueryState
+{
+  BoolectorModel *model;
+  BoolectorNode **nodes;
+  uint32_t n;
+  uint64_t sum;
+};
+
+static void *
+query_snapshot (void *arg)
+{
+  QueryState *state = (QueryState *) arg;
+  uint64_t values[64];
+  uint32_t i, j;
+
+  state->sum = 0;
+  for (i = 0; i < 1000; i++)
+  {
+    boolector_model_bv_uint64 (state->model, state->n, state->nodes, values);
+    for (j = 0; j < state->n; j++) state->sum += values[j];
+  }
+  return 0;
+}
+
+TEST_F (TestModelBin, snapshot_threads)
+{
+  BoolectorSort s32;
+  BoolectorNode *vars[64];
+  BoolectorModel *model;
+  QueryState states[4];
+  pthread_t threads[4];
+  uint32_t i;
+
+  s32 = boolector_bitvec_sort (d_btor, 32);
+  for (i = 0; i < 64; i++)
+  {
+    vars[i] = boolector_var (d_btor, s32, 0);
+    boolector_assert (
+        d_btor,
+        boolector_eq (
+            d_btor, vars[i], boolector_unsigned_int (d_btor, i, s32)));
+  }
+  ASSERT_EQ (boolector_sat (d_btor), BOOLECTOR_SAT);
+  model = boolector_model_snapshot (d_btor);
+
+  for (i = 0; i < 4; i++)
+  {
+    states[i].model = model;
+    states[i].nodes = vars;
+    states[i].n     = 64;
+    pthread_create (&threads[i], 0, query_snapshot, &states[i]);
+  }
+  for (i = 0; i < 4; i++)
+  {
+    pthread_join (threads[i], 0);
+    ASSERT_EQ (states[i].sum, 1000u * (63u * 64u / 2));
+  }
+
+  boolector_model_delete (model);
+  boolector_release_all (d_btor);
+}
+
+static void *
+solve_instance (void *arg)
+{
+  uint64_t *value = (uint64_t *) arg;
+  Btor *btor;
+  BoolectorSort s16;
+  BoolectorNode *x, *y;
+
+  btor = boolector_new ();
+  boolector_set_opt (btor, BTOR_OPT_MODEL_GEN, 1);
+  s16 = boolector_bitvec_sort (btor, 16);
+  x   = boolector_var (btor, s16, "x");
+  y   = boolector_var (btor, s16, "y");
+  boolector_assert (
+      btor,
+      boolector_eq (btor,
+                    boolector_mul (btor, x, y),
+                    boolector_unsigned_int (btor, *value, s16)));
+  boolector_assert (
+      btor, boolector_ugt (btor, x, boolector_unsigned_int (btor, 1, s16)));
+  boolector_assert (
+      btor, boolector_ugt (btor, y, boolector_unsigned_int (btor, 1, s16)));
+  boolector_assert (btor, boolector_not (btor, boolector_umulo (btor, x, y)));
+  *value = boolector_sat (btor);
+  boolector_release_all (btor);
+  boolector_delete (btor);
+  return 0;
+}
+
+TEST_F (TestModelBin, instances_threads)
+{
+  pthread_t threads[4];
+  uint64_t values[4] = {221, 223, 4087, 65521};
+  uint32_t i;
+
+  for (i = 0; i < 4; i++)
+    pthread_create (&threads[i], 0, solve_instance, &values[i]);
+  for (i = 0; i < 4; i++) pthread_join (threads[i], 0);
+  ASSERT_EQ (values[0], (uint64_t) BOOLECTOR_SAT);
+  ASSERT_EQ (values[1], (uint64_t) BOOLECTOR_UNSAT);
+  ASSERT_EQ (values[2], (uint64_t) BOOLECTOR_SAT);
+  ASSERT_EQ (values[3], (uint64_t) BOOLECTOR_UNSAT);
+}
+#endif
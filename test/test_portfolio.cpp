@@ -0,0 +1,144 @@
+/*  Boolector: Satisfiability Modulo Theories (SMT) solver.
+ *
+ *  Copyright (C) 2020 Aina Niemetz.
+ *
+ *  This file is part of Boolector.
+ *  See COPYING for more information on using this software.
+ */
+
+#include "test.h"
+
+extern "C" {
+#include "btoropt.h"
+}
+
+class TestPortfolio : public TestBoolector
+{
+ protected:
+  void SetUp () override
+  {
+    TestBoolector::SetUp ();
+    boolector_set_opt (d_btor, BTOR_OPT_ENGINE, BTOR_ENGINE_PORTFOLIO);
+    boolector_set_opt (d_btor, BTOR_OPT_MODEL_GEN, 1);
+  }
+
+  /* x * y = c with x, y > 1 */
+  void test_portfolio_mul (uint32_t c)
+  {
+    BoolectorSort s;
+    BoolectorNode *x, *y, *one, *mul, *cc, *eq, *ugtx, *ugty;
+    const char *xval, *yval;
+    uint32_t w = 16;
+
+    s    = boolector_bitvec_sort (d_btor, w);
+    x    = boolector_var (d_btor, s, "x");
+    y    = boolector_var (d_btor, s, "y");
+    one  = boolector_one (d_btor, s);
+    mul  = boolector_mul (d_btor, x, y);
+    cc   = boolector_unsigned_int (d_btor, c, s);
+    eq   = boolector_eq (d_btor, mul, cc);
+    ugtx = boolector_ugt (d_btor, x, one);
+    ugty = boolector_ugt (d_btor, y, one);
+    boolector_assert (d_btor, eq);
+    boolector_assert (d_btor, ugtx);
+    boolector_assert (d_btor, ugty);
+
+    ASSERT_EQ (boolector_sat (d_btor), BOOLECTOR_SAT);
+    xval = boolector_bv_assignment (d_btor, x);
+    yval = boolector_bv_assignment (d_btor, y);
+    ASSERT_EQ ((strtoul (xval, 0, 2) * strtoul (yval, 0, 2)) % (1u << w), c);
+    boolector_free_bv_assignment (d_btor, xval);
+    boolector_free_bv_assignment (d_btor, yval);
+
+    boolector_release (d_btor, x);
+    boolector_release (d_btor, y);
+    boolector_release (d_btor, one);
+    boolector_release (d_btor, mul);
+    boolector_release (d_btor, cc);
+    boolector_release (d_btor, eq);
+    boolector_release (d_btor, ugtx);
+    boolector_release (d_btor, ugty);
+    boolector_release_sort (d_btor, s);
+  }
+};
+
+TEST_F (TestPortfolio, sat_bv)
+{
+  boolector_set_opt (d_btor, BTOR_OPT_PORTFOLIO_SLS, 1);
+  boolector_set_opt (d_btor, BTOR_OPT_PORTFOLIO_AIGPROP, 1);
+  test_portfolio_mul (0x1234);
+}
+
+TEST_F (TestPortfolio, sat_bv_no_fun)
+{
+  boolector_set_opt (d_btor, BTOR_OPT_PORTFOLIO_FUN, 0);
+  test_portfolio_mul (0x4d2);
+}
+
+TEST_F (TestPortfolio, unsat_bv)
+{
+  BoolectorSort s;
+  BoolectorNode *x, *y, *add1, *add2, *ne;
+
+  s    = boolector_bitvec_sort (d_btor, 8);
+  x    = boolector_var (d_btor, s, "x");
+  y    = boolector_var (d_btor, s, "y");
+  add1 = boolector_add (d_btor, x, y);
+  add2 = boolector_add (d_btor, y, x);
+  ne   = boolector_ne (d_btor, add1, add2);
+  boolector_assert (d_btor, ne);
+
+  ASSERT_EQ (boolector_sat (d_btor), BOOLECTOR_UNSAT);
+
+  boolector_release (d_btor, x);
+  boolector_release (d_btor, y);
+  boolector_release (d_btor, add1);
+  boolector_release (d_btor, add2);
+  boolector_release (d_btor, ne);
+  boolector_release_sort (d_btor, s);
+}
+
+TEST_F (TestPortfolio, inc_uf)
+{
+  BoolectorSort s, fs;
+  BoolectorNode *x, *f, *app, *zero, *ne, *eq, *eqapp;
+  const char *val;
+
+  boolector_set_opt (d_btor, BTOR_OPT_INCREMENTAL, 1);
+
+  s     = boolector_bitvec_sort (d_btor, 8);
+  fs    = boolector_fun_sort (d_btor, &s, 1, s);
+  x     = boolector_var (d_btor, s, "x");
+  f     = boolector_uf (d_btor, fs, "f");
+  app   = boolector_apply (d_btor, &x, 1, f);
+  zero  = boolector_zero (d_btor, s);
+  ne    = boolector_ne (d_btor, app, zero);
+  eq    = boolector_eq (d_btor, x, zero);
+  eqapp = boolector_eq (d_btor, app, zero);
+  boolector_assert (d_btor, ne);
+
+  ASSERT_EQ (boolector_sat (d_btor), BOOLECTOR_SAT);
+  val = boolector_bv_assignment (d_btor, app);
+  ASSERT_STRNE (val, "00000000");
+  boolector_free_bv_assignment (d_btor, val);
+
+  boolector_assume (d_btor, eq);
+  ASSERT_EQ (boolector_sat (d_btor), BOOLECTOR_SAT);
+  val = boolector_bv_assignment (d_btor, x);
+  ASSERT_STREQ (val, "00000000");
+  boolector_free_bv_assignment (d_btor, val);
+
+  boolector_assert (d_btor, eq);
+  boolector_assume (d_btor, eqapp);
+  ASSERT_EQ (boolector_sat (d_btor), BOOLECTOR_UNSAT);
+
+  boolector_release (d_btor, x);
+  boolector_release (d_btor, f);
+  boolector_release (d_btor, app);
+  boolector_release (d_btor, zero);
+  boolector_release (d_btor, ne);
+  boolector_release (d_btor, eq);
+  boolector_release (d_btor, eqapp);
+  boolector_release_sort (d_btor, s);
+  boolector_release_sort (d_btor, fs);
+}
@@ -0,0 +1,116 @@
+/*  Boolector: Satisfiability Modulo Theories (SMT) solver.
+ *
+ *  Copyright (C) 2020 Aina Niemetz.
+ *  Copyright (C) 2020 Mathias Preiner.
+ *
+ *  This file is part of Boolector.
+ *  See COPYING for more information on using this software.
+ */
+
+#include "test.h"
+
+extern "C" {
+#include "btorcore.h"
+#include "btorexp.h"
+#include "btoropt.h"
+#include "preprocess/btorpreprocess.h"
+}
+
+class TestPP : public TestBtor
+{
+ protected:
+  /* x[3:0] = 5 and x + y * z < y */
+  void assert_formula ()
+  {
+    BtorSortId s8 = btor_sort_bv (d_btor, 8), s4 = btor_sort_bv (d_btor, 4);
+    BtorNode *x   = btor_exp_var (d_btor, s8, "x");
+    BtorNode *y   = btor_exp_var (d_btor, s8, "y");
+    BtorNode *z   = btor_exp_var (d_btor, s8, "z");
+    BtorNode *sl  = btor_exp_bv_slice (d_btor, x, 3, 0);
+    BtorNode *c5  = btor_exp_bv_unsigned (d_btor, 5, s4);
+    BtorNode *e1  = btor_exp_eq (d_btor, sl, c5);
+    BtorNode *m   = btor_exp_bv_mul (d_btor, y, z);
+    BtorNode *a   = btor_exp_bv_add (d_btor, m, x);
+    BtorNode *e2  = btor_exp_bv_ult (d_btor, a, y);
+    btor_assert_exp (d_btor, e1);
+    btor_assert_exp (d_btor, e2);
+    btor_node_release (d_btor, e2);
+    btor_node_release (d_btor, a);
+    btor_node_release (d_btor, m);
+    btor_node_release (d_btor, e1);
+    btor_node_release (d_btor, c5);
+    btor_node_release (d_btor, sl);
+    btor_node_release (d_btor, z);
+    btor_node_release (d_btor, y);
+    btor_node_release (d_btor, x);
+    btor_sort_release (d_btor, s4);
+    btor_sort_release (d_btor, s8);
+  }
+
+  BtorPPStats *stats (BtorPPPass pass) { return &d_btor->stats.pp[pass]; }
+};
+
+TEST_F (TestPP, set_order)
+{
+  ASSERT_TRUE (btor_pp_set_order (d_btor, "ucopt,slices:0.5,normadd"));
+  ASSERT_EQ (d_btor->pp.num_passes, 3u);
+  ASSERT_EQ (d_btor->pp.order[0], BTOR_PP_UCOPT);
+  ASSERT_EQ (d_btor->pp.order[1], BTOR_PP_ELIM_SLICES);
+  ASSERT_EQ (d_btor->pp.order[2], BTOR_PP_NORMALIZE_ADDS);
+  ASSERT_EQ (d_btor->pp.budget[BTOR_PP_ELIM_SLICES], 0.5);
+  ASSERT_EQ (d_btor->pp.budget[BTOR_PP_UCOPT], 0);
+
+  ASSERT_FALSE (btor_pp_set_order (d_btor, ""));
+  ASSERT_FALSE (btor_pp_set_order (d_btor, "slices,"));
+  ASSERT_FALSE (btor_pp_set_order (d_btor, "slice"));
+  ASSERT_FALSE (btor_pp_set_order (d_btor, "slices,ucopt,slices"));
+  ASSERT_FALSE (btor_pp_set_order (d_btor, "varsubst,slices"));
+  ASSERT_FALSE (btor_pp_set_order (d_btor, "slices:"));
+  ASSERT_FALSE (btor_pp_set_order (d_btor, "slices:-1"));
+  ASSERT_FALSE (btor_pp_set_order (d_btor, "slices:1s"));
+  ASSERT_EQ (d_btor->pp.num_passes, 3u);
+  ASSERT_EQ (d_btor->pp.budget[BTOR_PP_ELIM_SLICES], 0.5);
+}
+
+TEST_F (TestPP, stats)
+{
+  assert_formula ();
+  ASSERT_EQ (btor_simplify (d_btor), BTOR_RESULT_UNKNOWN);
+  ASSERT_GT (d_btor->stats.eliminated_slices, 0u);
+  ASSERT_GT (stats (BTOR_PP_ELIM_SLICES)->runs, 0u);
+  ASSERT_EQ (stats (BTOR_PP_VAR_SUBST)->runs, 1u);
+  ASSERT_GT (stats (BTOR_PP_VAR_SUBST)->nodes, 0);
+  ASSERT_EQ (stats (BTOR_PP_ACKERMANN)->runs, 0u);
+}
+
+TEST_F (TestPP, order)
+{
+  ASSERT_TRUE (btor_pp_set_order (d_btor, "extract,merge"));
+  assert_formula ();
+  ASSERT_EQ (btor_simplify (d_btor), BTOR_RESULT_UNKNOWN);
+  ASSERT_EQ (d_btor->stats.eliminated_slices, 0u);
+  ASSERT_EQ (stats (BTOR_PP_ELIM_SLICES)->runs, 0u);
+  ASSERT_EQ (stats (BTOR_PP_EXTRACT_LAMBDAS)->runs, 1u);
+}
+
+TEST_F (TestPP, skip)
+{
+  /* slice elimination produces variable substitution constraints, which
+   * starts a second round */
+  ASSERT_TRUE (btor_pp_set_order (d_btor, "extract,slices"));
+  assert_formula ();
+  ASSERT_EQ (btor_simplify (d_btor), BTOR_RESULT_UNKNOWN);
+  ASSERT_EQ (stats (BTOR_PP_EXTRACT_LAMBDAS)->runs, 1u);
+  ASSERT_EQ (stats (BTOR_PP_EXTRACT_LAMBDAS)->skipped, 1u);
+  ASSERT_EQ (stats (BTOR_PP_ELIM_SLICES)->runs, 2u);
+}
+
+TEST_F (TestPP, no_skip)
+{
+  btor_opt_set (d_btor, BTOR_OPT_PP_SKIP, 0);
+  ASSERT_TRUE (btor_pp_set_order (d_btor, "extract,slices"));
+  assert_formula ();
+  ASSERT_EQ (btor_simplify (d_btor), BTOR_RESULT_UNKNOWN);
+  ASSERT_EQ (stats (BTOR_PP_EXTRACT_LAMBDAS)->runs, 2u);
+  ASSERT_EQ (stats (BTOR_PP_EXTRACT_LAMBDAS)->skipped, 0u);
+}
@@ -0,0 +1,150 @@
+/*  Boolector: Satisfiability Modulo Theories (SMT) solver.
+ *
+ *  Copyright (C) 2020 Aina Niemetz.
+ *  Copyright (C) 2020 Mathias Preiner.
+ *
+ *  This file is part of Boolector.
+ *  See COPYING for more information on using this software.
+ */
+
+#include "test.h"
+
+extern "C" {
+#include "btorcore.h"
+#include "btorexp.h"
+#include "btoropt.h"
+#include "btorrwcache.h"
+#include "utils/btorstack.h"
+}
+
+class TestRwCache : public TestBtor
+{
+ protected:
+  static constexpr uint32_t TEST_RW_CACHE_NVARS = 300;
+
+  void SetUp () override
+  {
+    TestBtor::SetUp ();
+
+    BtorSortId sort = btor_sort_bv (d_btor, 8);
+    BTOR_INIT_STACK (d_btor->mm, d_vars);
+    for (uint32_t i = 0; i < TEST_RW_CACHE_NVARS; i++)
+      BTOR_PUSH_STACK (d_vars, btor_exp_var (d_btor, sort, 0));
+    btor_sort_release (d_btor, sort);
+  }
+
+  void TearDown () override
+  {
+    while (!BTOR_EMPTY_STACK (d_vars))
+      btor_node_release (d_btor, BTOR_POP_STACK (d_vars));
+    BTOR_RELEASE_STACK (d_vars);
+    TestBtor::TearDown ();
+  }
+
+  int32_t id (uint32_t i) { return btor_node_get_id (d_vars.start[i]); }
+
+  /* Add a tuple for each pair of variables (i, j) while keeping the tuple of
+   * pair (0, 0) in use. Returns true if tuple (0, 0) is still cached. */
+  bool test_rw_cache_fill (BtorRwCache *rwc)
+  {
+    uint32_t i, j;
+
+    btor_rw_cache_add (rwc, BTOR_BV_ADD_NODE, id (0), id (0), 0, id (0));
+    for (i = 0; i < TEST_RW_CACHE_NVARS; i++)
+    {
+      for (j = i ? 0 : 1; j < TEST_RW_CACHE_NVARS; j++)
+      {
+        btor_rw_cache_add (rwc, BTOR_BV_ADD_NODE, id (i), id (j), 0, id (i));
+        (void) btor_rw_cache_get (rwc, BTOR_BV_ADD_NODE, id (0), id (0), 0);
+      }
+    }
+    return btor_rw_cache_get (rwc, BTOR_BV_ADD_NODE, id (0), id (0), 0)
+           == id (0);
+  }
+
+  BtorNodePtrStack d_vars;
+};
+
+TEST_F (TestRwCache, add_get)
+{
+  BtorRwCache rwc;
+
+  btor_rw_cache_init (&rwc, d_btor);
+  ASSERT_EQ (btor_rw_cache_get (&rwc, BTOR_BV_AND_NODE, id (1), id (2), 0), 0);
+  btor_rw_cache_add (&rwc, BTOR_BV_AND_NODE, id (1), id (2), 0, id (3));
+  btor_rw_cache_add (&rwc, BTOR_BV_SLICE_NODE, id (1), 7, 4, id (4));
+  ASSERT_EQ (btor_rw_cache_get (&rwc, BTOR_BV_AND_NODE, id (1), id (2), 0),
+             id (3));
+  ASSERT_EQ (btor_rw_cache_get (&rwc, BTOR_BV_AND_NODE, id (2), id (1), 0), 0);
+  ASSERT_EQ (btor_rw_cache_get (&rwc, BTOR_BV_SLICE_NODE, id (1), 7, 4),
+             id (4));
+  ASSERT_EQ (rwc.count, 2u);
+  ASSERT_EQ (rwc.num_add, 2u);
+
+  btor_rw_cache_reset (&rwc);
+  ASSERT_EQ (btor_rw_cache_get (&rwc, BTOR_BV_AND_NODE, id (1), id (2), 0), 0);
+  ASSERT_EQ (rwc.count, 0u);
+  ASSERT_EQ (rwc.num_add, 2u);
+  btor_rw_cache_delete (&rwc);
+}
+
+TEST_F (TestRwCache, evict_lru)
+{
+  BtorRwCache rwc;
+
+  btor_opt_set (d_btor, BTOR_OPT_RW_CACHE_SIZE, 1);
+  btor_opt_set (d_btor, BTOR_OPT_RW_CACHE_EVICT, BTOR_RW_CACHE_EVICT_LRU);
+  btor_rw_cache_init (&rwc, d_btor);
+  ASSERT_TRUE (test_rw_cache_fill (&rwc));
+  ASSERT_LE (rwc.size * sizeof (BtorRwCacheTuple), 1u << 20);
+  ASSERT_GT (rwc.num_evict, 0u);
+  btor_rw_cache_delete (&rwc);
+}
+
+TEST_F (TestRwCache, evict_fifo)
+{
+  BtorRwCache rwc;
+
+  btor_opt_set (d_btor, BTOR_OPT_RW_CACHE_SIZE, 1);
+  btor_opt_set (d_btor, BTOR_OPT_RW_CACHE_EVICT, BTOR_RW_CACHE_EVICT_FIFO);
+  btor_rw_cache_init (&rwc, d_btor);
+  ASSERT_FALSE (test_rw_cache_fill (&rwc));
+  ASSERT_LE (rwc.size * sizeof (BtorRwCacheTuple), 1u << 20);
+  ASSERT_GT (rwc.num_evict, 0u);
+  btor_rw_cache_delete (&rwc);
+}
+
+TEST_F (TestRwCache, evict_none)
+{
+  BtorRwCache rwc;
+
+  btor_opt_set (d_btor, BTOR_OPT_RW_CACHE_SIZE, 1);
+  btor_opt_set (d_btor, BTOR_OPT_RW_CACHE_EVICT, BTOR_RW_CACHE_EVICT_NONE);
+  btor_rw_cache_init (&rwc, d_btor);
+  ASSERT_TRUE (test_rw_cache_fill (&rwc));
+  ASSERT_EQ (rwc.num_evict, 0u);
+  ASSERT_EQ (rwc.count, TEST_RW_CACHE_NVARS * TEST_RW_CACHE_NVARS);
+  btor_rw_cache_delete (&rwc);
+}
+
+TEST_F (TestRwCache, gc)
+{
+  BtorRwCache rwc;
+  BtorSortId sort;
+  BtorNode *var;
+
+  sort = btor_sort_bv (d_btor, 8);
+  var  = btor_exp_var (d_btor, sort, 0);
+  btor_rw_cache_init (&rwc, d_btor);
+  btor_rw_cache_add (&rwc, BTOR_BV_AND_NODE, id (1), id (2), 0, var->id);
+  btor_rw_cache_add (&rwc, BTOR_BV_AND_NODE, var->id, id (2), 0, id (1));
+  btor_rw_cache_add (&rwc, BTOR_BV_AND_NODE, id (1), id (3), 0, id (1));
+  btor_node_release (d_btor, var);
+  btor_rw_cache_gc (&rwc);
+  ASSERT_EQ (rwc.count, 1u);
+  ASSERT_EQ (rwc.num_remove, 2u);
+  ASSERT_EQ (btor_rw_cache_get (&rwc, BTOR_BV_AND_NODE, id (1), id (3), 0),
+             id (1));
+  btor_rw_cache_delete (&rwc);
+  btor_sort_release (d_btor, sort);
+}
@@ -0,0 +1,137 @@
+/*  Boolector: Satisfiability Modulo Theories (SMT) solver.
+ *
+ *  Copyright (C) 2020 Aina Niemetz.
+ *  Copyright (C) 2020 Mathias Preiner.
+ *
+ *  This file is part of Boolector.
+ *  See COPYING for more information on using this software.
+ */
+
+#include "test.h"
+
+extern "C" {
+#include "utils/btoruniquetable.h"
+}
+
+#include <unordered_set>
+
+class TestUniqueTable : public TestMm
+{
+ protected:
+  void SetUp () override
+  {
+    TestMm::SetUp ();
+    btor_uniquetable_init (d_mm, &d_table);
+  }
+
+  void TearDown () override
+  {
+    btor_uniquetable_release (&d_table);
+    TestMm::TearDown ();
+  }
+
+  /* Use few distinct hash values to get long probe sequences. */
+  static uint32_t hash (int32_t id) { return (uint32_t) id % 97; }
+
+  static bool equal (void *state, int32_t id)
+  {
+    return *static_cast<int32_t *> (state) == id;
+  }
+
+  int32_t find (int32_t id)
+  {
+    return btor_uniquetable_find (&d_table, hash (id), equal, &id);
+  }
+
+  /* Check that 'd_table' contains exactly the ids in 'ids'. */
+  void check (const std::unordered_set<int32_t> &ids)
+  {
+    BtorUniqueTableIterator it;
+    std::unordered_set<int32_t> found;
+
+    ASSERT_EQ (d_table.num_elements, ids.size ());
+    for (int32_t id : ids) ASSERT_EQ (find (id), id);
+
+    btor_iter_uniquetable_init (&it, &d_table);
+    while (btor_iter_uniquetable_has_next (&it))
+    {
+      int32_t id = btor_iter_uniquetable_next (&it);
+      ASSERT_TRUE (ids.find (id) != ids.end ());
+      ASSERT_TRUE (found.insert (id).second);
+    }
+    ASSERT_EQ (found.size (), ids.size ());
+  }
+
+  BtorUniqueTable d_table;
+};
+
+TEST_F (TestUniqueTable, init_release)
+{
+  size_t allocated = d_mm->allocated;
+  BtorUniqueTable table;
+  btor_uniquetable_init (d_mm, &table);
+  ASSERT_EQ (table.num_elements, 0u);
+  ASSERT_GT (d_mm->allocated, allocated);
+  btor_uniquetable_release (&table);
+  ASSERT_EQ (d_mm->allocated, allocated);
+}
+
+TEST_F (TestUniqueTable, insert_find)
+{
+  std::unordered_set<int32_t> ids;
+
+  for (int32_t id = 1; id <= 5000; id++)
+  {
+    ASSERT_EQ (find (id), 0);
+    btor_uniquetable_insert (&d_table, id, hash (id));
+    ids.insert (id);
+    if (id % 500 == 0) check (ids);
+  }
+  check (ids);
+  ASSERT_EQ (find (5001), 0);
+}
+
+TEST_F (TestUniqueTable, remove)
+{
+  std::unordered_set<int32_t> ids;
+
+  /* removals interleaved with insertions, also while resizing */
+  for (int32_t id = 1; id <= 5000; id++)
+  {
+    btor_uniquetable_insert (&d_table, id, hash (id));
+    ids.insert (id);
+    if (id % 3 == 0)
+    {
+      btor_uniquetable_remove (&d_table, id / 3, hash (id / 3));
+      ids.erase (id / 3);
+      ASSERT_EQ (find (id / 3), 0);
+    }
+    if (id % 250 == 0) check (ids);
+  }
+  check (ids);
+
+  for (int32_t id = 1; id <= 5000; id++)
+  {
+    if (ids.find (id) == ids.end ()) continue;
+    btor_uniquetable_remove (&d_table, id, hash (id));
+    ids.erase (id);
+    if (id % 250 == 0) check (ids);
+  }
+  check (ids);
+}
+
+TEST_F (TestUniqueTable, clone)
+{
+  BtorUniqueTable clone;
+  std::unordered_set<int32_t> ids;
+
+  for (int32_t id = 1; id <= 100; id++)
+  {
+    btor_uniquetable_insert (&d_table, id, hash (id));
+    ids.insert (id);
+  }
+  btor_uniquetable_clone (d_mm, &d_table, &clone);
+  btor_uniquetable_release (&d_table);
+  d_table = clone;
+  check (ids);
+}